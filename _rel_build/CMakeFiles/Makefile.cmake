@@ -0,0 +1,152 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/hdf5/cmake_hdf5_test.cxx"
+  "/root/repo/apps/CMakeLists.txt"
+  "/root/repo/apps/PointCloud/CMakeLists.txt"
+  "/root/repo/apps/convert/CMakeLists.txt"
+  "/root/repo/apps/threads/CMakeLists.txt"
+  "/root/repo/apps/tictactoe/CMakeLists.txt"
+  "/root/repo/cmake/FindGTest.cmake"
+  "/root/repo/cmake/FindPackageHandleStandardArgs.cmake"
+  "/root/repo/cmake/FindPackageMessage.cmake"
+  "/root/repo/cmake/GoogleTest.cmake"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/bench/CMakeLists.txt"
+  "/root/repo/src/ctest/CMakeLists.txt"
+  "/root/repo/src/utest/CMakeLists.txt"
+  "/root/repo/src/utest/arrays/CMakeLists.txt"
+  "/root/repo/src/utest/astro/CMakeLists.txt"
+  "/root/repo/src/utest/base/CMakeLists.txt"
+  "/root/repo/src/utest/blas/CMakeLists.txt"
+  "/root/repo/src/utest/configdb/CMakeLists.txt"
+  "/root/repo/src/utest/data/CMakeLists.txt"
+  "/root/repo/src/utest/evo/CMakeLists.txt"
+  "/root/repo/src/utest/fuzzy/CMakeLists.txt"
+  "/root/repo/src/utest/linalg/CMakeLists.txt"
+  "/root/repo/src/utest/matvec/CMakeLists.txt"
+  "/root/repo/src/utest/nervenet/CMakeLists.txt"
+  "/root/repo/src/utest/strings/CMakeLists.txt"
+  "/root/repo/src/utest/time/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBLAS.cmake"
+  "/usr/share/cmake-3.25/Modules/FindHDF5.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLAPACK.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ctest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utest/base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utest/arrays/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utest/strings/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utest/configdb/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utest/matvec/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utest/linalg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utest/blas/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utest/data/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utest/time/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utest/astro/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utest/fuzzy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utest/evo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utest/nervenet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/bench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/convert/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/tictactoe/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/threads/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/PointCloud/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/CMakeFiles/callisto.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_appopt.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_blas.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_configdb.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_csvfile.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_datetime.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_dropoff.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_eigen.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_entropy.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_fixednormal.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_integrate.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_lapack.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_psgraph.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_refkdtree.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_rk4.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_shuffle.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_stream.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_thread.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_tlogger.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_version.dir/DependInfo.cmake"
+  "src/ctest/CMakeFiles/ctest_wedge.dir/DependInfo.cmake"
+  "src/utest/base/CMakeFiles/base.dir/DependInfo.cmake"
+  "src/utest/arrays/CMakeFiles/arrays.dir/DependInfo.cmake"
+  "src/utest/strings/CMakeFiles/strings.dir/DependInfo.cmake"
+  "src/utest/configdb/CMakeFiles/configdb.dir/DependInfo.cmake"
+  "src/utest/matvec/CMakeFiles/matvec.dir/DependInfo.cmake"
+  "src/utest/linalg/CMakeFiles/linalg.dir/DependInfo.cmake"
+  "src/utest/blas/CMakeFiles/blas.dir/DependInfo.cmake"
+  "src/utest/data/CMakeFiles/data.dir/DependInfo.cmake"
+  "src/utest/time/CMakeFiles/time.dir/DependInfo.cmake"
+  "src/utest/astro/CMakeFiles/astro.dir/DependInfo.cmake"
+  "src/utest/fuzzy/CMakeFiles/fuzzy.dir/DependInfo.cmake"
+  "src/utest/evo/CMakeFiles/evo.dir/DependInfo.cmake"
+  "src/utest/nervenet/CMakeFiles/nervenet.dir/DependInfo.cmake"
+  "src/bench/CMakeFiles/bench_callisto.dir/DependInfo.cmake"
+  "src/bench/CMakeFiles/bench.dir/DependInfo.cmake"
+  "src/bench/CMakeFiles/bench_baseline.dir/DependInfo.cmake"
+  "apps/convert/CMakeFiles/convert.dir/DependInfo.cmake"
+  "apps/tictactoe/CMakeFiles/build_table.dir/DependInfo.cmake"
+  "apps/threads/CMakeFiles/test01.dir/DependInfo.cmake"
+  "apps/threads/CMakeFiles/test02.dir/DependInfo.cmake"
+  "apps/PointCloud/CMakeFiles/CompareGKB.dir/DependInfo.cmake"
+  "apps/PointCloud/CMakeFiles/CopyGKB.dir/DependInfo.cmake"
+  "apps/PointCloud/CMakeFiles/DisplayCompare.dir/DependInfo.cmake"
+  "apps/PointCloud/CMakeFiles/DisplayGKBHorizon.dir/DependInfo.cmake"
+  "apps/PointCloud/CMakeFiles/PC2Horizon.dir/DependInfo.cmake"
+  "apps/PointCloud/CMakeFiles/read_gkb.dir/DependInfo.cmake"
+  "apps/PointCloud/CMakeFiles/read_point_cloud.dir/DependInfo.cmake"
+  )
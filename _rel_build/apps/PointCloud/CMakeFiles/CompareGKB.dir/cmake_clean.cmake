@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CompareGKB.dir/CompareGKB.cc.o"
+  "CMakeFiles/CompareGKB.dir/CompareGKB.cc.o.d"
+  "CMakeFiles/CompareGKB.dir/lib/gkb_horiz.cc.o"
+  "CMakeFiles/CompareGKB.dir/lib/gkb_horiz.cc.o.d"
+  "CMakeFiles/CompareGKB.dir/lib/point_cloud.cc.o"
+  "CMakeFiles/CompareGKB.dir/lib/point_cloud.cc.o.d"
+  "CompareGKB"
+  "CompareGKB.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CompareGKB.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CopyGKB.dir/CopyGKB.cc.o"
+  "CMakeFiles/CopyGKB.dir/CopyGKB.cc.o.d"
+  "CMakeFiles/CopyGKB.dir/lib/gkb_horiz.cc.o"
+  "CMakeFiles/CopyGKB.dir/lib/gkb_horiz.cc.o.d"
+  "CMakeFiles/CopyGKB.dir/lib/point_cloud.cc.o"
+  "CMakeFiles/CopyGKB.dir/lib/point_cloud.cc.o.d"
+  "CopyGKB"
+  "CopyGKB.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CopyGKB.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
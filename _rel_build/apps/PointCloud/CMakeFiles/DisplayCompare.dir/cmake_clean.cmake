@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DisplayCompare.dir/DisplayCompare.cc.o"
+  "CMakeFiles/DisplayCompare.dir/DisplayCompare.cc.o.d"
+  "CMakeFiles/DisplayCompare.dir/lib/gkb_horiz.cc.o"
+  "CMakeFiles/DisplayCompare.dir/lib/gkb_horiz.cc.o.d"
+  "CMakeFiles/DisplayCompare.dir/lib/point_cloud.cc.o"
+  "CMakeFiles/DisplayCompare.dir/lib/point_cloud.cc.o.d"
+  "DisplayCompare"
+  "DisplayCompare.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DisplayCompare.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DisplayGKBHorizon.dir/DisplayGKBHorizon.cc.o"
+  "CMakeFiles/DisplayGKBHorizon.dir/DisplayGKBHorizon.cc.o.d"
+  "CMakeFiles/DisplayGKBHorizon.dir/lib/gkb_horiz.cc.o"
+  "CMakeFiles/DisplayGKBHorizon.dir/lib/gkb_horiz.cc.o.d"
+  "CMakeFiles/DisplayGKBHorizon.dir/lib/point_cloud.cc.o"
+  "CMakeFiles/DisplayGKBHorizon.dir/lib/point_cloud.cc.o.d"
+  "DisplayGKBHorizon"
+  "DisplayGKBHorizon.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DisplayGKBHorizon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/apps/PointCloud/PC2Horizon.cc" "apps/PointCloud/CMakeFiles/PC2Horizon.dir/PC2Horizon.cc.o" "gcc" "apps/PointCloud/CMakeFiles/PC2Horizon.dir/PC2Horizon.cc.o.d"
+  "/root/repo/apps/PointCloud/lib/gkb_horiz.cc" "apps/PointCloud/CMakeFiles/PC2Horizon.dir/lib/gkb_horiz.cc.o" "gcc" "apps/PointCloud/CMakeFiles/PC2Horizon.dir/lib/gkb_horiz.cc.o.d"
+  "/root/repo/apps/PointCloud/lib/point_cloud.cc" "apps/PointCloud/CMakeFiles/PC2Horizon.dir/lib/point_cloud.cc.o" "gcc" "apps/PointCloud/CMakeFiles/PC2Horizon.dir/lib/point_cloud.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/callisto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
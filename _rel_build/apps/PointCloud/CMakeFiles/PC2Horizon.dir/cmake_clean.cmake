@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PC2Horizon.dir/PC2Horizon.cc.o"
+  "CMakeFiles/PC2Horizon.dir/PC2Horizon.cc.o.d"
+  "CMakeFiles/PC2Horizon.dir/lib/gkb_horiz.cc.o"
+  "CMakeFiles/PC2Horizon.dir/lib/gkb_horiz.cc.o.d"
+  "CMakeFiles/PC2Horizon.dir/lib/point_cloud.cc.o"
+  "CMakeFiles/PC2Horizon.dir/lib/point_cloud.cc.o.d"
+  "PC2Horizon"
+  "PC2Horizon.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PC2Horizon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
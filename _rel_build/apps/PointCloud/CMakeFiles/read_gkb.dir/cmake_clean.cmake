@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/read_gkb.dir/lib/gkb_horiz.cc.o"
+  "CMakeFiles/read_gkb.dir/lib/gkb_horiz.cc.o.d"
+  "CMakeFiles/read_gkb.dir/lib/point_cloud.cc.o"
+  "CMakeFiles/read_gkb.dir/lib/point_cloud.cc.o.d"
+  "CMakeFiles/read_gkb.dir/read_gkb.cc.o"
+  "CMakeFiles/read_gkb.dir/read_gkb.cc.o.d"
+  "read_gkb"
+  "read_gkb.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/read_gkb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
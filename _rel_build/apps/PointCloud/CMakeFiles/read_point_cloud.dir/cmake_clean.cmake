@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/read_point_cloud.dir/lib/gkb_horiz.cc.o"
+  "CMakeFiles/read_point_cloud.dir/lib/gkb_horiz.cc.o.d"
+  "CMakeFiles/read_point_cloud.dir/lib/point_cloud.cc.o"
+  "CMakeFiles/read_point_cloud.dir/lib/point_cloud.cc.o.d"
+  "CMakeFiles/read_point_cloud.dir/read_point_cloud.cc.o"
+  "CMakeFiles/read_point_cloud.dir/read_point_cloud.cc.o.d"
+  "read_point_cloud"
+  "read_point_cloud.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/read_point_cloud.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/convert.dir/main.cc.o"
+  "CMakeFiles/convert.dir/main.cc.o.d"
+  "convert"
+  "convert.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/convert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
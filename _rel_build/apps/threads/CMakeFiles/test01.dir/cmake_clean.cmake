@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test01.dir/test01.cc.o"
+  "CMakeFiles/test01.dir/test01.cc.o.d"
+  "test01"
+  "test01.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test01.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
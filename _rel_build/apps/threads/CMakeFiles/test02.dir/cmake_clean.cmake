@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test02.dir/test02.cc.o"
+  "CMakeFiles/test02.dir/test02.cc.o.d"
+  "test02"
+  "test02.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test02.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
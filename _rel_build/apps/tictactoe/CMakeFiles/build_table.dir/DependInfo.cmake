@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/apps/tictactoe/build_table.cc" "apps/tictactoe/CMakeFiles/build_table.dir/build_table.cc.o" "gcc" "apps/tictactoe/CMakeFiles/build_table.dir/build_table.cc.o.d"
+  "/root/repo/apps/tictactoe/packed_table.cc" "apps/tictactoe/CMakeFiles/build_table.dir/packed_table.cc.o" "gcc" "apps/tictactoe/CMakeFiles/build_table.dir/packed_table.cc.o.d"
+  "/root/repo/apps/tictactoe/state.cc" "apps/tictactoe/CMakeFiles/build_table.dir/state.cc.o" "gcc" "apps/tictactoe/CMakeFiles/build_table.dir/state.cc.o.d"
+  "/root/repo/apps/tictactoe/state_table.cc" "apps/tictactoe/CMakeFiles/build_table.dir/state_table.cc.o" "gcc" "apps/tictactoe/CMakeFiles/build_table.dir/state_table.cc.o.d"
+  "/root/repo/apps/tictactoe/tictactoe.cc" "apps/tictactoe/CMakeFiles/build_table.dir/tictactoe.cc.o" "gcc" "apps/tictactoe/CMakeFiles/build_table.dir/tictactoe.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/callisto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/build_table.dir/build_table.cc.o"
+  "CMakeFiles/build_table.dir/build_table.cc.o.d"
+  "CMakeFiles/build_table.dir/packed_table.cc.o"
+  "CMakeFiles/build_table.dir/packed_table.cc.o.d"
+  "CMakeFiles/build_table.dir/state.cc.o"
+  "CMakeFiles/build_table.dir/state.cc.o.d"
+  "CMakeFiles/build_table.dir/state_table.cc.o"
+  "CMakeFiles/build_table.dir/state_table.cc.o.d"
+  "CMakeFiles/build_table.dir/tictactoe.cc.o"
+  "CMakeFiles/build_table.dir/tictactoe.cc.o.d"
+  "build_table"
+  "build_table.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/build_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,87 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/source/AbsoluteDate.cc" "src/CMakeFiles/callisto.dir/source/AbsoluteDate.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/AbsoluteDate.cc.o.d"
+  "/root/repo/src/source/AppOptions.cc" "src/CMakeFiles/callisto.dir/source/AppOptions.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/AppOptions.cc.o.d"
+  "/root/repo/src/source/CSVFile.cc" "src/CMakeFiles/callisto.dir/source/CSVFile.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/CSVFile.cc.o.d"
+  "/root/repo/src/source/CSVTable.cc" "src/CMakeFiles/callisto.dir/source/CSVTable.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/CSVTable.cc.o.d"
+  "/root/repo/src/source/ConfigDB.cc" "src/CMakeFiles/callisto.dir/source/ConfigDB.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/ConfigDB.cc.o.d"
+  "/root/repo/src/source/ConfusionMatrix.cc" "src/CMakeFiles/callisto.dir/source/ConfusionMatrix.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/ConfusionMatrix.cc.o.d"
+  "/root/repo/src/source/Counter.cc" "src/CMakeFiles/callisto.dir/source/Counter.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/Counter.cc.o.d"
+  "/root/repo/src/source/DOPRI5.cc" "src/CMakeFiles/callisto.dir/source/DOPRI5.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/DOPRI5.cc.o.d"
+  "/root/repo/src/source/DateComponents.cc" "src/CMakeFiles/callisto.dir/source/DateComponents.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/DateComponents.cc.o.d"
+  "/root/repo/src/source/DateTime.cc" "src/CMakeFiles/callisto.dir/source/DateTime.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/DateTime.cc.o.d"
+  "/root/repo/src/source/Dice.cc" "src/CMakeFiles/callisto.dir/source/Dice.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/Dice.cc.o.d"
+  "/root/repo/src/source/DropOff.cc" "src/CMakeFiles/callisto.dir/source/DropOff.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/DropOff.cc.o.d"
+  "/root/repo/src/source/EigenSystem.cc" "src/CMakeFiles/callisto.dir/source/EigenSystem.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/EigenSystem.cc.o.d"
+  "/root/repo/src/source/Entropy.cc" "src/CMakeFiles/callisto.dir/source/Entropy.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/Entropy.cc.o.d"
+  "/root/repo/src/source/Entropy_XORShift.cc" "src/CMakeFiles/callisto.dir/source/Entropy_XORShift.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/Entropy_XORShift.cc.o.d"
+  "/root/repo/src/source/Exemplar.cc" "src/CMakeFiles/callisto.dir/source/Exemplar.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/Exemplar.cc.o.d"
+  "/root/repo/src/source/FileTool.cc" "src/CMakeFiles/callisto.dir/source/FileTool.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/FileTool.cc.o.d"
+  "/root/repo/src/source/FixedNormal.cc" "src/CMakeFiles/callisto.dir/source/FixedNormal.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/FixedNormal.cc.o.d"
+  "/root/repo/src/source/H5IO.cc" "src/CMakeFiles/callisto.dir/source/H5IO.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/H5IO.cc.o.d"
+  "/root/repo/src/source/ISO8601.cc" "src/CMakeFiles/callisto.dir/source/ISO8601.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/ISO8601.cc.o.d"
+  "/root/repo/src/source/LinAlg.cc" "src/CMakeFiles/callisto.dir/source/LinAlg.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/LinAlg.cc.o.d"
+  "/root/repo/src/source/LinAlg2D.cc" "src/CMakeFiles/callisto.dir/source/LinAlg2D.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/LinAlg2D.cc.o.d"
+  "/root/repo/src/source/LinAlg3D.cc" "src/CMakeFiles/callisto.dir/source/LinAlg3D.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/LinAlg3D.cc.o.d"
+  "/root/repo/src/source/Matrix.cc" "src/CMakeFiles/callisto.dir/source/Matrix.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/Matrix.cc.o.d"
+  "/root/repo/src/source/Matrix2D.cc" "src/CMakeFiles/callisto.dir/source/Matrix2D.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/Matrix2D.cc.o.d"
+  "/root/repo/src/source/Matrix3D.cc" "src/CMakeFiles/callisto.dir/source/Matrix3D.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/Matrix3D.cc.o.d"
+  "/root/repo/src/source/PCA.cc" "src/CMakeFiles/callisto.dir/source/PCA.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/PCA.cc.o.d"
+  "/root/repo/src/source/PSGraph.cc" "src/CMakeFiles/callisto.dir/source/PSGraph.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/PSGraph.cc.o.d"
+  "/root/repo/src/source/ParseTool.cc" "src/CMakeFiles/callisto.dir/source/ParseTool.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/ParseTool.cc.o.d"
+  "/root/repo/src/source/Profiler.cc" "src/CMakeFiles/callisto.dir/source/Profiler.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/Profiler.cc.o.d"
+  "/root/repo/src/source/RK4.cc" "src/CMakeFiles/callisto.dir/source/RK4.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/RK4.cc.o.d"
+  "/root/repo/src/source/RefKDTree.cc" "src/CMakeFiles/callisto.dir/source/RefKDTree.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/RefKDTree.cc.o.d"
+  "/root/repo/src/source/RunStat.cc" "src/CMakeFiles/callisto.dir/source/RunStat.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/RunStat.cc.o.d"
+  "/root/repo/src/source/SThread.cc" "src/CMakeFiles/callisto.dir/source/SThread.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/SThread.cc.o.d"
+  "/root/repo/src/source/Statistics.cc" "src/CMakeFiles/callisto.dir/source/Statistics.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/Statistics.cc.o.d"
+  "/root/repo/src/source/StringTool.cc" "src/CMakeFiles/callisto.dir/source/StringTool.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/StringTool.cc.o.d"
+  "/root/repo/src/source/TLogger.cc" "src/CMakeFiles/callisto.dir/source/TLogger.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/TLogger.cc.o.d"
+  "/root/repo/src/source/Table.cc" "src/CMakeFiles/callisto.dir/source/Table.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/Table.cc.o.d"
+  "/root/repo/src/source/ThreadPool.cc" "src/CMakeFiles/callisto.dir/source/ThreadPool.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/ThreadPool.cc.o.d"
+  "/root/repo/src/source/TimeComponents.cc" "src/CMakeFiles/callisto.dir/source/TimeComponents.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/TimeComponents.cc.o.d"
+  "/root/repo/src/source/VarReal.cc" "src/CMakeFiles/callisto.dir/source/VarReal.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/VarReal.cc.o.d"
+  "/root/repo/src/source/Vector.cc" "src/CMakeFiles/callisto.dir/source/Vector.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/Vector.cc.o.d"
+  "/root/repo/src/source/Vector2D.cc" "src/CMakeFiles/callisto.dir/source/Vector2D.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/Vector2D.cc.o.d"
+  "/root/repo/src/source/Vector3D.cc" "src/CMakeFiles/callisto.dir/source/Vector3D.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/Vector3D.cc.o.d"
+  "/root/repo/src/source/WorldFile.cc" "src/CMakeFiles/callisto.dir/source/WorldFile.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/WorldFile.cc.o.d"
+  "/root/repo/src/source/arrayfunc.cc" "src/CMakeFiles/callisto.dir/source/arrayfunc.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/arrayfunc.cc.o.d"
+  "/root/repo/src/source/astro/Orrey.cc" "src/CMakeFiles/callisto.dir/source/astro/Orrey.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/astro/Orrey.cc.o.d"
+  "/root/repo/src/source/c2darray.cc" "src/CMakeFiles/callisto.dir/source/c2darray.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/c2darray.cc.o.d"
+  "/root/repo/src/source/copy_clone.cc" "src/CMakeFiles/callisto.dir/source/copy_clone.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/copy_clone.cc.o.d"
+  "/root/repo/src/source/evo/Encoding.cc" "src/CMakeFiles/callisto.dir/source/evo/Encoding.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/evo/Encoding.cc.o.d"
+  "/root/repo/src/source/evo/Metric.cc" "src/CMakeFiles/callisto.dir/source/evo/Metric.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/evo/Metric.cc.o.d"
+  "/root/repo/src/source/evo/Population.cc" "src/CMakeFiles/callisto.dir/source/evo/Population.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/evo/Population.cc.o.d"
+  "/root/repo/src/source/evo/RealEncoding.cc" "src/CMakeFiles/callisto.dir/source/evo/RealEncoding.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/evo/RealEncoding.cc.o.d"
+  "/root/repo/src/source/evo/ToolKit.cc" "src/CMakeFiles/callisto.dir/source/evo/ToolKit.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/evo/ToolKit.cc.o.d"
+  "/root/repo/src/source/fuzzy/Group.cc" "src/CMakeFiles/callisto.dir/source/fuzzy/Group.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/fuzzy/Group.cc.o.d"
+  "/root/repo/src/source/fuzzy/Kernel.cc" "src/CMakeFiles/callisto.dir/source/fuzzy/Kernel.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/fuzzy/Kernel.cc.o.d"
+  "/root/repo/src/source/fuzzy/LeftTrapezoidSet.cc" "src/CMakeFiles/callisto.dir/source/fuzzy/LeftTrapezoidSet.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/fuzzy/LeftTrapezoidSet.cc.o.d"
+  "/root/repo/src/source/fuzzy/Partition.cc" "src/CMakeFiles/callisto.dir/source/fuzzy/Partition.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/fuzzy/Partition.cc.o.d"
+  "/root/repo/src/source/fuzzy/RightTrapezoidSet.cc" "src/CMakeFiles/callisto.dir/source/fuzzy/RightTrapezoidSet.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/fuzzy/RightTrapezoidSet.cc.o.d"
+  "/root/repo/src/source/fuzzy/RuleBase.cc" "src/CMakeFiles/callisto.dir/source/fuzzy/RuleBase.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/fuzzy/RuleBase.cc.o.d"
+  "/root/repo/src/source/fuzzy/Set.cc" "src/CMakeFiles/callisto.dir/source/fuzzy/Set.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/fuzzy/Set.cc.o.d"
+  "/root/repo/src/source/fuzzy/TriangleSet.cc" "src/CMakeFiles/callisto.dir/source/fuzzy/TriangleSet.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/fuzzy/TriangleSet.cc.o.d"
+  "/root/repo/src/source/mathdef.cc" "src/CMakeFiles/callisto.dir/source/mathdef.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/mathdef.cc.o.d"
+  "/root/repo/src/source/nns/activate.cc" "src/CMakeFiles/callisto.dir/source/nns/activate.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/nns/activate.cc.o.d"
+  "/root/repo/src/source/nns/cost.cc" "src/CMakeFiles/callisto.dir/source/nns/cost.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/nns/cost.cc.o.d"
+  "/root/repo/src/source/nns/ffnn.cc" "src/CMakeFiles/callisto.dir/source/nns/ffnn.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/nns/ffnn.cc.o.d"
+  "/root/repo/src/source/nns/layer.cc" "src/CMakeFiles/callisto.dir/source/nns/layer.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/nns/layer.cc.o.d"
+  "/root/repo/src/source/summation.cc" "src/CMakeFiles/callisto.dir/source/summation.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/summation.cc.o.d"
+  "/root/repo/src/source/trncmp.cc" "src/CMakeFiles/callisto.dir/source/trncmp.cc.o" "gcc" "src/CMakeFiles/callisto.dir/source/trncmp.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,147 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/callisto.dir/source/AbsoluteDate.cc.o"
+  "CMakeFiles/callisto.dir/source/AbsoluteDate.cc.o.d"
+  "CMakeFiles/callisto.dir/source/AppOptions.cc.o"
+  "CMakeFiles/callisto.dir/source/AppOptions.cc.o.d"
+  "CMakeFiles/callisto.dir/source/CSVFile.cc.o"
+  "CMakeFiles/callisto.dir/source/CSVFile.cc.o.d"
+  "CMakeFiles/callisto.dir/source/CSVTable.cc.o"
+  "CMakeFiles/callisto.dir/source/CSVTable.cc.o.d"
+  "CMakeFiles/callisto.dir/source/ConfigDB.cc.o"
+  "CMakeFiles/callisto.dir/source/ConfigDB.cc.o.d"
+  "CMakeFiles/callisto.dir/source/ConfusionMatrix.cc.o"
+  "CMakeFiles/callisto.dir/source/ConfusionMatrix.cc.o.d"
+  "CMakeFiles/callisto.dir/source/Counter.cc.o"
+  "CMakeFiles/callisto.dir/source/Counter.cc.o.d"
+  "CMakeFiles/callisto.dir/source/DOPRI5.cc.o"
+  "CMakeFiles/callisto.dir/source/DOPRI5.cc.o.d"
+  "CMakeFiles/callisto.dir/source/DateComponents.cc.o"
+  "CMakeFiles/callisto.dir/source/DateComponents.cc.o.d"
+  "CMakeFiles/callisto.dir/source/DateTime.cc.o"
+  "CMakeFiles/callisto.dir/source/DateTime.cc.o.d"
+  "CMakeFiles/callisto.dir/source/Dice.cc.o"
+  "CMakeFiles/callisto.dir/source/Dice.cc.o.d"
+  "CMakeFiles/callisto.dir/source/DropOff.cc.o"
+  "CMakeFiles/callisto.dir/source/DropOff.cc.o.d"
+  "CMakeFiles/callisto.dir/source/EigenSystem.cc.o"
+  "CMakeFiles/callisto.dir/source/EigenSystem.cc.o.d"
+  "CMakeFiles/callisto.dir/source/Entropy.cc.o"
+  "CMakeFiles/callisto.dir/source/Entropy.cc.o.d"
+  "CMakeFiles/callisto.dir/source/Entropy_XORShift.cc.o"
+  "CMakeFiles/callisto.dir/source/Entropy_XORShift.cc.o.d"
+  "CMakeFiles/callisto.dir/source/Exemplar.cc.o"
+  "CMakeFiles/callisto.dir/source/Exemplar.cc.o.d"
+  "CMakeFiles/callisto.dir/source/FileTool.cc.o"
+  "CMakeFiles/callisto.dir/source/FileTool.cc.o.d"
+  "CMakeFiles/callisto.dir/source/FixedNormal.cc.o"
+  "CMakeFiles/callisto.dir/source/FixedNormal.cc.o.d"
+  "CMakeFiles/callisto.dir/source/H5IO.cc.o"
+  "CMakeFiles/callisto.dir/source/H5IO.cc.o.d"
+  "CMakeFiles/callisto.dir/source/ISO8601.cc.o"
+  "CMakeFiles/callisto.dir/source/ISO8601.cc.o.d"
+  "CMakeFiles/callisto.dir/source/LinAlg.cc.o"
+  "CMakeFiles/callisto.dir/source/LinAlg.cc.o.d"
+  "CMakeFiles/callisto.dir/source/LinAlg2D.cc.o"
+  "CMakeFiles/callisto.dir/source/LinAlg2D.cc.o.d"
+  "CMakeFiles/callisto.dir/source/LinAlg3D.cc.o"
+  "CMakeFiles/callisto.dir/source/LinAlg3D.cc.o.d"
+  "CMakeFiles/callisto.dir/source/Matrix.cc.o"
+  "CMakeFiles/callisto.dir/source/Matrix.cc.o.d"
+  "CMakeFiles/callisto.dir/source/Matrix2D.cc.o"
+  "CMakeFiles/callisto.dir/source/Matrix2D.cc.o.d"
+  "CMakeFiles/callisto.dir/source/Matrix3D.cc.o"
+  "CMakeFiles/callisto.dir/source/Matrix3D.cc.o.d"
+  "CMakeFiles/callisto.dir/source/PCA.cc.o"
+  "CMakeFiles/callisto.dir/source/PCA.cc.o.d"
+  "CMakeFiles/callisto.dir/source/PSGraph.cc.o"
+  "CMakeFiles/callisto.dir/source/PSGraph.cc.o.d"
+  "CMakeFiles/callisto.dir/source/ParseTool.cc.o"
+  "CMakeFiles/callisto.dir/source/ParseTool.cc.o.d"
+  "CMakeFiles/callisto.dir/source/Profiler.cc.o"
+  "CMakeFiles/callisto.dir/source/Profiler.cc.o.d"
+  "CMakeFiles/callisto.dir/source/RK4.cc.o"
+  "CMakeFiles/callisto.dir/source/RK4.cc.o.d"
+  "CMakeFiles/callisto.dir/source/RefKDTree.cc.o"
+  "CMakeFiles/callisto.dir/source/RefKDTree.cc.o.d"
+  "CMakeFiles/callisto.dir/source/RunStat.cc.o"
+  "CMakeFiles/callisto.dir/source/RunStat.cc.o.d"
+  "CMakeFiles/callisto.dir/source/SThread.cc.o"
+  "CMakeFiles/callisto.dir/source/SThread.cc.o.d"
+  "CMakeFiles/callisto.dir/source/Statistics.cc.o"
+  "CMakeFiles/callisto.dir/source/Statistics.cc.o.d"
+  "CMakeFiles/callisto.dir/source/StringTool.cc.o"
+  "CMakeFiles/callisto.dir/source/StringTool.cc.o.d"
+  "CMakeFiles/callisto.dir/source/TLogger.cc.o"
+  "CMakeFiles/callisto.dir/source/TLogger.cc.o.d"
+  "CMakeFiles/callisto.dir/source/Table.cc.o"
+  "CMakeFiles/callisto.dir/source/Table.cc.o.d"
+  "CMakeFiles/callisto.dir/source/ThreadPool.cc.o"
+  "CMakeFiles/callisto.dir/source/ThreadPool.cc.o.d"
+  "CMakeFiles/callisto.dir/source/TimeComponents.cc.o"
+  "CMakeFiles/callisto.dir/source/TimeComponents.cc.o.d"
+  "CMakeFiles/callisto.dir/source/VarReal.cc.o"
+  "CMakeFiles/callisto.dir/source/VarReal.cc.o.d"
+  "CMakeFiles/callisto.dir/source/Vector.cc.o"
+  "CMakeFiles/callisto.dir/source/Vector.cc.o.d"
+  "CMakeFiles/callisto.dir/source/Vector2D.cc.o"
+  "CMakeFiles/callisto.dir/source/Vector2D.cc.o.d"
+  "CMakeFiles/callisto.dir/source/Vector3D.cc.o"
+  "CMakeFiles/callisto.dir/source/Vector3D.cc.o.d"
+  "CMakeFiles/callisto.dir/source/WorldFile.cc.o"
+  "CMakeFiles/callisto.dir/source/WorldFile.cc.o.d"
+  "CMakeFiles/callisto.dir/source/arrayfunc.cc.o"
+  "CMakeFiles/callisto.dir/source/arrayfunc.cc.o.d"
+  "CMakeFiles/callisto.dir/source/astro/Orrey.cc.o"
+  "CMakeFiles/callisto.dir/source/astro/Orrey.cc.o.d"
+  "CMakeFiles/callisto.dir/source/c2darray.cc.o"
+  "CMakeFiles/callisto.dir/source/c2darray.cc.o.d"
+  "CMakeFiles/callisto.dir/source/copy_clone.cc.o"
+  "CMakeFiles/callisto.dir/source/copy_clone.cc.o.d"
+  "CMakeFiles/callisto.dir/source/evo/Encoding.cc.o"
+  "CMakeFiles/callisto.dir/source/evo/Encoding.cc.o.d"
+  "CMakeFiles/callisto.dir/source/evo/Metric.cc.o"
+  "CMakeFiles/callisto.dir/source/evo/Metric.cc.o.d"
+  "CMakeFiles/callisto.dir/source/evo/Population.cc.o"
+  "CMakeFiles/callisto.dir/source/evo/Population.cc.o.d"
+  "CMakeFiles/callisto.dir/source/evo/RealEncoding.cc.o"
+  "CMakeFiles/callisto.dir/source/evo/RealEncoding.cc.o.d"
+  "CMakeFiles/callisto.dir/source/evo/ToolKit.cc.o"
+  "CMakeFiles/callisto.dir/source/evo/ToolKit.cc.o.d"
+  "CMakeFiles/callisto.dir/source/fuzzy/Group.cc.o"
+  "CMakeFiles/callisto.dir/source/fuzzy/Group.cc.o.d"
+  "CMakeFiles/callisto.dir/source/fuzzy/Kernel.cc.o"
+  "CMakeFiles/callisto.dir/source/fuzzy/Kernel.cc.o.d"
+  "CMakeFiles/callisto.dir/source/fuzzy/LeftTrapezoidSet.cc.o"
+  "CMakeFiles/callisto.dir/source/fuzzy/LeftTrapezoidSet.cc.o.d"
+  "CMakeFiles/callisto.dir/source/fuzzy/Partition.cc.o"
+  "CMakeFiles/callisto.dir/source/fuzzy/Partition.cc.o.d"
+  "CMakeFiles/callisto.dir/source/fuzzy/RightTrapezoidSet.cc.o"
+  "CMakeFiles/callisto.dir/source/fuzzy/RightTrapezoidSet.cc.o.d"
+  "CMakeFiles/callisto.dir/source/fuzzy/RuleBase.cc.o"
+  "CMakeFiles/callisto.dir/source/fuzzy/RuleBase.cc.o.d"
+  "CMakeFiles/callisto.dir/source/fuzzy/Set.cc.o"
+  "CMakeFiles/callisto.dir/source/fuzzy/Set.cc.o.d"
+  "CMakeFiles/callisto.dir/source/fuzzy/TriangleSet.cc.o"
+  "CMakeFiles/callisto.dir/source/fuzzy/TriangleSet.cc.o.d"
+  "CMakeFiles/callisto.dir/source/mathdef.cc.o"
+  "CMakeFiles/callisto.dir/source/mathdef.cc.o.d"
+  "CMakeFiles/callisto.dir/source/nns/activate.cc.o"
+  "CMakeFiles/callisto.dir/source/nns/activate.cc.o.d"
+  "CMakeFiles/callisto.dir/source/nns/cost.cc.o"
+  "CMakeFiles/callisto.dir/source/nns/cost.cc.o.d"
+  "CMakeFiles/callisto.dir/source/nns/ffnn.cc.o"
+  "CMakeFiles/callisto.dir/source/nns/ffnn.cc.o.d"
+  "CMakeFiles/callisto.dir/source/nns/layer.cc.o"
+  "CMakeFiles/callisto.dir/source/nns/layer.cc.o.d"
+  "CMakeFiles/callisto.dir/source/summation.cc.o"
+  "CMakeFiles/callisto.dir/source/summation.cc.o.d"
+  "CMakeFiles/callisto.dir/source/trncmp.cc.o"
+  "CMakeFiles/callisto.dir/source/trncmp.cc.o.d"
+  "libcallisto.a"
+  "libcallisto.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/callisto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
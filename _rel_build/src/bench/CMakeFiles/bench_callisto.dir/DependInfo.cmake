@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/bench/bench.cc" "src/bench/CMakeFiles/bench_callisto.dir/bench.cc.o" "gcc" "src/bench/CMakeFiles/bench_callisto.dir/bench.cc.o.d"
+  "/root/repo/src/bench/bench_kernels.cc" "src/bench/CMakeFiles/bench_callisto.dir/bench_kernels.cc.o" "gcc" "src/bench/CMakeFiles/bench_callisto.dir/bench_kernels.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/callisto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
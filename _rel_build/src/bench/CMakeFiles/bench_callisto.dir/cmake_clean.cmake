@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_callisto.dir/bench.cc.o"
+  "CMakeFiles/bench_callisto.dir/bench.cc.o.d"
+  "CMakeFiles/bench_callisto.dir/bench_kernels.cc.o"
+  "CMakeFiles/bench_callisto.dir/bench_kernels.cc.o.d"
+  "bench_callisto"
+  "bench_callisto.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_callisto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,146 @@
+# Install script for directory: /root/repo/src
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/root/repo/_rel_build/callisto")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RELEASE")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for the subdirectory.
+  include("/root/repo/_rel_build/src/ctest/cmake_install.cmake")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for the subdirectory.
+  include("/root/repo/_rel_build/src/utest/cmake_install.cmake")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for the subdirectory.
+  include("/root/repo/_rel_build/src/bench/cmake_install.cmake")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_rel_build/src/libcallisto.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include" TYPE FILE FILES
+    "/root/repo/src/include/AbsoluteDate.hh"
+    "/root/repo/src/include/AppOptions.hh"
+    "/root/repo/src/include/Array.hh"
+    "/root/repo/src/include/CSVFile.hh"
+    "/root/repo/src/include/CSVTable.hh"
+    "/root/repo/src/include/ConfigDB.hh"
+    "/root/repo/src/include/ConfusionMatrix.hh"
+    "/root/repo/src/include/Counter.hh"
+    "/root/repo/src/include/DOPRI5.hh"
+    "/root/repo/src/include/DateComponents.hh"
+    "/root/repo/src/include/DateTime.hh"
+    "/root/repo/src/include/Dice.hh"
+    "/root/repo/src/include/DropOff.hh"
+    "/root/repo/src/include/EigenSystem.hh"
+    "/root/repo/src/include/Entropy.hh"
+    "/root/repo/src/include/Entropy_XORShift.hh"
+    "/root/repo/src/include/Exemplar.hh"
+    "/root/repo/src/include/FileTool.hh"
+    "/root/repo/src/include/FixedNormal.hh"
+    "/root/repo/src/include/H5IO.hh"
+    "/root/repo/src/include/ISO8601.hh"
+    "/root/repo/src/include/LinAlg.hh"
+    "/root/repo/src/include/LinAlg2D.hh"
+    "/root/repo/src/include/LinAlg3D.hh"
+    "/root/repo/src/include/Matrix.hh"
+    "/root/repo/src/include/Matrix2D.hh"
+    "/root/repo/src/include/Matrix3D.hh"
+    "/root/repo/src/include/PCA.hh"
+    "/root/repo/src/include/PSGraph.hh"
+    "/root/repo/src/include/ParseTool.hh"
+    "/root/repo/src/include/Pipeline.hh"
+    "/root/repo/src/include/Profiler.hh"
+    "/root/repo/src/include/RK4.hh"
+    "/root/repo/src/include/RefKDTree.hh"
+    "/root/repo/src/include/RunStat.hh"
+    "/root/repo/src/include/SQueue.hh"
+    "/root/repo/src/include/SThread.hh"
+    "/root/repo/src/include/Statistics.hh"
+    "/root/repo/src/include/StopWatch.hh"
+    "/root/repo/src/include/StringTool.hh"
+    "/root/repo/src/include/TLogger.hh"
+    "/root/repo/src/include/Table.hh"
+    "/root/repo/src/include/ThreadPool.hh"
+    "/root/repo/src/include/TimeComponents.hh"
+    "/root/repo/src/include/VarReal.hh"
+    "/root/repo/src/include/Vector.hh"
+    "/root/repo/src/include/Vector2D.hh"
+    "/root/repo/src/include/Vector3D.hh"
+    "/root/repo/src/include/WorldFile.hh"
+    "/root/repo/src/include/array_print.hh"
+    "/root/repo/src/include/arrayfunc.hh"
+    "/root/repo/src/include/astro/OrbitBody.hh"
+    "/root/repo/src/include/astro/Orrey.hh"
+    "/root/repo/src/include/blas_interface.hh"
+    "/root/repo/src/include/c2darray.hh"
+    "/root/repo/src/include/copy_clone.hh"
+    "/root/repo/src/include/evo/Encoding.hh"
+    "/root/repo/src/include/evo/Metric.hh"
+    "/root/repo/src/include/evo/Model.hh"
+    "/root/repo/src/include/evo/Population.hh"
+    "/root/repo/src/include/evo/RealEncoding.hh"
+    "/root/repo/src/include/evo/ToolKit.hh"
+    "/root/repo/src/include/fuzzy/Group.hh"
+    "/root/repo/src/include/fuzzy/Kernel.hh"
+    "/root/repo/src/include/fuzzy/LeftTrapezoidSet.hh"
+    "/root/repo/src/include/fuzzy/Partition.hh"
+    "/root/repo/src/include/fuzzy/RightTrapezoidSet.hh"
+    "/root/repo/src/include/fuzzy/RuleBase.hh"
+    "/root/repo/src/include/fuzzy/Set.hh"
+    "/root/repo/src/include/fuzzy/TriangleSet.hh"
+    "/root/repo/src/include/lapack_interface.hh"
+    "/root/repo/src/include/mathdef.hh"
+    "/root/repo/src/include/nns/activate.hh"
+    "/root/repo/src/include/nns/cost.hh"
+    "/root/repo/src/include/nns/ffnn.hh"
+    "/root/repo/src/include/nns/layer.hh"
+    "/root/repo/src/include/summation.hh"
+    "/root/repo/src/include/trncmp.hh"
+    )
+endif()
+
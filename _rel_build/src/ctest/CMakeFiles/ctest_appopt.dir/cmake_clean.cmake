@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_appopt.dir/ctest_appopt.cc.o"
+  "CMakeFiles/ctest_appopt.dir/ctest_appopt.cc.o.d"
+  "ctest_appopt"
+  "ctest_appopt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_appopt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_blas.dir/ctest_blas.cc.o"
+  "CMakeFiles/ctest_blas.dir/ctest_blas.cc.o.d"
+  "ctest_blas"
+  "ctest_blas.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_blas.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
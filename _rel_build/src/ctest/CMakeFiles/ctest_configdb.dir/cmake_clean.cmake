@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_configdb.dir/ctest_configdb.cc.o"
+  "CMakeFiles/ctest_configdb.dir/ctest_configdb.cc.o.d"
+  "ctest_configdb"
+  "ctest_configdb.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_configdb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
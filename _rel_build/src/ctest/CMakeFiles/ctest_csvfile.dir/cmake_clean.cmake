@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_csvfile.dir/ctest_csvfile.cc.o"
+  "CMakeFiles/ctest_csvfile.dir/ctest_csvfile.cc.o.d"
+  "ctest_csvfile"
+  "ctest_csvfile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_csvfile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_datetime.dir/ctest_datetime.cc.o"
+  "CMakeFiles/ctest_datetime.dir/ctest_datetime.cc.o.d"
+  "ctest_datetime"
+  "ctest_datetime.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_datetime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_dropoff.dir/ctest_dropoff.cc.o"
+  "CMakeFiles/ctest_dropoff.dir/ctest_dropoff.cc.o.d"
+  "ctest_dropoff"
+  "ctest_dropoff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_dropoff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
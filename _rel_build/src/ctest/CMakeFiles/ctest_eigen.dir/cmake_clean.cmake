@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_eigen.dir/ctest_eigen.cc.o"
+  "CMakeFiles/ctest_eigen.dir/ctest_eigen.cc.o.d"
+  "ctest_eigen"
+  "ctest_eigen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_eigen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_entropy.dir/ctest_entropy.cc.o"
+  "CMakeFiles/ctest_entropy.dir/ctest_entropy.cc.o.d"
+  "ctest_entropy"
+  "ctest_entropy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_entropy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
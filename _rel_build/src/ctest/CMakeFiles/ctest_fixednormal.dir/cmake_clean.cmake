@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_fixednormal.dir/ctest_fixednormal.cc.o"
+  "CMakeFiles/ctest_fixednormal.dir/ctest_fixednormal.cc.o.d"
+  "ctest_fixednormal"
+  "ctest_fixednormal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_fixednormal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_integrate.dir/ctest_integrate.cc.o"
+  "CMakeFiles/ctest_integrate.dir/ctest_integrate.cc.o.d"
+  "ctest_integrate"
+  "ctest_integrate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_integrate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_lapack.dir/ctest_lapack.cc.o"
+  "CMakeFiles/ctest_lapack.dir/ctest_lapack.cc.o.d"
+  "ctest_lapack"
+  "ctest_lapack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_lapack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_psgraph.dir/ctest_psgraph.cc.o"
+  "CMakeFiles/ctest_psgraph.dir/ctest_psgraph.cc.o.d"
+  "ctest_psgraph"
+  "ctest_psgraph.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_psgraph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_refkdtree.dir/ctest_refkdtree.cc.o"
+  "CMakeFiles/ctest_refkdtree.dir/ctest_refkdtree.cc.o.d"
+  "ctest_refkdtree"
+  "ctest_refkdtree.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_refkdtree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_rk4.dir/ctest_rk4.cc.o"
+  "CMakeFiles/ctest_rk4.dir/ctest_rk4.cc.o.d"
+  "ctest_rk4"
+  "ctest_rk4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_rk4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_shuffle.dir/ctest_shuffle.cc.o"
+  "CMakeFiles/ctest_shuffle.dir/ctest_shuffle.cc.o.d"
+  "ctest_shuffle"
+  "ctest_shuffle.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_shuffle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
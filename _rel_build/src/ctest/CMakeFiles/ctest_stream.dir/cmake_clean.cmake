@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_stream.dir/ctest_stream.cc.o"
+  "CMakeFiles/ctest_stream.dir/ctest_stream.cc.o.d"
+  "ctest_stream"
+  "ctest_stream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_thread.dir/ctest_thread.cc.o"
+  "CMakeFiles/ctest_thread.dir/ctest_thread.cc.o.d"
+  "ctest_thread"
+  "ctest_thread.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_thread.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_tlogger.dir/ctest_tlogger.cc.o"
+  "CMakeFiles/ctest_tlogger.dir/ctest_tlogger.cc.o.d"
+  "ctest_tlogger"
+  "ctest_tlogger.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_tlogger.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_version.dir/ctest_version.cc.o"
+  "CMakeFiles/ctest_version.dir/ctest_version.cc.o.d"
+  "ctest_version"
+  "ctest_version.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_version.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
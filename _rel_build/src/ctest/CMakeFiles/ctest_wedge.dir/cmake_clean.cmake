@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctest_wedge.dir/ctest_wedge.cc.o"
+  "CMakeFiles/ctest_wedge.dir/ctest_wedge.cc.o.d"
+  "ctest_wedge"
+  "ctest_wedge.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest_wedge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arrays.dir/__/main.cc.o"
+  "CMakeFiles/arrays.dir/__/main.cc.o.d"
+  "CMakeFiles/arrays.dir/utest_arrayfunc.cc.o"
+  "CMakeFiles/arrays.dir/utest_arrayfunc.cc.o.d"
+  "CMakeFiles/arrays.dir/utest_copyclone.cc.o"
+  "CMakeFiles/arrays.dir/utest_copyclone.cc.o.d"
+  "CMakeFiles/arrays.dir/utest_summation.cc.o"
+  "CMakeFiles/arrays.dir/utest_summation.cc.o.d"
+  "arrays"
+  "arrays.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arrays.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
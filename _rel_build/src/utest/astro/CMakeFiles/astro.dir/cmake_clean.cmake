@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/astro.dir/__/main.cc.o"
+  "CMakeFiles/astro.dir/__/main.cc.o.d"
+  "CMakeFiles/astro.dir/utest_orrey.cc.o"
+  "CMakeFiles/astro.dir/utest_orrey.cc.o.d"
+  "astro"
+  "astro.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/astro.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
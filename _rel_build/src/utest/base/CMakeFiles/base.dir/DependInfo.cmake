@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/utest/main.cc" "src/utest/base/CMakeFiles/base.dir/__/main.cc.o" "gcc" "src/utest/base/CMakeFiles/base.dir/__/main.cc.o.d"
+  "/root/repo/src/utest/base/utest_author.cc" "src/utest/base/CMakeFiles/base.dir/utest_author.cc.o" "gcc" "src/utest/base/CMakeFiles/base.dir/utest_author.cc.o.d"
+  "/root/repo/src/utest/base/utest_dopri5.cc" "src/utest/base/CMakeFiles/base.dir/utest_dopri5.cc.o" "gcc" "src/utest/base/CMakeFiles/base.dir/utest_dopri5.cc.o.d"
+  "/root/repo/src/utest/base/utest_mathdef.cc" "src/utest/base/CMakeFiles/base.dir/utest_mathdef.cc.o" "gcc" "src/utest/base/CMakeFiles/base.dir/utest_mathdef.cc.o.d"
+  "/root/repo/src/utest/base/utest_mathdef_inline.cc" "src/utest/base/CMakeFiles/base.dir/utest_mathdef_inline.cc.o" "gcc" "src/utest/base/CMakeFiles/base.dir/utest_mathdef_inline.cc.o.d"
+  "/root/repo/src/utest/base/utest_profiler.cc" "src/utest/base/CMakeFiles/base.dir/utest_profiler.cc.o" "gcc" "src/utest/base/CMakeFiles/base.dir/utest_profiler.cc.o.d"
+  "/root/repo/src/utest/base/utest_squeue.cc" "src/utest/base/CMakeFiles/base.dir/utest_squeue.cc.o" "gcc" "src/utest/base/CMakeFiles/base.dir/utest_squeue.cc.o.d"
+  "/root/repo/src/utest/base/utest_threadpool.cc" "src/utest/base/CMakeFiles/base.dir/utest_threadpool.cc.o" "gcc" "src/utest/base/CMakeFiles/base.dir/utest_threadpool.cc.o.d"
+  "/root/repo/src/utest/base/utest_tlogger.cc" "src/utest/base/CMakeFiles/base.dir/utest_tlogger.cc.o" "gcc" "src/utest/base/CMakeFiles/base.dir/utest_tlogger.cc.o.d"
+  "/root/repo/src/utest/base/utest_version.cc" "src/utest/base/CMakeFiles/base.dir/utest_version.cc.o" "gcc" "src/utest/base/CMakeFiles/base.dir/utest_version.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/callisto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/base.dir/__/main.cc.o"
+  "CMakeFiles/base.dir/__/main.cc.o.d"
+  "CMakeFiles/base.dir/utest_author.cc.o"
+  "CMakeFiles/base.dir/utest_author.cc.o.d"
+  "CMakeFiles/base.dir/utest_dopri5.cc.o"
+  "CMakeFiles/base.dir/utest_dopri5.cc.o.d"
+  "CMakeFiles/base.dir/utest_mathdef.cc.o"
+  "CMakeFiles/base.dir/utest_mathdef.cc.o.d"
+  "CMakeFiles/base.dir/utest_mathdef_inline.cc.o"
+  "CMakeFiles/base.dir/utest_mathdef_inline.cc.o.d"
+  "CMakeFiles/base.dir/utest_profiler.cc.o"
+  "CMakeFiles/base.dir/utest_profiler.cc.o.d"
+  "CMakeFiles/base.dir/utest_squeue.cc.o"
+  "CMakeFiles/base.dir/utest_squeue.cc.o.d"
+  "CMakeFiles/base.dir/utest_threadpool.cc.o"
+  "CMakeFiles/base.dir/utest_threadpool.cc.o.d"
+  "CMakeFiles/base.dir/utest_tlogger.cc.o"
+  "CMakeFiles/base.dir/utest_tlogger.cc.o.d"
+  "CMakeFiles/base.dir/utest_version.cc.o"
+  "CMakeFiles/base.dir/utest_version.cc.o.d"
+  "base"
+  "base.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
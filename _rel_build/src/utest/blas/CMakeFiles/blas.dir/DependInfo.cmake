@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/utest/main.cc" "src/utest/blas/CMakeFiles/blas.dir/__/main.cc.o" "gcc" "src/utest/blas/CMakeFiles/blas.dir/__/main.cc.o.d"
+  "/root/repo/src/utest/blas/utest_linalg.cc" "src/utest/blas/CMakeFiles/blas.dir/utest_linalg.cc.o" "gcc" "src/utest/blas/CMakeFiles/blas.dir/utest_linalg.cc.o.d"
+  "/root/repo/src/utest/blas/utest_matrix.cc" "src/utest/blas/CMakeFiles/blas.dir/utest_matrix.cc.o" "gcc" "src/utest/blas/CMakeFiles/blas.dir/utest_matrix.cc.o.d"
+  "/root/repo/src/utest/blas/utest_vector.cc" "src/utest/blas/CMakeFiles/blas.dir/utest_vector.cc.o" "gcc" "src/utest/blas/CMakeFiles/blas.dir/utest_vector.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/callisto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/blas.dir/__/main.cc.o"
+  "CMakeFiles/blas.dir/__/main.cc.o.d"
+  "CMakeFiles/blas.dir/utest_linalg.cc.o"
+  "CMakeFiles/blas.dir/utest_linalg.cc.o.d"
+  "CMakeFiles/blas.dir/utest_matrix.cc.o"
+  "CMakeFiles/blas.dir/utest_matrix.cc.o.d"
+  "CMakeFiles/blas.dir/utest_vector.cc.o"
+  "CMakeFiles/blas.dir/utest_vector.cc.o.d"
+  "blas"
+  "blas.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/blas.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
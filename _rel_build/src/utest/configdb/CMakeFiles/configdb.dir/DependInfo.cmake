@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/utest/main.cc" "src/utest/configdb/CMakeFiles/configdb.dir/__/main.cc.o" "gcc" "src/utest/configdb/CMakeFiles/configdb.dir/__/main.cc.o.d"
+  "/root/repo/src/utest/configdb/utest_comment.cc" "src/utest/configdb/CMakeFiles/configdb.dir/utest_comment.cc.o" "gcc" "src/utest/configdb/CMakeFiles/configdb.dir/utest_comment.cc.o.d"
+  "/root/repo/src/utest/configdb/utest_config.cc" "src/utest/configdb/CMakeFiles/configdb.dir/utest_config.cc.o" "gcc" "src/utest/configdb/CMakeFiles/configdb.dir/utest_config.cc.o.d"
+  "/root/repo/src/utest/configdb/utest_entry.cc" "src/utest/configdb/CMakeFiles/configdb.dir/utest_entry.cc.o" "gcc" "src/utest/configdb/CMakeFiles/configdb.dir/utest_entry.cc.o.d"
+  "/root/repo/src/utest/configdb/utest_section.cc" "src/utest/configdb/CMakeFiles/configdb.dir/utest_section.cc.o" "gcc" "src/utest/configdb/CMakeFiles/configdb.dir/utest_section.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/callisto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/configdb.dir/__/main.cc.o"
+  "CMakeFiles/configdb.dir/__/main.cc.o.d"
+  "CMakeFiles/configdb.dir/utest_comment.cc.o"
+  "CMakeFiles/configdb.dir/utest_comment.cc.o.d"
+  "CMakeFiles/configdb.dir/utest_config.cc.o"
+  "CMakeFiles/configdb.dir/utest_config.cc.o.d"
+  "CMakeFiles/configdb.dir/utest_entry.cc.o"
+  "CMakeFiles/configdb.dir/utest_entry.cc.o.d"
+  "CMakeFiles/configdb.dir/utest_section.cc.o"
+  "CMakeFiles/configdb.dir/utest_section.cc.o.d"
+  "configdb"
+  "configdb.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/configdb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/utest/main.cc" "src/utest/data/CMakeFiles/data.dir/__/main.cc.o" "gcc" "src/utest/data/CMakeFiles/data.dir/__/main.cc.o.d"
+  "/root/repo/src/utest/data/utest_array.cc" "src/utest/data/CMakeFiles/data.dir/utest_array.cc.o" "gcc" "src/utest/data/CMakeFiles/data.dir/utest_array.cc.o.d"
+  "/root/repo/src/utest/data/utest_csvtable.cc" "src/utest/data/CMakeFiles/data.dir/utest_csvtable.cc.o" "gcc" "src/utest/data/CMakeFiles/data.dir/utest_csvtable.cc.o.d"
+  "/root/repo/src/utest/data/utest_exemplar.cc" "src/utest/data/CMakeFiles/data.dir/utest_exemplar.cc.o" "gcc" "src/utest/data/CMakeFiles/data.dir/utest_exemplar.cc.o.d"
+  "/root/repo/src/utest/data/utest_h5io.cc" "src/utest/data/CMakeFiles/data.dir/utest_h5io.cc.o" "gcc" "src/utest/data/CMakeFiles/data.dir/utest_h5io.cc.o.d"
+  "/root/repo/src/utest/data/utest_parsetool.cc" "src/utest/data/CMakeFiles/data.dir/utest_parsetool.cc.o" "gcc" "src/utest/data/CMakeFiles/data.dir/utest_parsetool.cc.o.d"
+  "/root/repo/src/utest/data/utest_stats.cc" "src/utest/data/CMakeFiles/data.dir/utest_stats.cc.o" "gcc" "src/utest/data/CMakeFiles/data.dir/utest_stats.cc.o.d"
+  "/root/repo/src/utest/data/utest_table.cc" "src/utest/data/CMakeFiles/data.dir/utest_table.cc.o" "gcc" "src/utest/data/CMakeFiles/data.dir/utest_table.cc.o.d"
+  "/root/repo/src/utest/data/utest_varreal.cc" "src/utest/data/CMakeFiles/data.dir/utest_varreal.cc.o" "gcc" "src/utest/data/CMakeFiles/data.dir/utest_varreal.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/callisto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
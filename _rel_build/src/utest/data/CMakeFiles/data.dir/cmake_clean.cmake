@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/data.dir/__/main.cc.o"
+  "CMakeFiles/data.dir/__/main.cc.o.d"
+  "CMakeFiles/data.dir/utest_array.cc.o"
+  "CMakeFiles/data.dir/utest_array.cc.o.d"
+  "CMakeFiles/data.dir/utest_csvtable.cc.o"
+  "CMakeFiles/data.dir/utest_csvtable.cc.o.d"
+  "CMakeFiles/data.dir/utest_exemplar.cc.o"
+  "CMakeFiles/data.dir/utest_exemplar.cc.o.d"
+  "CMakeFiles/data.dir/utest_h5io.cc.o"
+  "CMakeFiles/data.dir/utest_h5io.cc.o.d"
+  "CMakeFiles/data.dir/utest_parsetool.cc.o"
+  "CMakeFiles/data.dir/utest_parsetool.cc.o.d"
+  "CMakeFiles/data.dir/utest_stats.cc.o"
+  "CMakeFiles/data.dir/utest_stats.cc.o.d"
+  "CMakeFiles/data.dir/utest_table.cc.o"
+  "CMakeFiles/data.dir/utest_table.cc.o.d"
+  "CMakeFiles/data.dir/utest_varreal.cc.o"
+  "CMakeFiles/data.dir/utest_varreal.cc.o.d"
+  "data"
+  "data.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
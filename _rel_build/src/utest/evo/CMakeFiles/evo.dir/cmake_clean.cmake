@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/evo.dir/__/main.cc.o"
+  "CMakeFiles/evo.dir/__/main.cc.o.d"
+  "CMakeFiles/evo.dir/utest_metric.cc.o"
+  "CMakeFiles/evo.dir/utest_metric.cc.o.d"
+  "CMakeFiles/evo.dir/utest_real_enc.cc.o"
+  "CMakeFiles/evo.dir/utest_real_enc.cc.o.d"
+  "CMakeFiles/evo.dir/utest_toolkit.cc.o"
+  "CMakeFiles/evo.dir/utest_toolkit.cc.o.d"
+  "evo"
+  "evo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/evo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/utest/main.cc" "src/utest/fuzzy/CMakeFiles/fuzzy.dir/__/main.cc.o" "gcc" "src/utest/fuzzy/CMakeFiles/fuzzy.dir/__/main.cc.o.d"
+  "/root/repo/src/utest/fuzzy/utest_fset.cc" "src/utest/fuzzy/CMakeFiles/fuzzy.dir/utest_fset.cc.o" "gcc" "src/utest/fuzzy/CMakeFiles/fuzzy.dir/utest_fset.cc.o.d"
+  "/root/repo/src/utest/fuzzy/utest_group.cc" "src/utest/fuzzy/CMakeFiles/fuzzy.dir/utest_group.cc.o" "gcc" "src/utest/fuzzy/CMakeFiles/fuzzy.dir/utest_group.cc.o.d"
+  "/root/repo/src/utest/fuzzy/utest_kernel.cc" "src/utest/fuzzy/CMakeFiles/fuzzy.dir/utest_kernel.cc.o" "gcc" "src/utest/fuzzy/CMakeFiles/fuzzy.dir/utest_kernel.cc.o.d"
+  "/root/repo/src/utest/fuzzy/utest_partition.cc" "src/utest/fuzzy/CMakeFiles/fuzzy.dir/utest_partition.cc.o" "gcc" "src/utest/fuzzy/CMakeFiles/fuzzy.dir/utest_partition.cc.o.d"
+  "/root/repo/src/utest/fuzzy/utest_rulebase.cc" "src/utest/fuzzy/CMakeFiles/fuzzy.dir/utest_rulebase.cc.o" "gcc" "src/utest/fuzzy/CMakeFiles/fuzzy.dir/utest_rulebase.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/callisto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
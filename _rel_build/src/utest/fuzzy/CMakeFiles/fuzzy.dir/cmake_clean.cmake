@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fuzzy.dir/__/main.cc.o"
+  "CMakeFiles/fuzzy.dir/__/main.cc.o.d"
+  "CMakeFiles/fuzzy.dir/utest_fset.cc.o"
+  "CMakeFiles/fuzzy.dir/utest_fset.cc.o.d"
+  "CMakeFiles/fuzzy.dir/utest_group.cc.o"
+  "CMakeFiles/fuzzy.dir/utest_group.cc.o.d"
+  "CMakeFiles/fuzzy.dir/utest_kernel.cc.o"
+  "CMakeFiles/fuzzy.dir/utest_kernel.cc.o.d"
+  "CMakeFiles/fuzzy.dir/utest_partition.cc.o"
+  "CMakeFiles/fuzzy.dir/utest_partition.cc.o.d"
+  "CMakeFiles/fuzzy.dir/utest_rulebase.cc.o"
+  "CMakeFiles/fuzzy.dir/utest_rulebase.cc.o.d"
+  "fuzzy"
+  "fuzzy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fuzzy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linalg.dir/__/main.cc.o"
+  "CMakeFiles/linalg.dir/__/main.cc.o.d"
+  "CMakeFiles/linalg.dir/utest_linalg2d.cc.o"
+  "CMakeFiles/linalg.dir/utest_linalg2d.cc.o.d"
+  "CMakeFiles/linalg.dir/utest_linalg3d.cc.o"
+  "CMakeFiles/linalg.dir/utest_linalg3d.cc.o.d"
+  "linalg"
+  "linalg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linalg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/utest/main.cc" "src/utest/matvec/CMakeFiles/matvec.dir/__/main.cc.o" "gcc" "src/utest/matvec/CMakeFiles/matvec.dir/__/main.cc.o.d"
+  "/root/repo/src/utest/matvec/utest_matrix2d.cc" "src/utest/matvec/CMakeFiles/matvec.dir/utest_matrix2d.cc.o" "gcc" "src/utest/matvec/CMakeFiles/matvec.dir/utest_matrix2d.cc.o.d"
+  "/root/repo/src/utest/matvec/utest_matrix3d.cc" "src/utest/matvec/CMakeFiles/matvec.dir/utest_matrix3d.cc.o" "gcc" "src/utest/matvec/CMakeFiles/matvec.dir/utest_matrix3d.cc.o.d"
+  "/root/repo/src/utest/matvec/utest_vector2d.cc" "src/utest/matvec/CMakeFiles/matvec.dir/utest_vector2d.cc.o" "gcc" "src/utest/matvec/CMakeFiles/matvec.dir/utest_vector2d.cc.o.d"
+  "/root/repo/src/utest/matvec/utest_vector3d.cc" "src/utest/matvec/CMakeFiles/matvec.dir/utest_vector3d.cc.o" "gcc" "src/utest/matvec/CMakeFiles/matvec.dir/utest_vector3d.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/callisto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/matvec.dir/__/main.cc.o"
+  "CMakeFiles/matvec.dir/__/main.cc.o.d"
+  "CMakeFiles/matvec.dir/utest_matrix2d.cc.o"
+  "CMakeFiles/matvec.dir/utest_matrix2d.cc.o.d"
+  "CMakeFiles/matvec.dir/utest_matrix3d.cc.o"
+  "CMakeFiles/matvec.dir/utest_matrix3d.cc.o.d"
+  "CMakeFiles/matvec.dir/utest_vector2d.cc.o"
+  "CMakeFiles/matvec.dir/utest_vector2d.cc.o.d"
+  "CMakeFiles/matvec.dir/utest_vector3d.cc.o"
+  "CMakeFiles/matvec.dir/utest_vector3d.cc.o.d"
+  "matvec"
+  "matvec.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/matvec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/utest/main.cc" "src/utest/nervenet/CMakeFiles/nervenet.dir/__/main.cc.o" "gcc" "src/utest/nervenet/CMakeFiles/nervenet.dir/__/main.cc.o.d"
+  "/root/repo/src/utest/nervenet/utest_activate.cc" "src/utest/nervenet/CMakeFiles/nervenet.dir/utest_activate.cc.o" "gcc" "src/utest/nervenet/CMakeFiles/nervenet.dir/utest_activate.cc.o.d"
+  "/root/repo/src/utest/nervenet/utest_alloc.cc" "src/utest/nervenet/CMakeFiles/nervenet.dir/utest_alloc.cc.o" "gcc" "src/utest/nervenet/CMakeFiles/nervenet.dir/utest_alloc.cc.o.d"
+  "/root/repo/src/utest/nervenet/utest_cost.cc" "src/utest/nervenet/CMakeFiles/nervenet.dir/utest_cost.cc.o" "gcc" "src/utest/nervenet/CMakeFiles/nervenet.dir/utest_cost.cc.o.d"
+  "/root/repo/src/utest/nervenet/utest_layer.cc" "src/utest/nervenet/CMakeFiles/nervenet.dir/utest_layer.cc.o" "gcc" "src/utest/nervenet/CMakeFiles/nervenet.dir/utest_layer.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/callisto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nervenet.dir/__/main.cc.o"
+  "CMakeFiles/nervenet.dir/__/main.cc.o.d"
+  "CMakeFiles/nervenet.dir/utest_activate.cc.o"
+  "CMakeFiles/nervenet.dir/utest_activate.cc.o.d"
+  "CMakeFiles/nervenet.dir/utest_alloc.cc.o"
+  "CMakeFiles/nervenet.dir/utest_alloc.cc.o.d"
+  "CMakeFiles/nervenet.dir/utest_cost.cc.o"
+  "CMakeFiles/nervenet.dir/utest_cost.cc.o.d"
+  "CMakeFiles/nervenet.dir/utest_layer.cc.o"
+  "CMakeFiles/nervenet.dir/utest_layer.cc.o.d"
+  "nervenet"
+  "nervenet.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nervenet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
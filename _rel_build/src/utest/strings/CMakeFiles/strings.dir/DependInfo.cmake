@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/utest/main.cc" "src/utest/strings/CMakeFiles/strings.dir/__/main.cc.o" "gcc" "src/utest/strings/CMakeFiles/strings.dir/__/main.cc.o.d"
+  "/root/repo/src/utest/strings/utest_stringtool.cc" "src/utest/strings/CMakeFiles/strings.dir/utest_stringtool.cc.o" "gcc" "src/utest/strings/CMakeFiles/strings.dir/utest_stringtool.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/callisto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
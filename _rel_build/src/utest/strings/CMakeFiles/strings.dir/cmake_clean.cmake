@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/strings.dir/__/main.cc.o"
+  "CMakeFiles/strings.dir/__/main.cc.o.d"
+  "CMakeFiles/strings.dir/utest_stringtool.cc.o"
+  "CMakeFiles/strings.dir/utest_stringtool.cc.o.d"
+  "strings"
+  "strings.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/strings.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
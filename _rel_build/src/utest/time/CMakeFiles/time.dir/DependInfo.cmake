@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/utest/main.cc" "src/utest/time/CMakeFiles/time.dir/__/main.cc.o" "gcc" "src/utest/time/CMakeFiles/time.dir/__/main.cc.o.d"
+  "/root/repo/src/utest/time/utest_absolute.cc" "src/utest/time/CMakeFiles/time.dir/utest_absolute.cc.o" "gcc" "src/utest/time/CMakeFiles/time.dir/utest_absolute.cc.o.d"
+  "/root/repo/src/utest/time/utest_date.cc" "src/utest/time/CMakeFiles/time.dir/utest_date.cc.o" "gcc" "src/utest/time/CMakeFiles/time.dir/utest_date.cc.o.d"
+  "/root/repo/src/utest/time/utest_datetime.cc" "src/utest/time/CMakeFiles/time.dir/utest_datetime.cc.o" "gcc" "src/utest/time/CMakeFiles/time.dir/utest_datetime.cc.o.d"
+  "/root/repo/src/utest/time/utest_iso8601.cc" "src/utest/time/CMakeFiles/time.dir/utest_iso8601.cc.o" "gcc" "src/utest/time/CMakeFiles/time.dir/utest_iso8601.cc.o.d"
+  "/root/repo/src/utest/time/utest_time.cc" "src/utest/time/CMakeFiles/time.dir/utest_time.cc.o" "gcc" "src/utest/time/CMakeFiles/time.dir/utest_time.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/callisto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
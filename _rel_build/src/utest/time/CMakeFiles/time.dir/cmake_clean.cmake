@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/time.dir/__/main.cc.o"
+  "CMakeFiles/time.dir/__/main.cc.o.d"
+  "CMakeFiles/time.dir/utest_absolute.cc.o"
+  "CMakeFiles/time.dir/utest_absolute.cc.o.d"
+  "CMakeFiles/time.dir/utest_date.cc.o"
+  "CMakeFiles/time.dir/utest_date.cc.o.d"
+  "CMakeFiles/time.dir/utest_datetime.cc.o"
+  "CMakeFiles/time.dir/utest_datetime.cc.o.d"
+  "CMakeFiles/time.dir/utest_iso8601.cc.o"
+  "CMakeFiles/time.dir/utest_iso8601.cc.o.d"
+  "CMakeFiles/time.dir/utest_time.cc.o"
+  "CMakeFiles/time.dir/utest_time.cc.o.d"
+  "time"
+  "time.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/time.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
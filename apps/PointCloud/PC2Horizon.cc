@@ -35,6 +35,7 @@
 #include <gkb_horiz.hh>
 #include <StringTool.hh>
 #include <StopWatch.hh>
+#include <Profiler.hh>
 #include <omp.h>
 
 
@@ -141,6 +142,7 @@ size_t isInWedge( real8_t     dst_elv[2],
                   real8_t     S2,     real8_t C2,
                   real8_t     min_range ) {
   // -------------------------------------------------------------------------------------
+  PROFILE_ZONE( "isInWedge" );
 
   size_t num_points = cloud->N();
 
@@ -190,6 +192,7 @@ size_t isInWedge( real8_t     dst_elv[2],
 // =======================================================================================
 size_t* buildAltitudeTable( GKBH& gkb, PointCloud& cloud ) {
   // -------------------------------------------------------------------------------------
+  PROFILE_ZONE( "buildAltitudeTable" );
   std::cout << "buildAltitudeTable * Slow Reference Version\n";
   StopWatch SW;
   
@@ -239,6 +242,7 @@ void ComputeWedges( size_t gp_index, GKBH& gkb, PointCloud& cloud,
                     size_t* reg_index, int16_t* isBuilding,
                     WedgeParts* wedge, size_t num_wedge ) {
   // -------------------------------------------------------------------------------------
+  PROFILE_ZONE( "ComputeWedges" );
   size_t       num_points = cloud.N();
   GKBH::Point* point      = gkb.point( gp_index );
   real8_t      grid_x     = point->xutm;
@@ -277,6 +281,7 @@ int process( ConfigDB::Section* cfg ) {
   std::string oFilename = cfg->get( "output" );
   std::string lFilename = cfg->get( "label" );
   real8_t     ratio     = StringTool::asReal8( cfg->get( "ratio" ) ) / 100.0;
+  bool        profile   = StringTool::asBool( cfg->get( "profile" ) );
 
   PointCloud cloud( pFilename, ratio );
   std::cout << "Point Cloud file = " << pFilename << std::endl;
@@ -327,6 +332,8 @@ int process( ConfigDB::Section* cfg ) {
   }
   // ====================================
 
+  if ( profile ) { Profiler::report( std::cout ); }
+
   delete isBuilding;
 
   gkb.write( oFilename );
@@ -352,6 +359,7 @@ int main( int argc, char *argv[], char **env ) {
     { "lab",   "APP", "label",  true,   0,    "input label file" },
     { "of",    "APP", "output", true,   0,    "output GKB file" },
     { "ratio", "APP", "ratio",  false, "100.0", "percent of point cloud points to use" },
+    { "prof",  "APP", "profile", false, "false", "print the profiler report" },
     { 0, 0, 0, false, 0, 0 } 
   };
   
@@ -375,6 +383,7 @@ int main( int argc, char *argv[], char **env ) {
   AppOptions::addUsageText( "  ratio=10 only 1 in 10 (random) cloud points will be compared" );
   AppOptions::addUsageText( "  each wedge for each GKB grid point randomly selects a" );
   AppOptions::addUsageText( "  different subsample." );
+  AppOptions::addUsageText( "prof: print the time spent in each profiled section" );
 
   ConfigDB* cfg = AppOptions::getConfigDB();
 
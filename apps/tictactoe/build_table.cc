@@ -34,6 +34,9 @@
 // =======================================================================================
 
 #include <state_table.hh>
+#include <game_engine.hh>
+#include <tictactoe.hh>
+#include <packed_table.hh>
 
 
 
@@ -68,46 +71,38 @@ void renumber( State* table, size_t n  ) {
 
 
 // =======================================================================================
-int build( State* table, size_t idx, size_t player  ) {
+/** @brief Build.
+ *  @param[in,out] table states for every base-3 index, boards already loaded.
+ *  @param[in]     E     engine holding the reachable states.
+ *
+ *  Mark every state the engine reached as valid, classify it and link its moves by
+ *  base-3 index. Unreachable boards are left invalid.
+ */
+// ---------------------------------------------------------------------------------------
+void build( State* table, const GameEngine<TicTacToe>& E ) {
   // -------------------------------------------------------------------------------------
-  size_t count = 0;
-  size_t c     = State::check( table[idx] );
-  size_t np    = State::toggle( player );
-  size_t test[9];
-
-  if ( 0 != c ) {
-    table[idx].valid   = true;
-    table[idx].result  = State::WIN;
-    table[idx].current = State::EMPTY;
-    table[idx].winner  = c;
-    return 1;
-  }
-  
-  for ( size_t i=0; i<9; i++ ) {
-    if ( 0 == table[idx].board[i] ) {
-      count += 1;
-      table[idx].store( test );
-      test[i] = player;
-      size_t new_index = State::index( test );
-      table[idx].next[i] = new_index;
-      build( table, new_index, np );
+  for ( size_t id=0; id<E.size(); id++ ) {
+    const size_t idx = E.index( static_cast<u_int32_t>( id ) );
+    State&       S   = table[idx];
+    const size_t c   = State::check( S );
+
+    S.valid   = true;
+    S.winner  = c;
+    S.current = State::EMPTY;
+    if ( 0 != c ) {
+      S.result = State::WIN;
+    } else if ( TicTacToe::terminal( idx ) ) {
+      S.result = State::DRAW;
+    } else {
+      S.result  = State::INPLAY;
+      S.current = TicTacToe::player( S.board );
     }
-  }
 
-  if ( 0 == count ) {
-    table[idx].valid   = true;
-    table[idx].result  = State::DRAW;
-    table[idx].current = State::EMPTY;
-    table[idx].winner  = State::EMPTY;
-    return 1;    
+    for ( int32_t i=0; i<9; i++ ) {
+      const size_t nxt = E.next( static_cast<u_int32_t>( id ), i );
+      S.next[i] = ( nxt < TicTacToe::NUM_STATES ) ? nxt : 0;
+    }
   }
-
-    table[idx].valid   = true;
-    table[idx].result  = State::INPLAY;
-    table[idx].current = player;
-    table[idx].winner  = State::EMPTY;
-
-  return 0;
 }
 
 size_t uid_counter = 1000;
@@ -161,7 +156,29 @@ int main( void ) {
     C.inc();
   }
 
-  build( G->table, 0, State::PO );
+  GameEngine<TicTacToe> E;
+  E.build();
+  build( G->table, E );
+
+  GameEngine<TicTacToe> E8( true );
+  E8.build();
+  std::cerr << "Found " << E8.size() << " boards up to symmetry\n";
+
+  PackedTable P;
+  P.build( E );
+  P.solve();
+  if ( P.write( "state.bin" ) ) {
+    std::cerr << "Unable to write state.bin\n";
+  }
+
+  PackedTable Q;
+  if ( Q.read( "state.bin" ) ) {
+    std::cerr << "Unable to map state.bin\n";
+  } else {
+    std::cerr << "Solved " << Q.size() << " states, " << Q.edges() << " moves, "
+              << "opening value " << Q.result( 0 ) << " in " << Q.plies( 0 ) << " plies, "
+              << "best first move " << Q.bestMove( 0 ) << "\n";
+  }
 
   MARK;
   
@@ -0,0 +1,269 @@
+// ====================================================================== BEGIN FILE =====
+// **                               G A M E _ E N G I N E                               **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Enumerated game-state engine.
+ *  @file   game_engine.hh
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides a template that enumerates every state reachable from the root of a game
+ *  whose positions map onto a dense index (e.g. the base-3 State::index).
+ *
+ *  The game is described by a class G with only static members:
+ *
+ *    static const size_t  NUM_STATES;                  size of the index space
+ *    static const int32_t NUM_MOVES;                   maximum branching factor
+ *    static size_t root      ( void );                 index of the initial state
+ *    static bool   terminal  ( const size_t idx );     no moves from this state
+ *    static size_t play      ( const size_t idx, const int32_t m );
+ *                                                      child or NUM_STATES if illegal
+ *    static size_t canonical ( const size_t idx );     representative of the
+ *                                                      symmetry class of idx
+ *
+ *  The tree is expanded one ply at a time. The moves of every state on a ply are
+ *  played in parallel, each state writing only its own row of the transition table,
+ *  and the children are then memoised by index in a serial pass, so every state is
+ *  expanded exactly once and the numbering is deterministic. Any index is mapped to
+ *  its dense id in O(1).
+ */
+// =======================================================================================
+
+#ifndef __GAME_ENGINE_HH
+#define __GAME_ENGINE_HH
+
+#include <trncmp.hh>
+#include <ThreadPool.hh>
+#include <vector>
+
+
+// =======================================================================================
+template<class G>
+class GameEngine {
+  // -------------------------------------------------------------------------------------
+ public:
+  static const u_int32_t NONE = 0xFFFFFFFFu; ///< id of an index that was not reached
+
+ protected:
+  bool                   symmetric; ///< replace each child by its canonical state
+  std::vector<u_int32_t> ident;     ///< dense id of each index          [NUM_STATES]
+  std::vector<size_t>    order;     ///< index of each id, by ply
+  std::vector<size_t>    child;     ///< index of each child or NUM_STATES [id][NUM_MOVES]
+  std::vector<size_t>    ply_first; ///< first id of each ply
+
+ public:
+  GameEngine  ( const bool sym = false );
+  ~GameEngine ( void ) {}
+
+  void      build    ( void );
+
+  size_t    size     ( void ) const;
+  size_t    depth    ( void ) const;
+  size_t    plyFirst ( const size_t p ) const;
+  bool      reached  ( const size_t idx ) const;
+  u_int32_t find     ( const size_t idx ) const;
+  size_t    index    ( const u_int32_t id ) const;
+  size_t    next     ( const u_int32_t id, const int32_t m ) const;
+
+}; // end class GameEngine
+
+
+template<class G>
+const u_int32_t GameEngine<G>::NONE;
+
+
+// =======================================================================================
+/** @brief Constructor.
+ *  @param[in] sym if true only the canonical state of each symmetry class is kept.
+ */
+// ---------------------------------------------------------------------------------------
+template<class G>
+inline  GameEngine<G>::GameEngine( const bool sym ) :
+    symmetric(sym), ident(), order(), child(), ply_first() {
+  // -------------------------------------------------------------------------------------
+}
+
+
+// =======================================================================================
+/** @brief Build.
+ *
+ *  Enumerate every state reachable from G::root(). With symmetry enabled the root and
+ *  all children are replaced by their canonical states before they are memoised.
+ */
+// ---------------------------------------------------------------------------------------
+template<class G>
+void GameEngine<G>::build( void ) {
+  // -------------------------------------------------------------------------------------
+  const size_t  ns = G::NUM_STATES;
+  const size_t  nm = static_cast<size_t>( G::NUM_MOVES );
+  const bool    sym = symmetric;
+
+  ident.assign( ns, NONE );
+  order.clear();
+  child.clear();
+  ply_first.clear();
+
+  const size_t r = symmetric ? G::canonical( G::root() ) : G::root();
+  ident[r] = 0;
+  order.push_back( r );
+
+  size_t first = 0;
+  while ( first < order.size() ) {
+    const size_t last = order.size();
+    ply_first.push_back( first );
+    child.resize( last*nm, ns );
+
+    // ----- expand the ply in parallel ---------------------
+    size_t*       C = child.data();
+    const size_t* O = order.data();
+    ThreadPool::global()->parallel_for
+        ( static_cast<int64_t>( first ), static_cast<int64_t>( last ),
+          [C, O, nm, ns, sym]( const int64_t i0, const int64_t i1 ) {
+          for ( int64_t i=i0; i<i1; i++ ) {
+            const size_t idx = O[i];
+            if ( G::terminal( idx ) ) { continue; }
+            size_t* row = C + static_cast<size_t>( i )*nm;
+            for ( size_t m=0; m<nm; m++ ) {
+              size_t c = G::play( idx, static_cast<int32_t>( m ) );
+              if ( sym && ( c < ns ) ) { c = G::canonical( c ); }
+              row[m] = c;
+            }
+          }
+        }, 64 );
+
+    // ----- memoise the children of the ply ----------------
+    for ( size_t i=first; i<last; i++ ) {
+      const size_t* row = child.data() + i*nm;
+      for ( size_t m=0; m<nm; m++ ) {
+        const size_t c = row[m];
+        if ( ( c < ns ) && ( NONE == ident[c] ) ) {
+          ident[c] = static_cast<u_int32_t>( order.size() );
+          order.push_back( c );
+        }
+      }
+    }
+
+    first = last;
+  }
+}
+
+
+// =======================================================================================
+/** @brief Size.
+ *  @return number of reachable states.
+ */
+// ---------------------------------------------------------------------------------------
+template<class G>
+inline  size_t GameEngine<G>::size( void ) const {
+  // -------------------------------------------------------------------------------------
+  return order.size();
+}
+
+
+// =======================================================================================
+/** @brief Depth.
+ *  @return number of plies, counting the root.
+ */
+// ---------------------------------------------------------------------------------------
+template<class G>
+inline  size_t GameEngine<G>::depth( void ) const {
+  // -------------------------------------------------------------------------------------
+  return ply_first.size();
+}
+
+
+// =======================================================================================
+/** @brief Ply First.
+ *  @param[in] p ply.
+ *  @return id of the first state of ply p, or size() for p == depth().
+ */
+// ---------------------------------------------------------------------------------------
+template<class G>
+inline  size_t GameEngine<G>::plyFirst( const size_t p ) const {
+  // -------------------------------------------------------------------------------------
+  return ( p < ply_first.size() ) ? ply_first[p] : order.size();
+}
+
+
+// =======================================================================================
+/** @brief Reached.
+ *  @param[in] idx state index.
+ *  @return true if idx is reachable from the root.
+ */
+// ---------------------------------------------------------------------------------------
+template<class G>
+inline  bool GameEngine<G>::reached( const size_t idx ) const {
+  // -------------------------------------------------------------------------------------
+  return ( idx < ident.size() ) && ( NONE != ident[idx] );
+}
+
+
+// =======================================================================================
+/** @brief Find.
+ *  @param[in] idx state index.
+ *  @return dense id of idx, or NONE if it was not reached.
+ */
+// ---------------------------------------------------------------------------------------
+template<class G>
+inline  u_int32_t GameEngine<G>::find( const size_t idx ) const {
+  // -------------------------------------------------------------------------------------
+  return ( idx < ident.size() ) ? ident[idx] : NONE;
+}
+
+
+// =======================================================================================
+/** @brief Index.
+ *  @param[in] id dense id.
+ *  @return state index.
+ */
+// ---------------------------------------------------------------------------------------
+template<class G>
+inline  size_t GameEngine<G>::index( const u_int32_t id ) const {
+  // -------------------------------------------------------------------------------------
+  return order[ id ];
+}
+
+
+// =======================================================================================
+/** @brief Next.
+ *  @param[in] id dense id.
+ *  @param[in] m  move.
+ *  @return index of the state after move m, or G::NUM_STATES if m is illegal.
+ */
+// ---------------------------------------------------------------------------------------
+template<class G>
+inline  size_t GameEngine<G>::next( const u_int32_t id, const int32_t m ) const {
+  // -------------------------------------------------------------------------------------
+  return child[ static_cast<size_t>( id )*static_cast<size_t>( G::NUM_MOVES ) +
+                static_cast<size_t>( m ) ];
+}
+
+
+#endif
+
+
+// =======================================================================================
+// **                               G A M E _ E N G I N E                               **
+// ======================================================================== END FILE =====
@@ -0,0 +1,442 @@
+// ====================================================================== BEGIN FILE =====
+// **                              P A C K E D _ T A B L E                              **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Bit-packed, solved tic-tac-toe state table.
+ *  @file   packed_table.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides the methods for the bit-packed, solved tic-tac-toe state table.
+ */
+// =======================================================================================
+
+#include <packed_table.hh>
+#include <cstring>
+#include <fstream>
+
+
+const u_int32_t PackedTable::NOT_FOUND;
+
+
+namespace {
+
+const char      MAGIC[8]  = { 'T', 'T', 'T', 'P', 'A', 'C', 'K', '1' };
+const u_int32_t PO_BITS   = 0x15555u;  ///< low bit of every cell
+
+/** PO bits of each winning line, the PX bits are the same shifted left by one. */
+const u_int32_t LINE_MASK[8] = {
+  0x00015u, 0x00540u, 0x15000u,     // rows
+  0x01041u, 0x04104u, 0x10410u,     // columns
+  0x10101u, 0x01110u };             // diagonals
+
+} // end namespace
+
+
+#define INIT_VAR(_a) buf(0), num_state(_a), num_edge(_a), \
+    board(0), first(0), edge(0), value(0), depth(0),      \
+    own_board(), own_first(), own_edge(), own_value(), own_depth(), lookup()
+
+
+// =======================================================================================
+/** @brief Constructor.
+ *
+ *  Construct an empty table.
+ */
+// ---------------------------------------------------------------------------------------
+PackedTable::PackedTable( void ) : INIT_VAR(0) {
+  // -------------------------------------------------------------------------------------
+}
+
+
+// =======================================================================================
+/** @brief Destructor.
+ */
+// ---------------------------------------------------------------------------------------
+PackedTable::~PackedTable( void ) {
+  // -------------------------------------------------------------------------------------
+  reset();
+}
+
+
+// =======================================================================================
+/** @brief Reset.
+ *
+ *  Release the mapping and the storage.
+ */
+// ---------------------------------------------------------------------------------------
+void PackedTable::reset( void ) {
+  // -------------------------------------------------------------------------------------
+  if ( static_cast<ParseTool::Buffer*>(0) != buf ) {
+    delete buf;
+  }
+  buf       = static_cast<ParseTool::Buffer*>(0);
+  num_state = 0;
+  num_edge  = 0;
+  own_board.clear();
+  own_first.assign( 1, 0 );
+  own_edge.clear();
+  own_value.clear();
+  own_depth.clear();
+  lookup.clear();
+  attach();
+}
+
+
+// =======================================================================================
+/** @brief Attach.
+ *
+ *  Point the arrays at the storage of a built table.
+ */
+// ---------------------------------------------------------------------------------------
+void PackedTable::attach( void ) {
+  // -------------------------------------------------------------------------------------
+  board = own_board.data();
+  first = own_first.data();
+  edge  = own_edge.data();
+  value = own_value.data();
+  depth = own_depth.data();
+}
+
+
+// =======================================================================================
+/** @brief Reindex.
+ *
+ *  Rebuild the map from base-3 board index to state id.
+ */
+// ---------------------------------------------------------------------------------------
+void PackedTable::reindex( void ) {
+  // -------------------------------------------------------------------------------------
+  lookup.assign( TicTacToe::NUM_STATES, NOT_FOUND );
+  for ( u_int32_t id=0; id<num_state; id++ ) {
+    size_t b[9];
+    unpack( b, board[id] );
+    size_t idx = 0;
+    for ( size_t i=0; i<9; i++ ) {
+      idx += b[i]*TicTacToe::POW3[i];
+    }
+    if ( NOT_FOUND == lookup[idx] ) {
+      lookup[idx] = id;
+    }
+  }
+}
+
+
+// =======================================================================================
+/** @brief Pack.
+ *  @param[in] b board in row order.
+ *  @return board with 2 bits per cell.
+ */
+// ---------------------------------------------------------------------------------------
+u_int32_t PackedTable::pack( const size_t b[9] ) {
+  // -------------------------------------------------------------------------------------
+  u_int32_t w = 0;
+  for ( u_int32_t i=0; i<9; i++ ) {
+    w |= static_cast<u_int32_t>( b[i] & 3 ) << ( 2*i );
+  }
+  return w;
+}
+
+
+// =======================================================================================
+/** @brief Unpack.
+ *  @param[out] b board in row order.
+ *  @param[in]  w board with 2 bits per cell.
+ */
+// ---------------------------------------------------------------------------------------
+void PackedTable::unpack( size_t b[9], const u_int32_t w ) {
+  // -------------------------------------------------------------------------------------
+  for ( u_int32_t i=0; i<9; i++ ) {
+    b[i] = static_cast<size_t>( ( w >> ( 2*i ) ) & 3u );
+  }
+}
+
+
+// =======================================================================================
+/** @brief Winner.
+ *  @param[in] w packed board.
+ *  @return PO or PX if that player holds a line, otherwise EMPTY.
+ */
+// ---------------------------------------------------------------------------------------
+size_t PackedTable::winner( const u_int32_t w ) {
+  // -------------------------------------------------------------------------------------
+  for ( size_t k=0; k<8; k++ ) {
+    const u_int32_t m = LINE_MASK[k];
+    if ( m == ( w & m ) )                 { return State::PO; }
+    if ( ( m << 1 ) == ( w & ( m << 1 ) ) ) { return State::PX; }
+  }
+  return State::EMPTY;
+}
+
+
+// =======================================================================================
+/** @brief Player.
+ *  @param[in] w packed board.
+ *  @return the player to move, PO when both have the same number of marks.
+ */
+// ---------------------------------------------------------------------------------------
+size_t PackedTable::player( const u_int32_t w ) {
+  // -------------------------------------------------------------------------------------
+  const int no = __builtin_popcount( w & PO_BITS );
+  const int nx = __builtin_popcount( ( w >> 1 ) & PO_BITS );
+  return ( no == nx ) ? State::PO : State::PX;
+}
+
+
+// =======================================================================================
+/** @brief Build.
+ *  @param[in] E engine holding the reachable states.
+ *
+ *  Pack the boards and moves of the engine, keeping its numbering. The values are
+ *  zero until solve() is called.
+ */
+// ---------------------------------------------------------------------------------------
+void PackedTable::build( const GameEngine<TicTacToe>& E ) {
+  // -------------------------------------------------------------------------------------
+  reset();
+
+  num_state = static_cast<u_int32_t>( E.size() );
+  own_board.resize( num_state );
+  own_first.resize( num_state + 1 );
+  own_first[0] = 0;
+
+  for ( u_int32_t id=0; id<num_state; id++ ) {
+    size_t b[9];
+    TicTacToe::decode( b, E.index( id ) );
+    own_board[id] = pack( b );
+    for ( int32_t m=0; m<TicTacToe::NUM_MOVES; m++ ) {
+      const size_t c = E.next( id, m );
+      if ( c < TicTacToe::NUM_STATES ) {
+        own_edge.push_back( ( E.find( c ) << 4 ) | static_cast<u_int32_t>( m ) );
+      }
+    }
+    own_first[id+1] = static_cast<u_int32_t>( own_edge.size() );
+  }
+
+  num_edge = static_cast<u_int32_t>( own_edge.size() );
+  own_value.assign( num_state, 0 );
+  own_depth.assign( num_state, 0 );
+
+  attach();
+  reindex();
+}
+
+
+// =======================================================================================
+/** @brief Solve.
+ *
+ *  Retrograde minimax over a built table. Every move leads to the next ply, and the
+ *  plies are contiguous in the numbering, so the plies are valued from the last to
+ *  the first, each one in parallel. A table that was read is already solved.
+ */
+// ---------------------------------------------------------------------------------------
+void PackedTable::solve( void ) {
+  // -------------------------------------------------------------------------------------
+  if ( static_cast<ParseTool::Buffer*>(0) != buf ) { return; }
+
+  // ----- ply boundaries -----------------------------------
+  std::vector<u_int32_t> ply;
+  int last_marks = -1;
+  for ( u_int32_t id=0; id<num_state; id++ ) {
+    const int marks = __builtin_popcount( ( board[id] | ( board[id] >> 1 ) ) & PO_BITS );
+    if ( marks != last_marks ) {
+      ply.push_back( id );
+      last_marks = marks;
+    }
+  }
+  ply.push_back( num_state );
+
+  const u_int32_t* B = board;
+  const u_int32_t* F = first;
+  const u_int32_t* G = edge;
+  int8_t*          V = own_value.data();
+  u_int8_t*        D = own_depth.data();
+
+  for ( size_t p=ply.size()-1; p>0; p-- ) {
+    ThreadPool::global()->parallel_for
+        ( ply[p-1], ply[p], [B, F, G, V, D]( const int64_t i0, const int64_t i1 ) {
+          for ( int64_t i=i0; i<i1; i++ ) {
+            const u_int32_t e0 = F[i];
+            const u_int32_t e1 = F[i+1];
+            if ( State::EMPTY != winner( B[i] ) ) {
+              V[i] = -1;   // ----- the previous player completed a line
+              D[i] = 0;
+              continue;
+            }
+            if ( e0 == e1 ) {
+              V[i] = 0;    // ----- full board
+              D[i] = 0;
+              continue;
+            }
+            int32_t bv = -2;
+            int32_t bd = 0;
+            for ( u_int32_t e=e0; e<e1; e++ ) {
+              const u_int32_t c  = G[e] >> 4;
+              const int32_t   cv = -static_cast<int32_t>( V[c] );
+              const int32_t   cd = static_cast<int32_t>( D[c] ) + 1;
+              if ( ( cv > bv ) ||
+                   ( ( cv == bv ) && ( ( bv > 0 ) ? ( cd < bd ) : ( cd > bd ) ) ) ) {
+                bv = cv;
+                bd = cd;
+              }
+            }
+            V[i] = static_cast<int8_t>( bv );
+            D[i] = static_cast<u_int8_t>( bd );
+          }
+        }, 256 );
+  }
+}
+
+
+// =======================================================================================
+/** @brief Best Move.
+ *  @param[in] id state id.
+ *  @return cell of a move that keeps the minimax value and depth, -1 if none.
+ */
+// ---------------------------------------------------------------------------------------
+int32_t PackedTable::bestMove( const u_int32_t id ) const {
+  // -------------------------------------------------------------------------------------
+  for ( u_int32_t e=first[id]; e<first[id+1]; e++ ) {
+    const u_int32_t c = edge[e] >> 4;
+    if ( ( -value[c] == value[id] ) && ( depth[c] + 1 == depth[id] ) ) {
+      return static_cast<int32_t>( edge[e] & 15u );
+    }
+  }
+  return -1;
+}
+
+
+// =======================================================================================
+/** @brief Find.
+ *  @param[in] b board in row order.
+ *  @return state id of the board, or NOT_FOUND.
+ */
+// ---------------------------------------------------------------------------------------
+u_int32_t PackedTable::find( const size_t b[9] ) const {
+  // -------------------------------------------------------------------------------------
+  size_t idx = 0;
+  for ( size_t i=0; i<9; i++ ) {
+    if ( b[i] > 2 ) { return NOT_FOUND; }
+    idx += b[i]*TicTacToe::POW3[i];
+  }
+  return ( idx < lookup.size() ) ? lookup[idx] : NOT_FOUND;
+}
+
+
+// =======================================================================================
+/** @brief Write.
+ *  @param[in] fspc file specification.
+ *  @return true on error.
+ */
+// ---------------------------------------------------------------------------------------
+bool PackedTable::write( const std::string fspc ) const {
+  // -------------------------------------------------------------------------------------
+  std::ofstream fp( fspc, std::ios::binary );
+  if ( ! fp.good() ) { return true; }
+
+  Header H;
+  memset( &H, 0, sizeof( H ) );
+  memcpy( H.magic, MAGIC, sizeof( MAGIC ) );
+  H.num_state = num_state;
+  H.num_edge  = num_edge;
+
+  const std::streamsize n = static_cast<std::streamsize>( num_state );
+  const std::streamsize e = static_cast<std::streamsize>( num_edge );
+
+  fp.write( reinterpret_cast<const char*>( &H ),    sizeof( H ) );
+  fp.write( reinterpret_cast<const char*>( board ), n*4 );
+  fp.write( reinterpret_cast<const char*>( first ), ( n + 1 )*4 );
+  fp.write( reinterpret_cast<const char*>( edge ),  e*4 );
+  fp.write( reinterpret_cast<const char*>( value ), n );
+  fp.write( reinterpret_cast<const char*>( depth ), n );
+
+  const bool bad = ! fp.good();
+  fp.close();
+  return bad;
+}
+
+
+// =======================================================================================
+/** @brief Read.
+ *  @param[in] fspc file specification.
+ *  @return true on error.
+ *
+ *  Map a table file and use its arrays in place. The file is rejected unless the CSR
+ *  offsets are non-decreasing and end at the number of moves, every move names a state
+ *  in the table and a cell on the board, and every board packs valid cells.
+ */
+// ---------------------------------------------------------------------------------------
+bool PackedTable::read( const std::string fspc ) {
+  // -------------------------------------------------------------------------------------
+  reset();
+
+  buf = new ParseTool::Buffer( fspc );
+  if ( buf->bad() || ( buf->size() < sizeof( Header ) ) ) { reset(); return true; }
+
+  const char* base = buf->begin();
+  Header H;
+  memcpy( &H, base, sizeof( H ) );
+  if ( 0 != memcmp( H.magic, MAGIC, sizeof( MAGIC ) ) ) { reset(); return true; }
+
+  const size_t n = static_cast<size_t>( H.num_state );
+  const size_t e = static_cast<size_t>( H.num_edge );
+  if ( buf->size() != sizeof( H ) + 4*n + 4*( n + 1 ) + 4*e + 2*n ) {
+    reset();
+    return true;
+  }
+
+  const char* p = base + sizeof( H );
+  num_state = H.num_state;
+  num_edge  = H.num_edge;
+  board = reinterpret_cast<const u_int32_t*>( p );  p += 4*n;
+  first = reinterpret_cast<const u_int32_t*>( p );  p += 4*( n + 1 );
+  edge  = reinterpret_cast<const u_int32_t*>( p );  p += 4*e;
+  value = reinterpret_cast<const int8_t*>( p );     p += n;
+  depth = reinterpret_cast<const u_int8_t*>( p );
+
+  // ----- validate before use ------------------------------
+  bool ok = ( 0 == first[0] ) && ( num_edge == first[n] );
+  for ( size_t s=0; ok && ( s<n ); s++ ) {
+    ok = ( first[s] <= first[s+1] );
+  }
+  for ( size_t k=0; ok && ( k<e ); k++ ) {
+    ok = ( ( edge[k] >> 4 ) < num_state ) && ( ( edge[k] & 15u ) < 9 );
+  }
+  for ( size_t s=0; ok && ( s<n ); s++ ) {
+    ok = ( 0 == ( board[s] >> 18 ) );
+    for ( u_int32_t i=0; ok && ( i<9 ); i++ ) {
+      ok = ( 3u != ( ( board[s] >> ( 2*i ) ) & 3u ) );
+    }
+  }
+  if ( ! ok ) { reset(); return true; }
+
+  reindex();
+  return false;
+}
+
+
+// =======================================================================================
+// **                              P A C K E D _ T A B L E                              **
+// ======================================================================== END FILE =====
@@ -0,0 +1,217 @@
+// ====================================================================== BEGIN FILE =====
+// **                              P A C K E D _ T A B L E                              **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Bit-packed, solved tic-tac-toe state table.
+ *  @file   packed_table.hh
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Each board is one 32 bit word holding 2 bits per cell (cell i in bits 2i and
+ *  2i+1, with the State::EMPTY, PO and PX codes). The moves are a CSR array: the
+ *  moves of state s are edge[ first[s] .. first[s+1]-1 ], each one (id << 4) | cell.
+ *
+ *  solve() is a retrograde minimax: states are numbered ply by ply, so walking the
+ *  plies backwards values every child before its parent, and the states of one ply
+ *  are valued in parallel. value() is +1, 0 or -1 for the player to move under
+ *  perfect play, and depth() is the number of plies to the end, winning as soon and
+ *  losing as late as possible.
+ *
+ *  The table file is a 32 byte header followed by the raw arrays in native byte
+ *  order, so read() maps the file and uses the arrays in place. About 120 KB for
+ *  the full game.
+ */
+// =======================================================================================
+
+#ifndef __PACKED_TABLE_HH
+#define __PACKED_TABLE_HH
+
+#include <game_engine.hh>
+#include <tictactoe.hh>
+#include <ParseTool.hh>
+#include <vector>
+
+
+// =======================================================================================
+class PackedTable {
+  // -------------------------------------------------------------------------------------
+ public:
+  static const u_int32_t NOT_FOUND = 0xFFFFFFFFu;
+
+  // =====================================================================================
+  struct Header {                                              // PackedTable::Header
+    // -----------------------------------------------------------------------------------
+    char      magic[8];    ///< "TTTPACK1"
+    u_int32_t num_state;   ///< number of states
+    u_int32_t num_edge;    ///< number of moves
+    u_int32_t reserved[4]; ///< zero
+  }; // end struct PackedTable::Header
+
+ protected:
+  ParseTool::Buffer*     buf;       ///< mapped table file, null when built
+
+  u_int32_t              num_state; ///< number of states
+  u_int32_t              num_edge;  ///< number of moves
+
+  const u_int32_t*       board;     ///< packed board           [num_state]
+  const u_int32_t*       first;     ///< CSR offsets            [num_state+1]
+  const u_int32_t*       edge;      ///< (id << 4) | cell       [num_edge]
+  const int8_t*          value;     ///< minimax value          [num_state]
+  const u_int8_t*        depth;     ///< plies to the end       [num_state]
+
+  std::vector<u_int32_t> own_board; ///< storage of a built table
+  std::vector<u_int32_t> own_first;
+  std::vector<u_int32_t> own_edge;
+  std::vector<int8_t>    own_value;
+  std::vector<u_int8_t>  own_depth;
+  std::vector<u_int32_t> lookup;    ///< id of each base-3 index
+
+  void reset    ( void );
+  void attach   ( void );
+  void reindex  ( void );
+
+ public:
+  PackedTable  ( void );
+  ~PackedTable ( void );
+
+  static u_int32_t pack     ( const size_t b[9] );
+  static void      unpack   ( size_t b[9], const u_int32_t w );
+  static size_t    winner   ( const u_int32_t w );
+  static size_t    player   ( const u_int32_t w );
+
+  void      build    ( const GameEngine<TicTacToe>& E );
+  void      solve    ( void );
+  bool      write    ( const std::string fspc ) const;
+  bool      read     ( const std::string fspc );
+
+  size_t    size     ( void ) const;
+  size_t    edges    ( void ) const;
+  u_int32_t find     ( const size_t b[9] ) const;
+  u_int32_t state    ( const u_int32_t id ) const;
+  int32_t   nMoves   ( const u_int32_t id ) const;
+  u_int32_t move     ( const u_int32_t id, const int32_t k, int32_t& cell ) const;
+  int32_t   result   ( const u_int32_t id ) const;
+  int32_t   plies    ( const u_int32_t id ) const;
+  int32_t   bestMove ( const u_int32_t id ) const;
+
+ private:
+  EMPTY_PROTOTYPE( PackedTable );
+
+}; // end class PackedTable
+
+
+// =======================================================================================
+/** @brief Size.
+ *  @return number of states.
+ */
+// ---------------------------------------------------------------------------------------
+inline  size_t PackedTable::size( void ) const {
+  // -------------------------------------------------------------------------------------
+  return static_cast<size_t>( num_state );
+}
+
+
+// =======================================================================================
+/** @brief Edges.
+ *  @return number of moves.
+ */
+// ---------------------------------------------------------------------------------------
+inline  size_t PackedTable::edges( void ) const {
+  // -------------------------------------------------------------------------------------
+  return static_cast<size_t>( num_edge );
+}
+
+
+// =======================================================================================
+/** @brief State.
+ *  @param[in] id state id.
+ *  @return packed board.
+ */
+// ---------------------------------------------------------------------------------------
+inline  u_int32_t PackedTable::state( const u_int32_t id ) const {
+  // -------------------------------------------------------------------------------------
+  return board[ id ];
+}
+
+
+// =======================================================================================
+/** @brief Number of Moves.
+ *  @param[in] id state id.
+ *  @return number of legal moves.
+ */
+// ---------------------------------------------------------------------------------------
+inline  int32_t PackedTable::nMoves( const u_int32_t id ) const {
+  // -------------------------------------------------------------------------------------
+  return static_cast<int32_t>( first[ id+1 ] - first[ id ] );
+}
+
+
+// =======================================================================================
+/** @brief Move.
+ *  @param[in]  id   state id.
+ *  @param[in]  k    move number (0 .. nMoves(id)-1).
+ *  @param[out] cell cell marked by the move.
+ *  @return id of the state after the move.
+ */
+// ---------------------------------------------------------------------------------------
+inline  u_int32_t PackedTable::move( const u_int32_t id, const int32_t k,
+                                     int32_t& cell ) const {
+  // -------------------------------------------------------------------------------------
+  const u_int32_t e = edge[ first[ id ] + static_cast<u_int32_t>( k ) ];
+  cell = static_cast<int32_t>( e & 15u );
+  return e >> 4;
+}
+
+
+// =======================================================================================
+/** @brief Result.
+ *  @param[in] id state id.
+ *  @return +1 win, 0 draw, -1 loss for the player to move under perfect play.
+ */
+// ---------------------------------------------------------------------------------------
+inline  int32_t PackedTable::result( const u_int32_t id ) const {
+  // -------------------------------------------------------------------------------------
+  return static_cast<int32_t>( value[ id ] );
+}
+
+
+// =======================================================================================
+/** @brief Plies.
+ *  @param[in] id state id.
+ *  @return number of plies to the end of the game under perfect play.
+ */
+// ---------------------------------------------------------------------------------------
+inline  int32_t PackedTable::plies( const u_int32_t id ) const {
+  // -------------------------------------------------------------------------------------
+  return static_cast<int32_t>( depth[ id ] );
+}
+
+
+#endif
+
+
+// =======================================================================================
+// **                              P A C K E D _ T A B L E                              **
+// ======================================================================== END FILE =====
@@ -41,14 +41,14 @@ State* table;
 size_t table_size;
 
 // =======================================================================================
-StateTable::StateTable( std::string fspc ) : table(0), table_size(0) {
+StateTable::StateTable( std::string fspc ) : table(0), table_size(0), lookup() {
   // -------------------------------------------------------------------------------------
   read( fspc );
 }
 
 
 // =======================================================================================
-StateTable::StateTable( size_t n ) : table(0), table_size(0) {
+StateTable::StateTable( size_t n ) : table(0), table_size(0), lookup() {
   // -------------------------------------------------------------------------------------
   init( n );
 }
@@ -69,6 +69,7 @@ void StateTable::destroy( void ) {
   }
   table_size = 0;
   table = static_cast<State*>(0);
+  lookup.clear();
 }
 
 
@@ -80,6 +81,7 @@ void StateTable::init( size_t n ) {
   }
   table      = new State[ n ];
   table_size = n;
+  lookup.clear();
 }
 
 
@@ -112,17 +114,41 @@ void StateTable::read( std::string fspc ) {
     }
   
   fp.close();
+
+  reindex();
 }
 
 // =======================================================================================
-size_t StateTable::find( size_t t[] ) {
+/** @brief Reindex.
+ *
+ *  Rebuild the map from base-3 board index to table row. Call after the boards in
+ *  the table have been changed by hand.
+ */
+// ---------------------------------------------------------------------------------------
+void StateTable::reindex( void ) {
   // -------------------------------------------------------------------------------------
-  for ( size_t i=0; i<table_size; i++ ) {
-    if ( table[i].compare( t ) ) {
-      return i;
+  lookup.assign( State::maxIndex() + 1, table_size );
+  for ( size_t i=table_size; i>0; i-- ) {
+    const size_t k = State::index( table[i-1].board );
+    if ( k < lookup.size() ) {
+      lookup[k] = i-1;
     }
   }
-  return 0;
+}
+
+
+// =======================================================================================
+/** @brief Find.
+ *  @param[in] t board in row order.
+ *  @return row of the board, or 0 if it is not in the table.
+ */
+// ---------------------------------------------------------------------------------------
+size_t StateTable::find( size_t t[] ) {
+  // -------------------------------------------------------------------------------------
+  if ( lookup.empty() ) { reindex(); }
+  const size_t k = State::index( t );
+  if ( k >= lookup.size() ) { return 0; }
+  return ( lookup[k] < table_size ) ? lookup[k] : 0;
 }
 
 // =======================================================================================
@@ -37,6 +37,7 @@
 #define __STATE_TABLE_HH
 
 #include <state.hh>
+#include <vector>
 
 // =======================================================================================
 class StateTable {
@@ -46,6 +47,8 @@ class StateTable {
   State* table;
   size_t table_size;
 
+  std::vector<size_t> lookup; ///< row of each base-3 index, table_size if absent
+
   StateTable  ( std::string fspc );
   StateTable  ( size_t n );
   ~StateTable ( void );
@@ -55,6 +58,7 @@ class StateTable {
 
   void   write   ( std::string fspc );
   void   read    ( std::string fspc );
+  void   reindex ( void );
   size_t find    ( size_t t[] );
 
  private:
@@ -0,0 +1,62 @@
+// ====================================================================== BEGIN FILE =====
+// **                                 T I C T A C T O E                                 **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Tic-tac-toe rules for the GameEngine.
+ *  @file   tictactoe.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides the tables for the tic-tac-toe rules.
+ */
+// =======================================================================================
+
+#include <tictactoe.hh>
+
+const size_t  TicTacToe::NUM_STATES;
+const int32_t TicTacToe::NUM_MOVES;
+
+const size_t TicTacToe::POW3[9] = { 1, 3, 9, 27, 81, 243, 729, 2187, 6561 };
+
+const size_t TicTacToe::LINE[8][3] = {
+  { 0, 1, 2 }, { 3, 4, 5 }, { 6, 7, 8 },
+  { 0, 3, 6 }, { 1, 4, 7 }, { 2, 5, 8 },
+  { 0, 4, 8 }, { 2, 4, 6 } };
+
+/** cell i of the transformed board is cell SYMMETRY[s][i] of the original. */
+const size_t TicTacToe::SYMMETRY[8][9] = {
+  { 0, 1, 2, 3, 4, 5, 6, 7, 8 },   // identity
+  { 6, 3, 0, 7, 4, 1, 8, 5, 2 },   // rotate  90
+  { 8, 7, 6, 5, 4, 3, 2, 1, 0 },   // rotate 180
+  { 2, 5, 8, 1, 4, 7, 0, 3, 6 },   // rotate 270
+  { 2, 1, 0, 5, 4, 3, 8, 7, 6 },   // mirror left-right
+  { 6, 7, 8, 3, 4, 5, 0, 1, 2 },   // mirror top-bottom
+  { 0, 3, 6, 1, 4, 7, 2, 5, 8 },   // transpose
+  { 8, 5, 2, 7, 4, 1, 6, 3, 0 } }; // anti-transpose
+
+
+// =======================================================================================
+// **                                 T I C T A C T O E                                 **
+// ======================================================================== END FILE =====
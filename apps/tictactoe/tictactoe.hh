@@ -0,0 +1,190 @@
+// ====================================================================== BEGIN FILE =====
+// **                                 T I C T A C T O E                                 **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Tic-tac-toe rules for the GameEngine.
+ *  @file   tictactoe.hh
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Describes tic-tac-toe on the base-3 State::index (cell i has weight 3^i and holds
+ *  State::EMPTY, PO or PX). PO moves first, so the player to move follows from the
+ *  number of marks on the board.
+ */
+// =======================================================================================
+
+#ifndef __TICTACTOE_HH
+#define __TICTACTOE_HH
+
+#include <state.hh>
+
+
+// =======================================================================================
+class TicTacToe {
+  // -------------------------------------------------------------------------------------
+ public:
+  static const size_t  NUM_STATES = 19683;  ///< 3^9
+  static const int32_t NUM_MOVES  = 9;
+
+  static const size_t  POW3[9];       ///< weight of each cell
+  static const size_t  LINE[8][3];    ///< cells of each winning line
+  static const size_t  SYMMETRY[8][9];///< cell permutations of the board's symmetries
+
+  static void   decode    ( size_t b[9], size_t idx );
+  static size_t winner    ( const size_t b[9] );
+  static size_t player    ( const size_t b[9] );
+
+  static size_t root      ( void );
+  static bool   terminal  ( const size_t idx );
+  static size_t play      ( const size_t idx, const int32_t m );
+  static size_t canonical ( const size_t idx );
+
+}; // end class TicTacToe
+
+
+// =======================================================================================
+/** @brief Decode.
+ *  @param[out] b   board in row order.
+ *  @param[in]  idx base-3 index.
+ */
+// ---------------------------------------------------------------------------------------
+inline  void TicTacToe::decode( size_t b[9], size_t idx ) {
+  // -------------------------------------------------------------------------------------
+  for ( size_t i=0; i<9; i++ ) {
+    b[i] = idx % 3;
+    idx /= 3;
+  }
+}
+
+
+// =======================================================================================
+/** @brief Winner.
+ *  @param[in] b board in row order.
+ *  @return PO or PX if that player holds a line, otherwise EMPTY.
+ */
+// ---------------------------------------------------------------------------------------
+inline  size_t TicTacToe::winner( const size_t b[9] ) {
+  // -------------------------------------------------------------------------------------
+  for ( size_t k=0; k<8; k++ ) {
+    const size_t p = b[ LINE[k][0] ];
+    if ( ( State::EMPTY != p ) && ( p == b[ LINE[k][1] ] ) && ( p == b[ LINE[k][2] ] ) ) {
+      return p;
+    }
+  }
+  return State::EMPTY;
+}
+
+
+// =======================================================================================
+/** @brief Player.
+ *  @param[in] b board in row order.
+ *  @return the player to move, PO when both have the same number of marks.
+ */
+// ---------------------------------------------------------------------------------------
+inline  size_t TicTacToe::player( const size_t b[9] ) {
+  // -------------------------------------------------------------------------------------
+  size_t no = 0, nx = 0;
+  for ( size_t i=0; i<9; i++ ) {
+    no += ( State::PO == b[i] ) ? 1 : 0;
+    nx += ( State::PX == b[i] ) ? 1 : 0;
+  }
+  return ( no == nx ) ? State::PO : State::PX;
+}
+
+
+// =======================================================================================
+/** @brief Root.
+ *  @return index of the empty board.
+ */
+// ---------------------------------------------------------------------------------------
+inline  size_t TicTacToe::root( void ) {
+  // -------------------------------------------------------------------------------------
+  return 0;
+}
+
+
+// =======================================================================================
+/** @brief Terminal.
+ *  @param[in] idx base-3 index.
+ *  @return true if the board is won or full.
+ */
+// ---------------------------------------------------------------------------------------
+inline  bool TicTacToe::terminal( const size_t idx ) {
+  // -------------------------------------------------------------------------------------
+  size_t b[9];
+  decode( b, idx );
+  if ( State::EMPTY != winner( b ) ) { return true; }
+  for ( size_t i=0; i<9; i++ ) {
+    if ( State::EMPTY == b[i] ) { return false; }
+  }
+  return true;
+}
+
+
+// =======================================================================================
+/** @brief Play.
+ *  @param[in] idx base-3 index.
+ *  @param[in] m   cell to mark.
+ *  @return index after the player to move marks cell m, NUM_STATES if it is taken.
+ */
+// ---------------------------------------------------------------------------------------
+inline  size_t TicTacToe::play( const size_t idx, const int32_t m ) {
+  // -------------------------------------------------------------------------------------
+  size_t b[9];
+  decode( b, idx );
+  const size_t c = static_cast<size_t>( m );
+  if ( State::EMPTY != b[c] ) { return NUM_STATES; }
+  return idx + player( b )*POW3[c];
+}
+
+
+// =======================================================================================
+/** @brief Canonical.
+ *  @param[in] idx base-3 index.
+ *  @return the smallest index among the 8 rotations and reflections of the board.
+ */
+// ---------------------------------------------------------------------------------------
+inline  size_t TicTacToe::canonical( const size_t idx ) {
+  // -------------------------------------------------------------------------------------
+  size_t b[9];
+  decode( b, idx );
+  size_t best = idx;
+  for ( size_t s=1; s<8; s++ ) {
+    size_t t = 0;
+    for ( size_t i=0; i<9; i++ ) {
+      t += b[ SYMMETRY[s][i] ]*POW3[i];
+    }
+    best = ( t < best ) ? t : best;
+  }
+  return best;
+}
+
+
+#endif
+
+
+// =======================================================================================
+// **                                 T I C T A C T O E                                 **
+// ======================================================================== END FILE =====
@@ -0,0 +1,323 @@
+// ====================================================================== BEGIN FILE =====
+// **                                     B E N C H                                     **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Microbenchmark harness.
+ *  @file   bench.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18.
+ *
+ *  Provides the methods for the microbenchmark runner and the program entry point.
+ *
+ *  bench_callisto [--filter=TEXT] [--time=SEC] [--samples=N] [--json=FILE]
+ *                 [--baseline=FILE] [--tolerance=FRAC] [--list]
+ *
+ *  The exit code is 1 if any case regressed against the baseline, 2 on a usage or file
+ *  error, 0 otherwise. Baseline rates are machine specific; see src/bench/CMakeLists.txt.
+ */
+// =======================================================================================
+
+#include "bench.hh"
+#include <StopWatch.hh>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+
+
+volatile real8_t bench_sink = 0.0;
+
+
+// =======================================================================================
+/** @brief Add a case.
+ *  @param name  unique case name.
+ *  @param unit  what an item is (flop, draw, sample, ...).
+ *  @param items number of items processed by one call of body.
+ *  @param body  unit of work.
+ */
+// ---------------------------------------------------------------------------------------
+void Bench::add( const std::string& name, const std::string& unit, real8_t items,
+                 body_t body ) {
+  // -------------------------------------------------------------------------------------
+  cases.push_back( entry( name, unit, items, body ) );
+}
+
+
+// =======================================================================================
+/** @brief Measure one case.
+ *  @param E registered case.
+ *  @return median rate over the samples.
+ *
+ *  Double the call count until one sample lasts at least min_time / samples, then time
+ *  each sample with the monotonic clock.
+ */
+// ---------------------------------------------------------------------------------------
+Bench::result Bench::measure( const entry& E ) {
+  // -------------------------------------------------------------------------------------
+  const real8_t target = min_time / static_cast<real8_t>( samples );
+
+  E.body();  // warm up caches and lazy initialization
+
+  int64_t calls = 1;
+  for (;;) {
+    const u_int64_t t0 = StopWatch::nanoseconds();
+    for ( int64_t k=0; k<calls; k++ ) { E.body(); }
+    const real8_t dt = 1.0e-9 * static_cast<real8_t>( StopWatch::nanoseconds() - t0 );
+    if ( ( dt >= target ) || ( calls >= ( static_cast<int64_t>(1) << 40 ) ) ) { break; }
+    calls *= 2;
+  }
+
+  std::vector<real8_t> ns( static_cast<size_t>( samples ) );
+  for ( int32_t s=0; s<samples; s++ ) {
+    const u_int64_t t0 = StopWatch::nanoseconds();
+    for ( int64_t k=0; k<calls; k++ ) { E.body(); }
+    ns[static_cast<size_t>(s)] = static_cast<real8_t>( StopWatch::nanoseconds() - t0 ) /
+        static_cast<real8_t>( calls );
+  }
+  std::sort( ns.begin(), ns.end() );
+
+  result R( E );
+  R.ns    = ns[ns.size()/2];
+  R.rate  = ( 0.0 < R.ns ) ? ( E.items * 1.0e9 / R.ns ) : 0.0;
+  R.calls = calls;
+  return R;
+}
+
+
+// =======================================================================================
+/** @brief Run.
+ *
+ *  Measure every case whose name contains the filter text.
+ */
+// ---------------------------------------------------------------------------------------
+void Bench::run( void ) {
+  // -------------------------------------------------------------------------------------
+  results.clear();
+  for ( size_t i=0; i<cases.size(); i++ ) {
+    if ( ( ! filter.empty() ) && ( std::string::npos == cases[i].name.find( filter ) ) ) {
+      continue;
+    }
+    results.push_back( measure( cases[i] ) );
+    std::cerr << "." << std::flush;
+  }
+  std::cerr << "\n";
+}
+
+
+// =======================================================================================
+/** @brief Print.
+ *  @param os output stream.
+ *
+ *  Write a human readable table of the results.
+ */
+// ---------------------------------------------------------------------------------------
+void Bench::print( std::ostream& os ) const {
+  // -------------------------------------------------------------------------------------
+  char buffer[256];
+  snprintf( buffer, 256, "%-32s %16s %-8s %14s\n", "benchmark", "rate (/s)", "unit", "ns/call" );
+  os << buffer;
+  for ( size_t i=0; i<results.size(); i++ ) {
+    const result& R = results[i];
+    snprintf( buffer, 256, "%-32s %16.6e %-8s %14.1f\n",
+              R.name.c_str(), R.rate, R.unit.c_str(), R.ns );
+    os << buffer;
+  }
+}
+
+
+// =======================================================================================
+/** @brief Write JSON.
+ *  @param fspc path to the output file.
+ *  @return true if an error occured.
+ */
+// ---------------------------------------------------------------------------------------
+bool Bench::write_json( const std::string& fspc ) const {
+  // -------------------------------------------------------------------------------------
+  std::ofstream out( fspc.c_str() );
+  if ( ! out.good() ) {
+    std::cerr << "Bench: can not write " << fspc << "\n";
+    return true;
+  }
+
+  char buffer[512];
+  out << "{\n  \"benchmarks\": [\n";
+  for ( size_t i=0; i<results.size(); i++ ) {
+    const result& R = results[i];
+    snprintf( buffer, 512,
+              "    { \"name\": \"%s\", \"unit\": \"%s\", \"rate\": %.6e, "
+              "\"ns_per_call\": %.3f, \"calls\": %lld }%s\n",
+              R.name.c_str(), R.unit.c_str(), R.rate, R.ns,
+              static_cast<long long>( R.calls ),
+              ( i+1 < results.size() ) ? "," : "" );
+    out << buffer;
+  }
+  out << "  ]\n}\n";
+  return false;
+}
+
+
+// =======================================================================================
+/** @brief Read JSON.
+ *  @param rate returned map of case name to rate.
+ *  @param fspc path to a file written by write_json.
+ *  @return true if an error occured.
+ *
+ *  Minimal reader for the format written by write_json: every "name" is paired with the
+ *  next "rate".
+ */
+// ---------------------------------------------------------------------------------------
+bool Bench::read_json( std::map<std::string, real8_t>& rate, const std::string& fspc ) {
+  // -------------------------------------------------------------------------------------
+  std::ifstream inf( fspc.c_str() );
+  if ( ! inf.good() ) {
+    std::cerr << "Bench: can not read " << fspc << "\n";
+    return true;
+  }
+  std::string text( ( std::istreambuf_iterator<char>( inf ) ),
+                    std::istreambuf_iterator<char>() );
+
+  size_t pos = 0;
+  for (;;) {
+    size_t k = text.find( "\"name\"", pos );
+    if ( std::string::npos == k ) { break; }
+    const size_t q0 = text.find( '"', text.find( ':', k ) );
+    const size_t q1 = text.find( '"', q0+1 );
+    const size_t r  = text.find( "\"rate\"", q1 );
+    if ( ( std::string::npos == q1 ) || ( std::string::npos == r ) ) { break; }
+    const size_t c  = text.find( ':', r );
+    rate[ text.substr( q0+1, q1-q0-1 ) ] = strtod( text.c_str() + c + 1, static_cast<char**>(0) );
+    pos = c;
+  }
+  return false;
+}
+
+
+// =======================================================================================
+/** @brief Compare with a baseline.
+ *  @param fspc      path to the baseline JSON file.
+ *  @param tolerance allowed fractional drop in rate.
+ *  @param os        output stream for the comparison table.
+ *  @return number of regressed cases, or -1 if the baseline could not be read.
+ */
+// ---------------------------------------------------------------------------------------
+int Bench::compare( const std::string& fspc, real8_t tolerance, std::ostream& os ) const {
+  // -------------------------------------------------------------------------------------
+  std::map<std::string, real8_t> base;
+  if ( read_json( base, fspc ) ) { return -1; }
+
+  char buffer[256];
+  int  nreg = 0;
+  snprintf( buffer, 256, "%-32s %16s %16s %9s\n", "benchmark", "baseline", "current", "ratio" );
+  os << buffer;
+
+  for ( size_t i=0; i<results.size(); i++ ) {
+    const result& R = results[i];
+    std::map<std::string, real8_t>::const_iterator it = base.find( R.name );
+    if ( base.end() == it ) {
+      snprintf( buffer, 256, "%-32s %16s %16.6e %9s\n", R.name.c_str(), "-", R.rate, "new" );
+    } else {
+      const real8_t ratio = ( 0.0 < it->second ) ? ( R.rate / it->second ) : 0.0;
+      const bool    worse = ( ratio < ( 1.0 - tolerance ) );
+      if ( worse ) { nreg++; }
+      snprintf( buffer, 256, "%-32s %16.6e %16.6e %9.3f%s\n", R.name.c_str(),
+                it->second, R.rate, ratio, worse ? "  REGRESSION" : "" );
+    }
+    os << buffer;
+  }
+  return nreg;
+}
+
+
+// =======================================================================================
+/** @brief Command line entry.
+ *  @param argc number of arguments.
+ *  @param argv arguments.
+ *  @return process exit code.
+ */
+// ---------------------------------------------------------------------------------------
+int Bench::main( int argc, char* argv[] ) {
+  // -------------------------------------------------------------------------------------
+  std::string json_fspc;
+  std::string base_fspc;
+  real8_t     tolerance = 0.15;
+  bool        list      = false;
+
+  for ( int i=1; i<argc; i++ ) {
+    const char* a = argv[i];
+    if      ( 0 == strncmp( a, "--filter=",    9 ) ) { filter    = a + 9; }
+    else if ( 0 == strncmp( a, "--time=",      7 ) ) { min_time  = atof( a + 7 ); }
+    else if ( 0 == strncmp( a, "--samples=",  10 ) ) { samples   = atoi( a + 10 ); }
+    else if ( 0 == strncmp( a, "--json=",      7 ) ) { json_fspc = a + 7; }
+    else if ( 0 == strncmp( a, "--baseline=", 11 ) ) { base_fspc = a + 11; }
+    else if ( 0 == strncmp( a, "--tolerance=",12 ) ) { tolerance = atof( a + 12 ); }
+    else if ( 0 == strcmp(  a, "--list" ) )          { list      = true; }
+    else {
+      std::cerr << "usage: " << argv[0]
+                << " [--filter=TEXT] [--time=SEC] [--samples=N] [--json=FILE]"
+                << " [--baseline=FILE] [--tolerance=FRAC] [--list]\n";
+      return 2;
+    }
+  }
+  if ( 1 > samples ) { samples = 1; }
+
+  if ( list ) {
+    for ( size_t i=0; i<cases.size(); i++ ) { std::cout << cases[i].name << "\n"; }
+    return 0;
+  }
+
+  run();
+  print( std::cout );
+
+  if ( ! json_fspc.empty() ) {
+    if ( write_json( json_fspc ) ) { return 2; }
+  }
+
+  if ( ! base_fspc.empty() ) {
+    std::cout << "\n";
+    const int nreg = compare( base_fspc, tolerance, std::cout );
+    if ( 0 > nreg ) { return 2; }
+    if ( 0 < nreg ) { return 1; }
+  }
+
+  return 0;
+}
+
+
+// =======================================================================================
+/** @brief Entry point.
+ */
+// ---------------------------------------------------------------------------------------
+int main( int argc, char* argv[] ) {
+  // -------------------------------------------------------------------------------------
+  Bench B;
+  register_kernels( B );
+  return B.main( argc, argv );
+}
+
+
+// =======================================================================================
+// **                                     B E N C H                                     **
+// ======================================================================== END FILE =====
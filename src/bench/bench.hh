@@ -0,0 +1,132 @@
+// ====================================================================== BEGIN FILE =====
+// **                                     B E N C H                                     **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Microbenchmark harness.
+ *  @file   bench.hh
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18.
+ *
+ *  Provides the interface for a small, repeatable microbenchmark runner.
+ *
+ *  Each case is a callable that performs one unit of work on data prepared ahead of time
+ *  and reports how many items (flops, draws, samples, ...) that unit covers. The runner
+ *  calibrates a repeat count so that one sample lasts about min_time / samples seconds,
+ *  takes several samples and reports the median rate. Results can be written as JSON and
+ *  compared with a stored baseline; a case is a regression when its rate falls below
+ *  ( 1 - tolerance ) times the baseline rate.
+ */
+// =======================================================================================
+
+#ifndef __HH_BENCH_TRNCMP
+#define __HH_BENCH_TRNCMP
+
+#include <trncmp.hh>
+#include <functional>
+#include <vector>
+#include <map>
+#include <string>
+
+
+// =======================================================================================
+/** @brief Value sink.
+ *
+ *  Kernels add their results here so the optimizer can not discard the work.
+ */
+// ---------------------------------------------------------------------------------------
+extern volatile real8_t bench_sink;
+
+
+// =======================================================================================
+/** @brief Microbenchmark runner.
+ */
+// ---------------------------------------------------------------------------------------
+class Bench {
+  // -------------------------------------------------------------------------------------
+ public:
+  typedef std::function<void(void)> body_t;  ///< one unit of work
+
+  // =====================================================================================
+  /** @brief Registered case.
+   */
+  // -------------------------------------------------------------------------------------
+  struct entry {
+    std::string name;   ///< unique case name
+    std::string unit;   ///< what an item is
+    real8_t     items;  ///< items per call of body
+    body_t      body;   ///< unit of work
+
+    entry( const std::string& n, const std::string& u, real8_t k, body_t b )
+        : name(n), unit(u), items(k), body(b) {}
+  };
+
+  // =====================================================================================
+  /** @brief Measured case.
+   */
+  // -------------------------------------------------------------------------------------
+  struct result {
+    std::string name;   ///< case name
+    std::string unit;   ///< what an item is
+    real8_t     rate;   ///< median items per second
+    real8_t     ns;     ///< median nanoseconds per call
+    int64_t     calls;  ///< calls per sample
+
+    result( const entry& E ) : name(E.name), unit(E.unit), rate(0.0), ns(0.0), calls(0) {}
+  };
+
+ protected:
+  std::vector<entry>  cases;      ///< registered cases
+  std::vector<result> results;    ///< measured cases
+  real8_t             min_time;   ///< target seconds per case
+  int32_t             samples;    ///< samples per case
+  std::string         filter;     ///< run only names containing this text
+
+  result measure( const entry& E );
+
+ public:
+  Bench( void ) : cases(), results(), min_time(0.5), samples(7), filter() {}
+  ~Bench( void ) {}
+
+  void add( const std::string& name, const std::string& unit, real8_t items, body_t body );
+
+  int  main       ( int argc, char* argv[] );
+  void run        ( void );
+  void print      ( std::ostream& os ) const;
+  bool write_json ( const std::string& fspc ) const;
+  int  compare    ( const std::string& fspc, real8_t tolerance, std::ostream& os ) const;
+
+  static bool read_json( std::map<std::string, real8_t>& rate, const std::string& fspc );
+};
+
+
+void register_kernels( Bench& B );
+
+
+#endif
+
+
+// =======================================================================================
+// **                                     B E N C H                                     **
+// ======================================================================== END FILE =====
@@ -0,0 +1,605 @@
+// ====================================================================== BEGIN FILE =====
+// **                             B E N C H _ K E R N E L S                             **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Microbenchmark kernels.
+ *  @file   bench_kernels.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18.
+ *
+ *  Registers the library hot paths with the benchmark runner. Every case seeds its own
+ *  generator with a fixed value and builds its data once, outside of the timed body, so
+ *  that runs are repeatable.
+ */
+// =======================================================================================
+
+#include "bench.hh"
+#include <Matrix.hh>
+#include <Vector.hh>
+#include <summation.hh>
+#include <Dice.hh>
+#include <Entropy.hh>
+#include <RefKDTree.hh>
+#include <Statistics.hh>
+#include <Table.hh>
+#include <CSVFile.hh>
+#include <CSVTable.hh>
+#include <c2darray.hh>
+#include <nns/layer.hh>
+#include <DOPRI5.hh>
+#include <AbsoluteDate.hh>
+#include <ISO8601.hh>
+#include <astro/Orrey.hh>
+#include <fuzzy/Kernel.hh>
+#include <fuzzy/RuleBase.hh>
+#include <memory>
+#include <cstdio>
+#include <unistd.h>
+
+
+namespace {
+
+
+// =======================================================================================
+/** @brief Fill a buffer with fixed pseudo random values in [-1,1).
+ *  @param a    destination.
+ *  @param n    number of elements.
+ *  @param seed generator seed.
+ */
+// ---------------------------------------------------------------------------------------
+void fill( real8_t* a, const size_t n, const u_int64_t seed ) {
+  // -------------------------------------------------------------------------------------
+  u_int64_t s = seed * 0x9E3779B97F4A7C15ULL + 1;
+  for ( size_t i=0; i<n; i++ ) {
+    s ^= s << 13;  s ^= s >> 7;  s ^= s << 17;
+    a[i] = 2.0 * static_cast<real8_t>( s >> 11 ) * 0x1.0p-53 - 1.0;
+  }
+}
+
+
+// =======================================================================================
+/** @brief Matrix cases.
+ */
+// ---------------------------------------------------------------------------------------
+void matrix_cases( Bench& B ) {
+  // -------------------------------------------------------------------------------------
+  static const int32_t sizes[] = { 16, 64, 256 };
+  for ( size_t k=0; k<3; k++ ) {
+    const int32_t n = sizes[k];
+    std::shared_ptr<Matrix> A( new Matrix( n, n ) );
+    std::shared_ptr<Matrix> X( new Matrix( n, n ) );
+    std::shared_ptr<Matrix> C( new Matrix( n, n ) );
+    std::vector<real8_t> a( static_cast<size_t>( 2*n ) );
+    for ( int32_t r=0; r<n; r++ ) {
+      fill( a.data(), a.size(), static_cast<u_int64_t>( 100+r ) );
+      for ( int32_t c=0; c<n; c++ ) {
+        A->at(r,c) = a[static_cast<size_t>(c)];
+        X->at(r,c) = a[static_cast<size_t>(n+c)];
+      }
+    }
+    char name[64];
+    snprintf( name, 64, "matrix.dot.%d", n );
+    const real8_t N = static_cast<real8_t>( n );
+    B.add( name, "flop", 2.0*N*N*N,
+           [A, X, C]() { C->dot( *A, *X ); bench_sink = bench_sink + C->at(0,0); } );
+  }
+}
+
+
+// =======================================================================================
+/** @brief Vector cases.
+ */
+// ---------------------------------------------------------------------------------------
+void vector_cases( Bench& B ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t n = 4096;
+  std::shared_ptr<Vector> U( new Vector( n ) );
+  std::shared_ptr<Vector> V( new Vector( n ) );
+  for ( int32_t i=0; i<n; i++ ) {
+    real8_t a[2];
+    fill( a, 2, static_cast<u_int64_t>( i+1 ) );
+    (*U)(i) = a[0];
+    (*V)(i) = a[1];
+  }
+  const real8_t N = static_cast<real8_t>( n );
+  B.add( "vector.dot.4096",  "flop", 2.0*N,
+         [U, V]() { bench_sink = bench_sink + U->dot( *V ); } );
+  B.add( "vector.norm.4096", "flop", 2.0*N,
+         [U]()    { bench_sink = bench_sink + U->norm(); } );
+}
+
+
+// =======================================================================================
+/** @brief Summation cases.
+ */
+// ---------------------------------------------------------------------------------------
+void summation_cases( Bench& B ) {
+  // -------------------------------------------------------------------------------------
+  const size_t n = 65536;
+  std::shared_ptr<std::vector<real8_t> > X( new std::vector<real8_t>( n ) );
+  std::shared_ptr<std::vector<real8_t> > W( new std::vector<real8_t>( n ) );
+  fill( X->data(), n, 11 );
+  fill( W->data(), n, 12 );
+  for ( size_t i=0; i<n; i++ ) {
+    (*W)[i] = 3.0 * ( (*W)[i] + 1.0 );  // angles in [0, 6)
+  }
+  const real8_t N = static_cast<real8_t>( n );
+  B.add( "summation.sum.64k",   "elem", N,
+         [X]() { bench_sink = bench_sink + sum( X->data(), X->size() ); } );
+  B.add( "summation.sumsq.64k", "elem", N,
+         [X]() { bench_sink = bench_sink + sumsq( X->data(), X->size() ); } );
+  B.add( "summation.sum_kahan.64k", "elem", N,
+         [X]() { bench_sink = bench_sink + sumKahan( X->data(), X->size() ); } );
+  B.add( "summation.sum_pairwise.64k", "elem", N,
+         [X]() { bench_sink = bench_sink + sumPairwise( X->data(), X->size() ); } );
+  B.add( "summation.sumsq_kahan.64k", "elem", N,
+         [X]() { bench_sink = bench_sink + sumsqKahan( X->data(), X->size() ); } );
+  B.add( "summation.com_rad.64k", "elem", N,
+         [X, W]() {
+           bench_sink = bench_sink + centerOfMassRad( X->data(), W->data(), X->size() ); } );
+
+  const size_t nseg = 1024;
+  std::shared_ptr<std::vector<size_t> >  O( new std::vector<size_t>( nseg+1 ) );
+  std::shared_ptr<std::vector<real8_t> > C( new std::vector<real8_t>( nseg ) );
+  for ( size_t k=0; k<=nseg; k++ ) { (*O)[k] = ( k * n ) / nseg; }
+  B.add( "summation.com_rad_seg.1k_x_64", "elem", N,
+         [X, W, O, C]() {
+           centerOfMassRad( C->data(), X->data(), W->data(), O->data(), C->size() );
+           bench_sink = bench_sink + (*C)[0]; } );
+}
+
+
+// =======================================================================================
+/** @brief Random number cases.
+ */
+// ---------------------------------------------------------------------------------------
+void random_cases( Bench& B ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t n = 4096;
+  u_int64_t seed[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+  Entropy* ent = Entropy::DEFAULT();
+  ent->seed_set( seed, sizeof(seed) );
+  Dice* dd = Dice::getInstance();
+  dd->seed_set( seed, sizeof(seed) );
+  const real8_t N = static_cast<real8_t>( n );
+  B.add( "entropy.U32",  "draw", N, [ent]() {
+      u_int32_t s = 0;
+      for ( int32_t i=0; i<n; i++ ) { s ^= ent->U32(); }
+      bench_sink = bench_sink + static_cast<real8_t>( s ); } );
+  B.add( "entropy.R64",  "draw", N, [ent]() {
+      real8_t s = 0.0;
+      for ( int32_t i=0; i<n; i++ ) { s += ent->R64(); }
+      bench_sink = bench_sink + s; } );
+  B.add( "dice.uniform", "draw", N, [dd]() {
+      real8_t s = 0.0;
+      for ( int32_t i=0; i<n; i++ ) { s += dd->uniform(); }
+      bench_sink = bench_sink + s; } );
+  B.add( "dice.normal",  "draw", N, [dd]() {
+      real8_t s = 0.0;
+      for ( int32_t i=0; i<n; i++ ) { s += dd->normal(); }
+      bench_sink = bench_sink + s; } );
+}
+
+
+// =======================================================================================
+/** @brief KD-tree cases.
+ */
+// ---------------------------------------------------------------------------------------
+void kdtree_cases( Bench& B ) {
+  // -------------------------------------------------------------------------------------
+  const size_t np = 10000;
+  const size_t nq = 256;
+  pointVec pts( np, point_t( 3 ) );
+  for ( size_t i=0; i<np; i++ ) { fill( pts[i].data(), 3, 5000+i ); }
+
+  std::shared_ptr<pointVec> Q( new pointVec( nq, point_t( 3 ) ) );
+  for ( size_t i=0; i<nq; i++ ) { fill( (*Q)[i].data(), 3, 90000+i ); }
+
+  std::shared_ptr<KDTree> T( new KDTree( pts ) );
+
+  B.add( "kdtree.build.10k",   "point", static_cast<real8_t>( np ), [pts]() {
+      KDTree t( pts );
+      bench_sink = bench_sink + static_cast<real8_t>( t.nearest_index( pts[0] ) ); } );
+  B.add( "kdtree.nearest.10k", "query", static_cast<real8_t>( nq ), [T, Q]() {
+      size_t s = 0;
+      for ( size_t i=0; i<Q->size(); i++ ) { s += T->nearest_index( (*Q)[i] ); }
+      bench_sink = bench_sink + static_cast<real8_t>( s ); } );
+}
+
+
+// =======================================================================================
+/** @brief Statistics cases.
+ */
+// ---------------------------------------------------------------------------------------
+void statistics_cases( Bench& B ) {
+  // -------------------------------------------------------------------------------------
+  const size_t n = 65536;
+  std::shared_ptr<std::vector<real8_t> > X( new std::vector<real8_t>( n ) );
+  fill( X->data(), n, 21 );
+  const real8_t N = static_cast<real8_t>( n );
+  B.add( "statistics.moments.64k",  "sample", N, [X]() {
+      Statistics::moments M;
+      M.batch( X->data(), static_cast<int64_t>( X->size() ) );
+      bench_sink = bench_sink + M.var(); } );
+  B.add( "statistics.quantile.64k", "sample", N, [X]() {
+      Statistics::quantile Q( 200, 7 );
+      Q.batch( X->data(), static_cast<int64_t>( X->size() ) );
+      bench_sink = bench_sink + Q.maxv(); } );
+}
+
+
+// =======================================================================================
+/** @brief Table cases.
+ *
+ *  The table is written once to temporary ASCII and binary files that are removed at
+ *  exit.
+ */
+// ---------------------------------------------------------------------------------------
+void table_cases( Bench& B ) {
+  // -------------------------------------------------------------------------------------
+  static char fspc[] = "/tmp/bench_table_XXXXXX";
+  static char bspc[] = "/tmp/bench_tablb_XXXXXX";
+  const int fd = mkstemp( fspc );
+  if ( 0 > fd ) { return; }
+  close( fd );
+  const int bd = mkstemp( bspc );
+  if ( 0 > bd ) { unlink( fspc ); return; }
+  close( bd );
+
+  const int32_t ns = 2000;
+  const int32_t nv = 8;
+  {
+    Table tab( ns, nv );
+    real8_t a[nv];
+    for ( int32_t i=0; i<ns; i++ ) {
+      fill( a, static_cast<size_t>( nv ), static_cast<u_int64_t>( 300+i ) );
+      for ( int32_t j=0; j<nv; j++ ) { tab(i,j) = a[j]; }
+    }
+    tab.write_ascii( std::string( fspc ) );
+    tab.write_binary( std::string( bspc ) );
+  }
+  atexit( []() { unlink( fspc ); unlink( bspc ); } );
+
+  B.add( "table.read_ascii.2000x8", "value", static_cast<real8_t>( ns*nv ), []() {
+      Table tab;
+      tab.read_ascii( std::string( fspc ) );
+      bench_sink = bench_sink + tab(0,0); } );
+  B.add( "table.read_binary.2000x8", "value", static_cast<real8_t>( ns*nv ), []() {
+      Table tab;
+      tab.read_binary( std::string( bspc ) );
+      bench_sink = bench_sink + tab(0,0); } );
+  B.add( "table.map.2000x8", "value", static_cast<real8_t>( ns*nv ), []() {
+      Table tab;
+      tab.map( std::string( bspc ) );
+      bench_sink = bench_sink + tab.col(7)[ns-1]; } );
+}
+
+
+// =======================================================================================
+/** @brief CSV cases.
+ *
+ *  Compare the record reader with the columnar reader on one numeric column.
+ */
+// ---------------------------------------------------------------------------------------
+void csv_cases( Bench& B ) {
+  // -------------------------------------------------------------------------------------
+  static char fspc[] = "/tmp/bench_csv_XXXXXX";
+  const int fd = mkstemp( fspc );
+  if ( 0 > fd ) { return; }
+
+  const size_t nr = 5000;
+  const size_t nf = 6;
+  {
+    FILE*   fp = fdopen( fd, "w" );
+    real8_t a[nf];
+    fprintf( fp, "a,b,c,d,e,f\n" );
+    for ( size_t i=0; i<nr; i++ ) {
+      fill( a, nf, 900+i );
+      for ( size_t j=0; j<nf; j++ ) {
+        fprintf( fp, "%s%.17g", ( (0==j) ? "" : "," ), a[j] );
+      }
+      fprintf( fp, "\n" );
+    }
+    fclose( fp );
+  }
+  atexit( []() { unlink( fspc ); } );
+
+  B.add( "csv.csvfile.column.5000x6", "record", static_cast<real8_t>( nr ), []() {
+      const std::string path( fspc );
+      CSVFile C( path );
+      real8_t s = D_ZERO;
+      for ( size_t i=0; i<C.size(); i++ ) { s += C.getReal8( i, 3 ); }
+      bench_sink = bench_sink + s; } );
+  B.add( "csv.csvtable.column.5000x6", "record", static_cast<real8_t>( nr ), []() {
+      const std::string path( fspc );
+      CSVTable       C( path );
+      const real8_t* x = C.real8Column( 3 );
+      real8_t        s = D_ZERO;
+      for ( size_t i=0; i<C.size(); i++ ) { s += x[i]; }
+      bench_sink = bench_sink + s; } );
+}
+
+
+// =======================================================================================
+/** @brief Fuzzy cases.
+ *
+ *  Fuzzify and defuzzify a table of samples through the Group one sample at a time and
+ *  through a compiled Kernel in one batch.
+ */
+// ---------------------------------------------------------------------------------------
+void fuzzy_cases( Bench& B ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t ns = 20000;
+  const int32_t ni = 4;
+  const int32_t np = 7;
+
+  std::shared_ptr<fuzzy::Group> G( new fuzzy::Group( ni ) );
+  for ( int32_t i=0; i<ni; i++ ) {
+    fuzzy::Partition P( np, -D_ONE, D_ONE );
+    G->set( i, P );
+  }
+  std::shared_ptr<fuzzy::Kernel> K( new fuzzy::Kernel( *G ) );
+
+  std::shared_ptr<Table> X( new Table( ns, ni ) );
+  std::shared_ptr<Table> M( new Table( ns, ni*np ) );
+  for ( int32_t i=0; i<ni; i++ ) {
+    fill( X->col(i), static_cast<size_t>( ns ), static_cast<u_int64_t>( 1100+i ) );
+  }
+
+  B.add( "fuzzy.group.fuzzify.20000x4x7", "sample", static_cast<real8_t>( ns ),
+         [G, X, M]() {
+           real8_t x[ni];
+           real8_t mu[ni*np];
+           for ( int32_t s=0; s<ns; s++ ) {
+             for ( int32_t i=0; i<ni; i++ ) { x[i] = (*X)(s,i); }
+             G->fuzzify( mu, x );
+             for ( int32_t j=0; j<ni*np; j++ ) { (*M)(s,j) = mu[j]; }
+           }
+           bench_sink = bench_sink + (*M)(ns-1,0); } );
+  B.add( "fuzzy.kernel.fuzzify.20000x4x7", "sample", static_cast<real8_t>( ns ),
+         [K, X, M]() {
+           K->fuzzify( *M, *X );
+           bench_sink = bench_sink + (*M)(ns-1,0); } );
+
+  K->fuzzify( *M, *X );
+  std::shared_ptr<Table> Y( new Table( ns, ni ) );
+
+  B.add( "fuzzy.group.defuzzify.20000x4x7", "sample", static_cast<real8_t>( ns ),
+         [G, Y, M]() {
+           real8_t mu[ni*np];
+           real8_t y[ni];
+           for ( int32_t s=0; s<ns; s++ ) {
+             for ( int32_t j=0; j<ni*np; j++ ) { mu[j] = (*M)(s,j); }
+             G->defuzzify( y, mu );
+             for ( int32_t i=0; i<ni; i++ ) { (*Y)(s,i) = y[i]; }
+           }
+           bench_sink = bench_sink + (*Y)(ns-1,0); } );
+  B.add( "fuzzy.kernel.defuzzify.20000x4x7", "sample", static_cast<real8_t>( ns ),
+         [K, Y, M]() {
+           K->defuzzify( *Y, *M );
+           bench_sink = bench_sink + (*Y)(ns-1,0); } );
+
+  std::shared_ptr<fuzzy::RuleBase> R( new fuzzy::RuleBase( *G, 1 ) );
+  {
+    std::vector<real8_t> c( static_cast<size_t>( R->size() ) );
+    fill( c.data(), c.size(), 1200 );
+    R->load( c.data() );
+  }
+
+  B.add( "fuzzy.rulebase.tsk.20000x4x7", "sample", static_cast<real8_t>( ns ),
+         [R, X, Y]() {
+           R->evaluate( *Y, *X );
+           bench_sink = bench_sink + (*Y)(ns-1,0); } );
+}
+
+
+// =======================================================================================
+/** @brief Damped oscillator for the integrator cases, state (x, v).
+ */
+// ---------------------------------------------------------------------------------------
+class Oscillator : public DOPRI5 {
+  // -------------------------------------------------------------------------------------
+ public:
+  Oscillator( void ) : DOPRI5(2) {};
+  virtual ~Oscillator( void ) {};
+  virtual int  check( real8_t*, real8_t, real8_t* ) { return 0; }
+  virtual void difeq( real8_t* Qd, real8_t* Q, real8_t, real8_t* P ) {
+    Qd[0] = Q[1];
+    Qd[1] = -P[0]*Q[0] - P[1]*Q[1];
+  }
+}; // end class Oscillator
+
+
+// =======================================================================================
+/** @brief Integrator cases.
+ *
+ *  Integrate 256 trajectories one at a time with the fixed step RK4 and the adaptive
+ *  integrator, then all together with the ensemble.
+ */
+// ---------------------------------------------------------------------------------------
+void ode_cases( Bench& B ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t n = 256;
+  std::shared_ptr<Oscillator>           I( new Oscillator() );
+  std::shared_ptr<std::vector<real8_t>> Q0( new std::vector<real8_t>( 2*n ) );
+  std::shared_ptr<std::vector<real8_t>> Q(  new std::vector<real8_t>( 2*n ) );
+  fill( Q0->data(), Q0->size(), 1300 );
+  I->tolerance( 1.0e-8, 1.0e-10 );
+
+  B.add( "ode.rk4.fixed.256x2000", "trajectory", static_cast<real8_t>( n ),
+         [I, Q0, Q]() {
+           real8_t P[] = { 4.0, 0.1 };
+           for ( int32_t m=0; m<n; m++ ) {
+             real8_t q[] = { (*Q0)[m], (*Q0)[n+m] };
+             I->integrate( q, 0.0, 20.0, 2000, P );
+             (*Q)[m] = q[0];
+           }
+           bench_sink = bench_sink + (*Q)[0]; } );
+  B.add( "ode.dopri5.adaptive.256", "trajectory", static_cast<real8_t>( n ),
+         [I, Q0, Q]() {
+           real8_t P[] = { 4.0, 0.1 };
+           for ( int32_t m=0; m<n; m++ ) {
+             real8_t q[] = { (*Q0)[m], (*Q0)[n+m] };
+             I->integrate( q, 0.0, 20.0, P );
+             (*Q)[m] = q[0];
+           }
+           bench_sink = bench_sink + (*Q)[0]; } );
+  B.add( "ode.dopri5.ensemble.256", "trajectory", static_cast<real8_t>( n ),
+         [I, Q0, Q]() {
+           real8_t P[] = { 4.0, 0.1 };
+           *Q = *Q0;
+           I->ensemble( Q->data(), n, 0.0, 20.0, P );
+           bench_sink = bench_sink + (*Q)[0]; } );
+}
+
+
+// =======================================================================================
+/** @brief Timestamp cases.
+ *
+ *  Parse and format 65536 fixed width ISO-8601 timestamps in bulk, against the
+ *  one at a time ISO8601 parser on the same records.
+ */
+// ---------------------------------------------------------------------------------------
+void time_cases( Bench& B ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t n      = 65536;
+  const size_t  stride = 25;
+  std::shared_ptr<std::vector<real8_t>> T( new std::vector<real8_t>( n ) );
+  std::shared_ptr<std::vector<char>>    S( new std::vector<char>( n*stride, '\n' ) );
+  fill( T->data(), T->size(), 1500 );
+  for ( int32_t i=0; i<n; i++ ) {
+    (*T)[i] = std::round( 1.6e12 + 1.0e12*(*T)[i] ) * 1.0e-3;
+  }
+  AbsoluteDate::format( S->data(), stride, T->data(), n );
+
+  B.add( "time.absolute.parse", "timestamp", static_cast<real8_t>( n ),
+         [T, S]() {
+           AbsoluteDate::parse( T->data(), S->data(), stride, n );
+           bench_sink = bench_sink + (*T)[0]; } );
+  B.add( "time.absolute.format", "timestamp", static_cast<real8_t>( n ),
+         [T, S]() {
+           AbsoluteDate::format( S->data(), stride, T->data(), n );
+           bench_sink = bench_sink + static_cast<real8_t>( (*S)[5] ); } );
+  B.add( "time.iso8601.fromstring", "timestamp", 1024.0,
+         [S]() {
+           ISO8601 iso;
+           for ( int32_t i=0; i<1024; i++ ) {
+             iso.fromString( std::string( S->data() + static_cast<size_t>(i)*stride, 24 ) );
+           }
+           bench_sink = bench_sink + iso.getSecond(); } );
+}
+
+
+// =======================================================================================
+/** @brief Ephemeris cases.
+ *
+ *  Heliocentric states of Mars at 4096 dates over ten years, from the mean elements
+ *  and from the Chebyshev cache.
+ */
+// ---------------------------------------------------------------------------------------
+void orrey_cases( Bench& B ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t n = 4096;
+  std::shared_ptr<Orrey>                O(  new Orrey() );
+  std::shared_ptr<std::vector<real8_t>> JD( new std::vector<real8_t>( n ) );
+  std::shared_ptr<std::vector<real8_t>> S(  new std::vector<real8_t>( 6*n ) );
+  fill( JD->data(), JD->size(), 1400 );
+  for ( int32_t i=0; i<n; i++ ) {
+    (*JD)[i] = 2455000.0 + 1826.0*( (*JD)[i] + 1.0 );
+  }
+  O->cache( 2455000.0, 2455000.0 + 3653.0 );
+
+  B.add( "astro.orrey.kepler", "state", static_cast<real8_t>( n ),
+         [O, JD, S]() {
+           for ( int32_t i=0; i<n; i++ ) {
+             O->kepler( MARS, (*JD)[i], S->data() + 6*i );
+           }
+           bench_sink = bench_sink + (*S)[0]; } );
+  B.add( "astro.orrey.cached", "state", static_cast<real8_t>( n ),
+         [O, JD, S]() {
+           for ( int32_t i=0; i<n; i++ ) {
+             O->state( MARS, (*JD)[i], S->data() + 6*i );
+           }
+           bench_sink = bench_sink + (*S)[0]; } );
+  B.add( "astro.orrey.batch", "state", static_cast<real8_t>( n ),
+         [O, JD, S]() {
+           O->state( MARS, JD->data(), n, S->data() );
+           bench_sink = bench_sink + (*S)[0]; } );
+}
+
+
+// =======================================================================================
+/** @brief Neural network layer cases.
+ */
+// ---------------------------------------------------------------------------------------
+void layer_cases( Bench& B ) {
+  // -------------------------------------------------------------------------------------
+  const size_t nc = 64;
+  const size_t nn = 32;
+  const size_t bs = 64;
+
+  std::shared_ptr<nns::Layer> L( nns::Layer::Builder().IO( nc, nn ).activate( "sigmoid" )
+                                 .batch( bs ).build() );
+  L->initialize();
+
+  std::shared_ptr<real8_t*> X( C2DArray::build( bs, nc ), C2DArray::del );
+  for ( size_t i=0; i<bs; i++ ) { fill( X.get()[i], nc, 700+i ); }
+
+  B.add( "nns.layer.forward.64x32x64", "flop",
+         static_cast<real8_t>( 2*nc*nn*bs ), [L, X]() {
+           L->forward( X.get(), bs );
+           bench_sink = bench_sink + L->output()[0][0]; } );
+}
+
+
+} // end namespace
+
+
+// =======================================================================================
+/** @brief Register every kernel.
+ *  @param B benchmark runner.
+ */
+// ---------------------------------------------------------------------------------------
+void register_kernels( Bench& B ) {
+  // -------------------------------------------------------------------------------------
+  matrix_cases( B );
+  vector_cases( B );
+  summation_cases( B );
+  random_cases( B );
+  kdtree_cases( B );
+  statistics_cases( B );
+  table_cases( B );
+  csv_cases( B );
+  fuzzy_cases( B );
+  ode_cases( B );
+  time_cases( B );
+  orrey_cases( B );
+  layer_cases( B );
+}
+
+
+// =======================================================================================
+// **                             B E N C H _ K E R N E L S                             **
+// ======================================================================== END FILE =====
@@ -102,6 +102,20 @@ class AbsoluteDate {
   
   void        fromString   ( std::string str );
   std::string toString     ( void ) const;
+
+  // ----- bulk conversion of epoch seconds ---------------
+
+  static const int32_t ISO_LENGTH = 24; ///< length of YYYY-MM-DDThh:mm:ss.sssZ
+
+  static bool    parse  ( real8_t& sec, const char* str, const size_t len );
+  static int32_t parse  ( real8_t* sec, const char* buf, const size_t stride,
+                          const int32_t n );
+  static int32_t parse  ( real8_t* sec, const char* const* str, const size_t* len,
+                          const int32_t n );
+
+  static size_t  format ( char* buf, const real8_t sec );
+  static void    format ( char* buf, const size_t stride, const real8_t* sec,
+                          const int32_t n );
   
 }; // end class AbsoluteDate
 
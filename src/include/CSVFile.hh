@@ -39,6 +39,7 @@
 
 #include <TLogger.hh>
 #include <StringTool.hh>
+#include <ParseTool.hh>
 
 // =======================================================================================
 class CSVFile {
@@ -84,6 +85,8 @@ class CSVFile {
 
   Record* append( void );
 
+  static real8_t asReal8( const std::string& str );
+
  public:
   CSVFile            ( std::string fspc );
   ~CSVFile           ( void );
@@ -210,11 +213,32 @@ inline  int32_t CSVFile::getInt32( size_t recn, size_t fldn ) {
 }
 
 
+// =======================================================================================
+/** @brief Convert a field.
+ *  @param[in] str field text.
+ *  @return value of the field.
+ *
+ *  Fields that hold exactly one number use ParseTool; anything else is left to
+ *  StringTool::asReal8, which keeps its error reporting.
+ */
+// ---------------------------------------------------------------------------------------
+inline  real8_t CSVFile::asReal8( const std::string& str ) {
+  // -------------------------------------------------------------------------------------
+  const char* e = str.data() + str.size();
+  real8_t     x = D_ZERO;
+  const char* r = ParseTool::real8( ParseTool::skip( str.data(), e ), e, x );
+  if ( ( static_cast<const char*>(0) != r ) && ( e == ParseTool::skip( r, e ) ) ) {
+    return x;
+  }
+  return StringTool::asReal8( str );
+}
+
+
 // =======================================================================================
 // ---------------------------------------------------------------------------------------
 inline  real8_t CSVFile::getReal8( size_t recn, size_t fldn ) {
   // -------------------------------------------------------------------------------------
-  return StringTool::asReal8( this->get( recn, fldn ) );
+  return asReal8( index[recn]->at( fldn ) );
 }
 
 
@@ -240,7 +264,7 @@ inline  int32_t CSVFile::getInt32( size_t recn, std::string label ) {
 // ---------------------------------------------------------------------------------------
 inline  real8_t CSVFile::getReal8( size_t recn, std::string label ) {
   // -------------------------------------------------------------------------------------
-  return StringTool::asReal8( this->get( recn, label ) );
+  return asReal8( index[recn]->at( head_label->find(label) ) );
 }
 
 
@@ -0,0 +1,209 @@
+// ====================================================================== BEGIN FILE =====
+// **                                  C S V T A B L E                                  **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Columnar CSV reader.
+ *  @file   CSVTable.hh
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18.
+ *
+ *  Provides the interface for a columnar CSV reader.
+ *
+ *  The file stays in one mapped buffer. Reading it records only the offset and length of
+ *  every field, so records and fields are reached in constant time without allocating a
+ *  string per field. Columns are converted to numeric arrays on request, in parallel, and
+ *  cached until release(). As with CSVFile, the first line holds the labels, fields are
+ *  separated by commas and quoting is not interpreted.
+ *
+ *  Column conversion fills the cache and is not thread safe; the const accessors are.
+ */
+// =======================================================================================
+
+#ifndef __HH_CSVTABLE_TRNCMP
+#define __HH_CSVTABLE_TRNCMP
+
+#include <TLogger.hh>
+#include <ParseTool.hh>
+#include <vector>
+
+// =======================================================================================
+class CSVTable {
+  // -------------------------------------------------------------------------------------
+ private:
+  CSVTable( const CSVTable& );
+  CSVTable& operator=( const CSVTable& );
+
+ protected:
+  ParseTool::Buffer*                  buf;          ///< raw file
+  size_t                              num_fields;   ///< fields per record
+  size_t                              num_records;  ///< records after the label line
+  std::vector<std::string>            labels;       ///< field labels
+  std::vector<u_int64_t>              start;        ///< offset of field [r*num_fields+f]
+  std::vector<u_int32_t>              length;       ///< length of field [r*num_fields+f]
+  std::vector< std::vector<real8_t> > real_col;     ///< converted real columns
+  std::vector< std::vector<int64_t> > int_col;      ///< converted integer columns
+
+  TLOGGER_HEADER( logger );
+
+ public:
+  static size_t NOT_FOUND;
+
+  CSVTable  ( const std::string fspc );
+  ~CSVTable ( void );
+
+  bool           bad         ( void ) const;
+  size_t         size        ( const int dim=0 ) const;
+  std::string    header      ( const size_t idx ) const;
+  size_t         find        ( const std::string label ) const;
+
+  const char*    field       ( const size_t recn, const size_t fldn, size_t& len ) const;
+  std::string    get         ( const size_t recn, const size_t fldn ) const;
+  std::string    get         ( const size_t recn, const std::string label ) const;
+  real8_t        getReal8    ( const size_t recn, const size_t fldn ) const;
+  int64_t        getInt64    ( const size_t recn, const size_t fldn ) const;
+
+  const real8_t* real8Column ( const size_t fldn );
+  const real8_t* real8Column ( const std::string label );
+  const int64_t* int64Column ( const size_t fldn );
+  const int64_t* int64Column ( const std::string label );
+  void           release     ( void );
+
+}; // end class CSVTable
+
+
+// =======================================================================================
+/** @brief Bad.
+ *  @return true if the file could not be read.
+ */
+// ---------------------------------------------------------------------------------------
+inline  bool CSVTable::bad( void ) const {
+  // -------------------------------------------------------------------------------------
+  return buf->bad();
+}
+
+
+// =======================================================================================
+/** @brief Size.
+ *  @param[in] dim 0 for the number of records, otherwise the number of fields.
+ *  @return requested size.
+ */
+// ---------------------------------------------------------------------------------------
+inline  size_t CSVTable::size( const int dim ) const {
+  // -------------------------------------------------------------------------------------
+  return ((0==dim) ? (num_records) : (num_fields));
+}
+
+
+// =======================================================================================
+/** @brief Header.
+ *  @param[in] idx field index.
+ *  @return label of the field.
+ */
+// ---------------------------------------------------------------------------------------
+inline  std::string CSVTable::header( const size_t idx ) const {
+  // -------------------------------------------------------------------------------------
+  return labels[idx];
+}
+
+
+// =======================================================================================
+/** @brief Field.
+ *  @param[in]  recn record index.
+ *  @param[in]  fldn field index.
+ *  @param[out] len  number of characters in the field.
+ *  @return pointer to the first character of the field in the file buffer.
+ *
+ *  The field is not null terminated.
+ */
+// ---------------------------------------------------------------------------------------
+inline  const char* CSVTable::field( const size_t recn, const size_t fldn, size_t& len ) const {
+  // -------------------------------------------------------------------------------------
+  const size_t k = recn*num_fields + fldn;
+  len = length[k];
+  return buf->begin() + start[k];
+}
+
+
+// =======================================================================================
+/** @brief Get.
+ *  @param[in] recn record index.
+ *  @param[in] fldn field index.
+ *  @return copy of the field.
+ */
+// ---------------------------------------------------------------------------------------
+inline  std::string CSVTable::get( const size_t recn, const size_t fldn ) const {
+  // -------------------------------------------------------------------------------------
+  size_t      n = 0;
+  const char* p = field( recn, fldn, n );
+  return std::string( p, n );
+}
+
+
+// =======================================================================================
+/** @brief Get.
+ *  @param[in] recn  record index.
+ *  @param[in] label field label.
+ *  @return copy of the field, or an empty string if there is no such field.
+ */
+// ---------------------------------------------------------------------------------------
+inline  std::string CSVTable::get( const size_t recn, const std::string label ) const {
+  // -------------------------------------------------------------------------------------
+  const size_t f = find( label );
+  return ( NOT_FOUND == f ) ? std::string() : get( recn, f );
+}
+
+
+// =======================================================================================
+/** @brief Real8 column.
+ *  @param[in] label field label.
+ *  @return converted column, or null if there is no such field.
+ */
+// ---------------------------------------------------------------------------------------
+inline  const real8_t* CSVTable::real8Column( const std::string label ) {
+  // -------------------------------------------------------------------------------------
+  const size_t f = find( label );
+  return ( NOT_FOUND == f ) ? static_cast<const real8_t*>(0) : real8Column( f );
+}
+
+
+// =======================================================================================
+/** @brief Int64 column.
+ *  @param[in] label field label.
+ *  @return converted column, or null if there is no such field.
+ */
+// ---------------------------------------------------------------------------------------
+inline  const int64_t* CSVTable::int64Column( const std::string label ) {
+  // -------------------------------------------------------------------------------------
+  const size_t f = find( label );
+  return ( NOT_FOUND == f ) ? static_cast<const int64_t*>(0) : int64Column( f );
+}
+
+
+#endif
+
+
+// =======================================================================================
+// **                                  C S V T A B L E                                  **
+// ======================================================================== END FILE =====
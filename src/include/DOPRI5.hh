@@ -0,0 +1,133 @@
+// ====================================================================== BEGIN FILE =====
+// **                                    D O P R I 5                                    **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Dormand-Prince.
+ *  @file   DOPRI5.hh
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides the abstract interface for an adaptive Dormand-Prince 5(4) numerical
+ *  integrator.
+ *
+ *  DOPRI5 is an RK4 and keeps its check/difeq interface and its fixed step integrate().
+ *  The adaptive integrate() adds the following:
+ *
+ *    - Error control on the embedded fourth order solution, with the step size
+ *      controller of Hairer, Norsett and Wanner. The seventh stage of one step is the
+ *      first stage of the next (FSAL).
+ *    - Fourth order dense output over the last accepted step. dense() reads it, and an
+ *      overload samples the solution at a list of output times.
+ *    - Event detection. A sign change of event() over a step is located on the dense
+ *      output, and integration stops at the root.
+ *
+ *  ensemble() integrates many independent initial conditions held in SoA layout, with
+ *  component j of member m at Q[j*n+m]. Blocks of members are integrated in parallel on
+ *  the global ThreadPool, and each block shares one adaptive step. difeqBlock()
+ *  evaluates a whole block. The default gathers each member and calls difeq, and a
+ *  vectorised override can replace it. In ensemble mode difeq and difeqBlock run
+ *  concurrently, so they must not modify the object or P. check() and event() are not
+ *  used there.
+ */
+// =======================================================================================
+
+#ifndef __HH_DOPRI5_TRNCMP
+#define __HH_DOPRI5_TRNCMP
+
+#include <RK4.hh>
+
+// =======================================================================================
+class DOPRI5 : public RK4 {
+  // -------------------------------------------------------------------------------------
+ protected:
+  real8_t* E;        ///< stage five  derivative.
+  real8_t* F;        ///< stage six   derivative.
+  real8_t* G;        ///< stage seven derivative (first stage of the next step).
+  real8_t* Y;        ///< state at the end of the step.
+  real8_t* R;        ///< dense output coefficients (5 x dim).
+
+  real8_t  rtol;     ///< relative error tolerance.
+  real8_t  atol;     ///< absolute error tolerance.
+  real8_t  hmax;     ///< largest step size (zero for no limit).
+  real8_t  hinit;    ///< initial step size (zero to estimate it).
+  int32_t  max_step; ///< largest number of steps per call.
+
+  real8_t  t_old;    ///< start of the last accepted step.
+  real8_t  h_old;    ///< size of the last accepted step.
+
+  int32_t  n_eval;   ///< derivative evaluations in the last call.
+  int32_t  n_accept; ///< accepted steps in the last call.
+  int32_t  n_reject; ///< rejected steps in the last call.
+
+  EMPTY_PROTOTYPE( DOPRI5 );
+
+  real8_t  initial_step ( real8_t* Q, real8_t t, real8_t h_end, real8_t* P );
+  real8_t  step         ( real8_t* Q, real8_t t, real8_t h, real8_t* P );
+
+ public:
+  DOPRI5             ( int32_t n );
+  virtual ~DOPRI5    ( void );
+
+  using RK4::integrate;
+
+  void    tolerance  ( const real8_t rel, const real8_t abs );
+  void    limits     ( const real8_t h0, const real8_t hmx, const int32_t nmax );
+
+  real8_t integrate  ( real8_t* Q, real8_t t0, real8_t t1, real8_t* P );
+  real8_t integrate  ( real8_t* Q, real8_t t0, real8_t t1, real8_t* P,
+                       const real8_t* tout, const int32_t nout, real8_t* Qout );
+
+  void    dense      ( real8_t* Qt, const real8_t t ) const;
+  real8_t ensemble   ( real8_t* Q, const int32_t n, real8_t t0, real8_t t1, real8_t* P,
+                       real8_t* T = static_cast<real8_t*>(0) );
+
+  int32_t nEval      ( void ) const { return n_eval;   } ///< derivative evaluations.
+  int32_t nAccept    ( void ) const { return n_accept; } ///< accepted steps.
+  int32_t nReject    ( void ) const { return n_reject; } ///< rejected steps.
+
+  // =====================================================================================
+  /** @brief Event function.
+   *  @param[in] Q current state vector.
+   *  @param[in] t current time.
+   *  @param[in] P parameter vector.
+   *  @return value whose sign change marks an event.
+   *
+   *  The default never changes sign.
+   */
+  // -------------------------------------------------------------------------------------
+  virtual real8_t event( real8_t*, real8_t, real8_t* ) { return D_ONE; }
+  // -------------------------------------------------------------------------------------
+
+
+  virtual void difeqBlock( real8_t* Qd, real8_t* Q, int32_t n, real8_t t, real8_t* P );
+
+}; // end class DOPRI5
+
+#endif
+
+
+// =======================================================================================
+// **                                    D O P R I 5                                    **
+// ======================================================================== END FILE =====
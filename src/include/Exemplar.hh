@@ -122,12 +122,14 @@ class Exemplar {                                                               /
   
   void destroy( void );
 
-  static bool read_pair    ( std::ifstream& inf,
+  static bool read_pair    ( const char* p, const char* e,
                              Data& idat, const int32_t ns, const int32_t ni,
                              Data& odat, const int32_t no );
   
-  static bool read_single  ( std::ifstream& inf,
+  static bool read_single  ( const char* p, const char* e,
                              Data& idat, const int32_t ns, const int32_t ni );
+
+  bool        read_data    ( const std::string df, const size_t offset, const Meta& meta );
   
   static bool write_pair   ( std::ofstream& outf, Data& idat, Data& odat,
                              std::string ifmt = DEFAULT_EDIT_DES,
@@ -0,0 +1,103 @@
+// ====================================================================== BEGIN FILE =====
+// **                                      H 5 I O                                      **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  HDF5 input and output.
+ *  @file   H5IO.hh
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18.
+ *
+ *  Provides chunked, optionally compressed, HDF5 storage for Table, Matrix and Exemplar.
+ *
+ *  Every object is stored as a two dimensional real8_t dataset of shape (rows, columns)
+ *  in row major order, the layout expected by other HDF5 readers. A Table or Matrix is
+ *  one dataset. An Exemplar is a group holding an "input" dataset, an optional "output"
+ *  dataset and the attributes n_sample, n_input and n_output that make up its Meta.
+ *
+ *  The row dimension is unlimited so a dataset can grow with append(), and every read
+ *  accepts a row range so large files can be streamed in pieces. Writing opens an
+ *  existing file and replaces only the named dataset, so several objects can share one
+ *  file. Intermediate groups in a dataset path are created as needed.
+ *
+ *  The serial HDF5 library is not thread safe; callers sharing a file across threads
+ *  must serialize access.
+ */
+// =======================================================================================
+
+#ifndef __HH_H5IO_TRNCMP
+#define __HH_H5IO_TRNCMP
+
+#include <Table.hh>
+#include <Matrix.hh>
+#include <Exemplar.hh>
+
+namespace H5IO {
+
+
+// =======================================================================================
+/** @brief Dataset creation options.
+ */
+// ---------------------------------------------------------------------------------------
+struct Options {
+  int32_t chunk_rows;  ///< rows per chunk
+  int32_t deflate;     ///< gzip level 1-9, 0 for none
+  bool    shuffle;     ///< byte shuffle before deflate
+
+  Options( const int32_t cr=1024, const int32_t dl=0, const bool sh=true )
+      : chunk_rows(cr), deflate(dl), shuffle(sh) {}
+};
+
+
+bool shape     ( int32_t& nrow, int32_t& ncol,
+                 const std::string fspc, const std::string dset );
+
+bool write     ( const std::string fspc, const std::string dset, const Table& tab,
+                 const Options& opt = Options() );
+bool append    ( const std::string fspc, const std::string dset, const Table& tab,
+                 const Options& opt = Options() );
+bool read      ( Table& tab, const std::string fspc, const std::string dset,
+                 const int32_t first=0, const int32_t count=-1 );
+
+bool write     ( const std::string fspc, const std::string dset, Matrix& mat,
+                 const Options& opt = Options() );
+bool read      ( Matrix& mat, const std::string fspc, const std::string dset,
+                 const int32_t first=0, const int32_t count=-1 );
+
+bool write     ( const std::string fspc, const std::string group, Exemplar& ex,
+                 const Options& opt = Options() );
+bool read      ( Exemplar& ex, const std::string fspc, const std::string group,
+                 const int32_t first=0, const int32_t count=-1 );
+bool read_meta ( Exemplar::Meta& meta, const std::string fspc, const std::string group );
+
+
+}; // end namespace H5IO
+
+
+#endif
+
+
+// =======================================================================================
+// **                                      H 5 I O                                      **
+// ======================================================================== END FILE =====
@@ -65,6 +65,9 @@ void    covariance ( Matrix& cov, const Table& tab, const Vector&  mu );
 void    covariance ( Matrix& cov, const Table& tab, real8_t* mu );
 void    covariance ( Matrix& cov, const Table& tab );
 
+void    streamCovariance ( Matrix& cov, real8_t* mu, const Table& tab,
+                           const int32_t block = 256 );
+
 void    correlate  ( Matrix& cor, const Matrix& cov );
 
 void    rotateWithRows    ( Table& out, const Table& in, const Matrix& rot );
@@ -55,13 +55,17 @@ class PCA {
   Matrix   rotation;          ///< Reverse Transformation matrix
   real8_t* rwork;             ///< Rotation work vector
 
+  static int orthonormalize ( real8_t* A, const int32_t m, const int32_t n );
+
  public:
   PCA  ( void );
   ~PCA ( void );
 
   int  fromSamples    ( Table& table );
+  int  fromSamples    ( Table& table, const int32_t k,
+                        const int32_t oversample = 10, const int32_t power = 2 );
   int  fromCovariance ( Matrix& cov, Vector& mean );
-  int  transform      ( Table&  out, Table&  in );
+  int  transform      ( Table&  out, Table&  in, const int32_t block = 1024 );
   int  transform      ( Vector& out, Vector& in );
   int  recover        ( Table&  out, Table&  in );
   int  recover        ( Vector& out, Vector& in );
@@ -0,0 +1,128 @@
+// ====================================================================== BEGIN FILE =====
+// **                                 P A R S E T O O L                                 **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Fast ASCII number parsing.
+ *  @file   ParseTool.hh
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18.
+ *
+ *  Provides a shared parsing layer for the ASCII readers (Table, Exemplar and CSVFile).
+ *
+ *  Files are viewed through a read only memory mapping. Numbers are converted by real8(),
+ *  a locale free decimal parser that returns the correctly rounded double: the Clinger
+ *  fast path and the Eisel-Lemire algorithm handle nearly every input, and the rare
+ *  undecidable case (more than 19 significant digits, subnormals, nan, inf) is passed to
+ *  strtod. values() splits a buffer on line boundaries, counts the numbers in each piece
+ *  and then parses the pieces in parallel on the global ThreadPool.
+ */
+// =======================================================================================
+
+#ifndef __HH_PARSETOOL_TRNCMP
+#define __HH_PARSETOOL_TRNCMP
+
+#include <trncmp.hh>
+#include <vector>
+
+namespace ParseTool {
+
+
+// =======================================================================================
+/** @brief File buffer.
+ *
+ *  Read only view of a file, memory mapped when possible and read into memory otherwise.
+ */
+// ---------------------------------------------------------------------------------------
+class Buffer {
+  // -------------------------------------------------------------------------------------
+ protected:
+  const char* base;    ///< first byte of the view
+  size_t      nbytes;  ///< length of the view
+  void*       mbase;   ///< mapping, null when the bytes were read
+  size_t      mbytes;  ///< length of the mapping
+  char*       heap;    ///< read buffer, null when mapped
+  bool        failed;  ///< the file could not be opened
+
+ private:
+  Buffer( const Buffer& );
+  Buffer& operator=( const Buffer& );
+
+ public:
+  Buffer  ( const std::string fspc, const size_t offset=0 );
+  ~Buffer ( void );
+
+  bool        bad   ( void ) const { return failed;          }
+  const char* begin ( void ) const { return base;            }
+  const char* end   ( void ) const { return base + nbytes;   }
+  size_t      size  ( void ) const { return nbytes;          }
+};
+
+
+// =======================================================================================
+/** @brief Separator.
+ *  @param[in] c character.
+ *  @return true for the white space that separates numbers.
+ */
+// ---------------------------------------------------------------------------------------
+inline bool isSeparator( const char c ) {
+  // -------------------------------------------------------------------------------------
+  return ( ' ' == c ) || ( ( '\t' <= c ) && ( '\r' >= c ) );
+}
+
+
+// =======================================================================================
+/** @brief Skip separators.
+ *  @param[in] p start of the text.
+ *  @param[in] e end of the text.
+ *  @return first character that is not a separator, or e.
+ */
+// ---------------------------------------------------------------------------------------
+inline const char* skip( const char* p, const char* e ) {
+  // -------------------------------------------------------------------------------------
+  while ( ( p < e ) && isSeparator( *p ) ) { ++p; }
+  return p;
+}
+
+
+const char* real8  ( const char* p, const char* e, real8_t& x );
+const char* int64  ( const char* p, const char* e, int64_t& x );
+
+int64_t     values ( const char* p, const char* e, real8_t* base,
+                     const int64_t nr, const int64_t nc,
+                     const int64_t rs, const int64_t cs );
+
+size_t      lines  ( std::vector<const char*>& line, std::vector<const char*>& stop,
+                     const char* b, const char* e );
+
+
+}; // end namespace ParseTool
+
+
+#endif
+
+
+// =======================================================================================
+// **                                 P A R S E T O O L                                 **
+// ======================================================================== END FILE =====
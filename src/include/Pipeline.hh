@@ -0,0 +1,227 @@
+// ====================================================================== BEGIN FILE =====
+// **                                  P I P E L I N E                                  **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Threaded pipeline.
+ *  @file   Pipeline.hh
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18.
+ *
+ *  Provides a source -> stages -> sink pipeline. Every step runs in its own SThread and
+ *  consecutive steps are joined by a bounded SPSCQueue, so a slow step holds back the
+ *  steps in front of it (back pressure) and no step ever takes a mutex.
+ *
+ *  @code
+ *  Pipeline<Record> job( 256 );
+ *  job.source( [&]( Record& r ) { return reader.next( r ); } )
+ *     .stage ( [&]( Record& r ) { transform( r ); return true; } )
+ *     .sink  ( [&]( Record& r ) { writer.put( r ); } );
+ *  job.run();
+ *  @endcode
+ */
+// =======================================================================================
+
+#ifndef __HH_PIPELINE_TRNCMP
+#define __HH_PIPELINE_TRNCMP
+
+#include <SThread.hh>
+#include <SQueue.hh>
+#include <functional>
+#include <vector>
+
+
+// =======================================================================================
+/** @brief Threaded pipeline over items of type T.
+ *
+ *  T must be default constructible and assignable.
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+class Pipeline {
+  // -------------------------------------------------------------------------------------
+ public:
+  typedef std::function<bool(T&)> source_t; ///< fill the next item, false at end of stream
+  typedef std::function<bool(T&)> stage_t;  ///< update an item, false to drop it
+  typedef std::function<void(T&)> sink_t;   ///< consume an item
+
+ protected:
+  // =====================================================================================
+  /** @brief Queue entry: an item or the end of stream marker. */
+  // -------------------------------------------------------------------------------------
+  struct slot {
+    T    item;
+    bool eos;
+    slot( void ) : item(), eos(false) {}
+  };
+
+  // =====================================================================================
+  /** @brief One pipeline step running in its own thread.
+   */
+  // -------------------------------------------------------------------------------------
+  class Step : public SThread {          // Pipeline::Step
+    // -----------------------------------------------------------------------------------
+   public:
+    Pipeline* owner;  ///< pipeline
+    size_t    pos;    ///< 0 = source, 1..n = stages, n+1 = sink
+
+    Step( Pipeline* p, size_t k ) : SThread(), owner(p), pos(k) {}
+    virtual ~Step( void ) {}
+    virtual void run( void ) { owner->execute( pos ); }
+
+   private:
+    Step( const Step& );
+    Step& operator=( const Step& );
+  };
+
+  size_t                        depth;     ///< capacity of each queue
+  source_t                      src_fn;    ///< source
+  std::vector<stage_t>          stage_fn;  ///< stages in order
+  sink_t                        sink_fn;   ///< sink
+  std::vector<SPSCQueue<slot>*> link;      ///< link[k] joins step k to step k+1
+  std::atomic<u_int64_t>        n_in;      ///< items produced by the source
+  std::atomic<u_int64_t>        n_out;     ///< items delivered to the sink
+
+  void execute( size_t k );
+
+ private:
+  Pipeline( const Pipeline& );
+  Pipeline& operator=( const Pipeline& );
+
+ public:
+  // =====================================================================================
+  /** @brief Constructor.
+   *  @param d capacity of the queue between consecutive steps.
+   */
+  // -------------------------------------------------------------------------------------
+  explicit Pipeline( size_t d = 1024 )
+      : depth(d), src_fn(), stage_fn(), sink_fn(), link(), n_in(0), n_out(0) {}
+
+  ~Pipeline( void ) {}
+
+  Pipeline& source ( source_t fn ) { src_fn  = fn;          return *this; }
+  Pipeline& stage  ( stage_t  fn ) { stage_fn.push_back(fn); return *this; }
+  Pipeline& sink   ( sink_t   fn ) { sink_fn = fn;          return *this; }
+
+  u_int64_t produced  ( void ) const { return n_in.load();  }
+  u_int64_t delivered ( void ) const { return n_out.load(); }
+
+  int run( void );
+};
+
+
+// =======================================================================================
+/** @brief Run.
+ *  @return 0 on success, 1 if the source or sink is missing.
+ *
+ *  Start one thread per step and wait until the end of stream reaches the sink.
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+inline int Pipeline<T>::run( void ) {
+  // -------------------------------------------------------------------------------------
+  if ( ( ! src_fn ) || ( ! sink_fn ) ) {
+    return 1;
+  }
+
+  const size_t nstep = stage_fn.size() + 2;
+
+  n_in.store( 0 );
+  n_out.store( 0 );
+
+  link.resize( nstep - 1 );
+  for ( size_t k=0; k<nstep-1; k++ ) {
+    link[k] = new SPSCQueue<slot>( depth );
+  }
+
+  std::vector<Step*> step( nstep );
+  for ( size_t k=0; k<nstep; k++ ) { step[k] = new Step( this, k ); }
+  for ( size_t k=0; k<nstep; k++ ) { step[k]->start(); }
+  for ( size_t k=0; k<nstep; k++ ) { step[k]->join(); delete step[k]; }
+
+  for ( size_t k=0; k<nstep-1; k++ ) { delete link[k]; }
+  link.clear();
+
+  return 0;
+}
+
+
+// =======================================================================================
+/** @brief Execute one step.
+ *  @param k position of the step.
+ *
+ *  Source: fill items until it returns false, then pass the end of stream marker.
+ *  Stage:  update each item and forward it unless it was dropped.
+ *  Sink:   consume each item until the end of stream marker.
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+inline void Pipeline<T>::execute( size_t k ) {
+  // -------------------------------------------------------------------------------------
+  slot S;
+
+  if ( 0 == k ) {
+    SPSCQueue<slot>* out = link[0];
+    while ( src_fn( S.item ) ) {
+      n_in.fetch_add( 1, std::memory_order_relaxed );
+      out->push( S );
+    }
+    S.eos = true;
+    out->push( S );
+    return;
+  }
+
+  SPSCQueue<slot>* in = link[k-1];
+
+  if ( k == link.size() ) {
+    for (;;) {
+      in->pop( S );
+      if ( S.eos ) { break; }
+      sink_fn( S.item );
+      n_out.fetch_add( 1, std::memory_order_relaxed );
+    }
+    return;
+  }
+
+  SPSCQueue<slot>* out = link[k];
+  stage_t&         fn  = stage_fn[k-1];
+  for (;;) {
+    in->pop( S );
+    if ( S.eos ) {
+      out->push( S );
+      break;
+    }
+    if ( fn( S.item ) ) {
+      out->push( S );
+    }
+  }
+}
+
+
+#endif
+
+
+// =======================================================================================
+// **                                  P I P E L I N E                                  **
+// ======================================================================== END FILE =====
@@ -0,0 +1,127 @@
+// ====================================================================== BEGIN FILE =====
+// **                                  P R O F I L E R                                  **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Scoped profiling zones.
+ *  @file   Profiler.hh
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18.
+ *
+ *  Provides the interface for lightweight, thread aware, wall clock profiling.
+ *
+ *  @code
+ *  void hot_path( void ) {
+ *    PROFILE_ZONE( "hot_path" );
+ *    ...
+ *  }
+ *  ...
+ *  Profiler::report( std::cout );
+ *  @endcode
+ *
+ *  Each zone name is registered once per call site. Each thread accumulates the call
+ *  count and the total, minimum and maximum duration of every zone in its own table, so
+ *  recording takes no lock. Define CALLISTO_NO_PROFILE to compile the zones out.
+ */
+// =======================================================================================
+
+#ifndef __HH_PROFILER_TRNCMP
+#define __HH_PROFILER_TRNCMP
+
+#include <StopWatch.hh>
+#include <iostream>
+
+
+#define PROFILE_MAX_ZONES    256   ///< maximum number of distinct zone names
+#define PROFILE_MAX_THREADS  256   ///< maximum number of threads recorded
+
+
+// =======================================================================================
+/** @brief Profiler registry and report.
+ */
+// ---------------------------------------------------------------------------------------
+class Profiler {
+  // -------------------------------------------------------------------------------------
+ public:
+  // =====================================================================================
+  /** @brief Accumulated timing of one zone in one thread.
+   */
+  // -------------------------------------------------------------------------------------
+  struct stat {
+    u_int64_t count;     ///< number of calls
+    u_int64_t total_ns;  ///< summed duration
+    u_int64_t min_ns;    ///< shortest call
+    u_int64_t max_ns;    ///< longest call
+  };
+
+  static int32_t     zone   ( const char* name );
+  static void        record ( int32_t id, u_int64_t ns );
+  static int32_t     zones  ( void );
+  static const char* name   ( int32_t id );
+  static stat        total  ( int32_t id );
+  static void        report ( std::ostream& os = std::cerr );
+  static void        reset  ( void );
+};
+
+
+// =======================================================================================
+/** @brief Scoped zone.
+ *
+ *  Start the clock on construction and record the elapsed time on destruction.
+ */
+// ---------------------------------------------------------------------------------------
+class ProfileZone {
+  // -------------------------------------------------------------------------------------
+ protected:
+  int32_t   id;  ///< zone id
+  u_int64_t t0;  ///< start time (ns)
+
+ private:
+  ProfileZone( const ProfileZone& );
+  ProfileZone& operator=( const ProfileZone& );
+
+ public:
+  explicit ProfileZone( int32_t zid ) : id(zid), t0(StopWatch::nanoseconds()) {}
+  ~ProfileZone( void ) { Profiler::record( id, StopWatch::nanoseconds() - t0 ); }
+};
+
+
+#define PROFILE_CAT2( _a, _b )  _a ## _b
+#define PROFILE_CAT( _a, _b )   PROFILE_CAT2( _a, _b )
+
+#ifndef CALLISTO_NO_PROFILE
+#define PROFILE_ZONE( _name )                                                       \
+  static const int32_t PROFILE_CAT( __pz_id_, __LINE__ ) = Profiler::zone( _name ); \
+  ProfileZone PROFILE_CAT( __pz_, __LINE__ )( PROFILE_CAT( __pz_id_, __LINE__ ) )
+#else
+#define PROFILE_ZONE( _name )  do {} while(0)
+#endif
+
+
+#endif
+
+
+// =======================================================================================
+// **                                  P R O F I L E R                                  **
+// ======================================================================== END FILE =====
@@ -0,0 +1,330 @@
+// ====================================================================== BEGIN FILE =====
+// **                                    S Q U E U E                                    **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Bounded lock free queues.
+ *  @file   SQueue.hh
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18.
+ *
+ *  Provides bounded ring queues for passing items between threads without a mutex.
+ *
+ *  SPSCQueue: one producer thread and one consumer thread. Each side owns one index and
+ *             keeps a cached copy of the other, so the common case touches no shared
+ *             cache line.
+ *  MPMCQueue: any number of producers and consumers. Each cell carries a sequence number
+ *             (D. Vyukov's bounded MPMC design); an index is claimed with one CAS.
+ *
+ *  try_push/try_pop never block. push/pop spin, then yield, then sleep briefly while the
+ *  queue is full/empty, which gives back pressure without a condition variable.
+ */
+// =======================================================================================
+
+#ifndef __HH_SQUEUE_TRNCMP
+#define __HH_SQUEUE_TRNCMP
+
+#include <trncmp.hh>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <utility>
+
+
+#define SQUEUE_PAD 64  ///< assumed cache line size in bytes
+
+
+// =======================================================================================
+/** @brief Back off.
+ *  @param k number of consecutive failed attempts (incremented).
+ *
+ *  Spin for the first few attempts, then yield, then sleep for 50 microseconds.
+ */
+// ---------------------------------------------------------------------------------------
+inline void squeue_backoff( int32_t& k ) {
+  // -------------------------------------------------------------------------------------
+  if ( 64 > k ) {
+    k++;
+  } else if ( 256 > k ) {
+    k++;
+    std::this_thread::yield();
+  } else {
+    std::this_thread::sleep_for( std::chrono::microseconds( 50 ) );
+  }
+}
+
+
+// =======================================================================================
+/** @brief Round a capacity up to a power of two (minimum 2).
+ */
+// ---------------------------------------------------------------------------------------
+inline size_t squeue_capacity( size_t n ) {
+  // -------------------------------------------------------------------------------------
+  size_t c = 2;
+  while ( c < n ) { c <<= 1; }
+  return c;
+}
+
+
+// =======================================================================================
+/** @brief Single producer / single consumer bounded queue.
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+class SPSCQueue {
+  // -------------------------------------------------------------------------------------
+ protected:
+  T*                  buf;                 ///< storage
+  size_t              cap;                 ///< capacity (power of two)
+  size_t              mask;                ///< cap - 1
+  char                pad0[SQUEUE_PAD];    ///< separate consumer from shared fields
+  std::atomic<size_t> head;                ///< next slot to pop  (written by consumer)
+  size_t              tail_cache;          ///< consumer's copy of tail
+  char                pad1[SQUEUE_PAD];    ///< separate producer from consumer
+  std::atomic<size_t> tail;                ///< next slot to push (written by producer)
+  size_t              head_cache;          ///< producer's copy of head
+  char                pad2[SQUEUE_PAD];    ///< keep neighbours off the producer line
+
+ private:
+  SPSCQueue( const SPSCQueue& );
+  SPSCQueue& operator=( const SPSCQueue& );
+
+ public:
+  // =====================================================================================
+  /** @brief Constructor.
+   *  @param n minimum capacity (rounded up to a power of two).
+   */
+  // -------------------------------------------------------------------------------------
+  explicit SPSCQueue( size_t n )
+      : buf(0), cap(squeue_capacity(n)), mask(0), pad0(), head(0), tail_cache(0),
+        pad1(), tail(0), head_cache(0), pad2() {
+    // -----------------------------------------------------------------------------------
+    mask = cap - 1;
+    buf  = new T[cap];
+  }
+
+  ~SPSCQueue( void ) { delete[] buf; }
+
+  size_t capacity( void ) const { return cap; }
+
+  // =====================================================================================
+  /** @brief Approximate number of queued items. */
+  // -------------------------------------------------------------------------------------
+  size_t size( void ) const {
+    // -----------------------------------------------------------------------------------
+    return tail.load( std::memory_order_acquire ) - head.load( std::memory_order_acquire );
+  }
+
+  // =====================================================================================
+  /** @brief Try to push (producer only).
+   *  @param item item to copy into the queue.
+   *  @return true if the item was queued, false if the queue is full.
+   */
+  // -------------------------------------------------------------------------------------
+  bool try_push( const T& item ) {
+    // -----------------------------------------------------------------------------------
+    const size_t t = tail.load( std::memory_order_relaxed );
+    if ( t - head_cache >= cap ) {
+      head_cache = head.load( std::memory_order_acquire );
+      if ( t - head_cache >= cap ) { return false; }
+    }
+    buf[t & mask] = item;
+    tail.store( t + 1, std::memory_order_release );
+    return true;
+  }
+
+  // =====================================================================================
+  /** @brief Try to pop (consumer only).
+   *  @param item receives the oldest item.
+   *  @return true if an item was removed, false if the queue is empty.
+   */
+  // -------------------------------------------------------------------------------------
+  bool try_pop( T& item ) {
+    // -----------------------------------------------------------------------------------
+    const size_t h = head.load( std::memory_order_relaxed );
+    if ( h == tail_cache ) {
+      tail_cache = tail.load( std::memory_order_acquire );
+      if ( h == tail_cache ) { return false; }
+    }
+    item = std::move( buf[h & mask] );
+    head.store( h + 1, std::memory_order_release );
+    return true;
+  }
+
+  // =====================================================================================
+  /** @brief Push, waiting while the queue is full. */
+  // -------------------------------------------------------------------------------------
+  void push( const T& item ) {
+    // -----------------------------------------------------------------------------------
+    int32_t k = 0;
+    while ( ! try_push( item ) ) { squeue_backoff( k ); }
+  }
+
+  // =====================================================================================
+  /** @brief Pop, waiting while the queue is empty. */
+  // -------------------------------------------------------------------------------------
+  void pop( T& item ) {
+    // -----------------------------------------------------------------------------------
+    int32_t k = 0;
+    while ( ! try_pop( item ) ) { squeue_backoff( k ); }
+  }
+};
+
+
+// =======================================================================================
+/** @brief Multiple producer / multiple consumer bounded queue.
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+class MPMCQueue {
+  // -------------------------------------------------------------------------------------
+ protected:
+  struct cell {
+    std::atomic<size_t> seq;   ///< position this cell is ready for
+    T                   data;  ///< payload
+  };
+
+  cell*               buf;                 ///< storage
+  size_t              cap;                 ///< capacity (power of two)
+  size_t              mask;                ///< cap - 1
+  char                pad0[SQUEUE_PAD];    ///< separate the indices
+  std::atomic<size_t> enq;                 ///< next position to claim for push
+  char                pad1[SQUEUE_PAD];    ///< separate the indices
+  std::atomic<size_t> deq;                 ///< next position to claim for pop
+  char                pad2[SQUEUE_PAD];    ///< keep neighbours off the last line
+
+ private:
+  MPMCQueue( const MPMCQueue& );
+  MPMCQueue& operator=( const MPMCQueue& );
+
+ public:
+  // =====================================================================================
+  /** @brief Constructor.
+   *  @param n minimum capacity (rounded up to a power of two).
+   */
+  // -------------------------------------------------------------------------------------
+  explicit MPMCQueue( size_t n )
+      : buf(0), cap(squeue_capacity(n)), mask(0), pad0(), enq(0), pad1(), deq(0), pad2() {
+    // -----------------------------------------------------------------------------------
+    mask = cap - 1;
+    buf  = new cell[cap];
+    for ( size_t i=0; i<cap; i++ ) {
+      buf[i].seq.store( i, std::memory_order_relaxed );
+    }
+  }
+
+  ~MPMCQueue( void ) { delete[] buf; }
+
+  size_t capacity( void ) const { return cap; }
+
+  // =====================================================================================
+  /** @brief Approximate number of queued items. */
+  // -------------------------------------------------------------------------------------
+  size_t size( void ) const {
+    // -----------------------------------------------------------------------------------
+    const size_t e = enq.load( std::memory_order_acquire );
+    const size_t d = deq.load( std::memory_order_acquire );
+    return ( e > d ) ? ( e - d ) : 0;
+  }
+
+  // =====================================================================================
+  /** @brief Try to push.
+   *  @param item item to copy into the queue.
+   *  @return true if the item was queued, false if the queue is full.
+   */
+  // -------------------------------------------------------------------------------------
+  bool try_push( const T& item ) {
+    // -----------------------------------------------------------------------------------
+    size_t pos = enq.load( std::memory_order_relaxed );
+    cell*  C   = static_cast<cell*>(0);
+    for (;;) {
+      C = buf + ( pos & mask );
+      const size_t   seq  = C->seq.load( std::memory_order_acquire );
+      const intptr_t diff = static_cast<intptr_t>( seq ) - static_cast<intptr_t>( pos );
+      if ( 0 == diff ) {
+        if ( enq.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) ) { break; }
+      } else if ( 0 > diff ) {
+        return false;
+      } else {
+        pos = enq.load( std::memory_order_relaxed );
+      }
+    }
+    C->data = item;
+    C->seq.store( pos + 1, std::memory_order_release );
+    return true;
+  }
+
+  // =====================================================================================
+  /** @brief Try to pop.
+   *  @param item receives the item.
+   *  @return true if an item was removed, false if the queue is empty.
+   */
+  // -------------------------------------------------------------------------------------
+  bool try_pop( T& item ) {
+    // -----------------------------------------------------------------------------------
+    size_t pos = deq.load( std::memory_order_relaxed );
+    cell*  C   = static_cast<cell*>(0);
+    for (;;) {
+      C = buf + ( pos & mask );
+      const size_t   seq  = C->seq.load( std::memory_order_acquire );
+      const intptr_t diff = static_cast<intptr_t>( seq ) - static_cast<intptr_t>( pos + 1 );
+      if ( 0 == diff ) {
+        if ( deq.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) ) { break; }
+      } else if ( 0 > diff ) {
+        return false;
+      } else {
+        pos = deq.load( std::memory_order_relaxed );
+      }
+    }
+    item = std::move( C->data );
+    C->seq.store( pos + cap, std::memory_order_release );
+    return true;
+  }
+
+  // =====================================================================================
+  /** @brief Push, waiting while the queue is full. */
+  // -------------------------------------------------------------------------------------
+  void push( const T& item ) {
+    // -----------------------------------------------------------------------------------
+    int32_t k = 0;
+    while ( ! try_push( item ) ) { squeue_backoff( k ); }
+  }
+
+  // =====================================================================================
+  /** @brief Pop, waiting while the queue is empty. */
+  // -------------------------------------------------------------------------------------
+  void pop( T& item ) {
+    // -----------------------------------------------------------------------------------
+    int32_t k = 0;
+    while ( ! try_pop( item ) ) { squeue_backoff( k ); }
+  }
+};
+
+
+#endif
+
+
+// =======================================================================================
+// **                                    S Q U E U E                                    **
+// ======================================================================== END FILE =====
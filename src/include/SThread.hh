@@ -278,8 +278,7 @@ inline SThreadCond::~SThreadCond(void) {
 // ---------------------------------------------------------------------------------------
 inline void SThreadCond::signal(void) {
   // -------------------------------------------------------------------------------------
-  //pthread_cond_signal( &cond );
-  std::cerr << "*** SThreadCond::signal(void) * NOT IMPLEMENTED\n";
+  cond.notify_one();
 }
 
 // =======================================================================================
@@ -291,8 +290,7 @@ inline void SThreadCond::signal(void) {
 // ---------------------------------------------------------------------------------------
 inline void SThreadCond::broadcast(void) {
   // -------------------------------------------------------------------------------------
-  //pthread_cond_broadcast( &cond );
-  std::cerr << "*** SThreadCond::broadcast(void) * NOT IMPLEMENTED\n";
+  cond.notify_all();
 }
 
 // =======================================================================================
@@ -304,8 +302,9 @@ inline void SThreadCond::broadcast(void) {
 // ---------------------------------------------------------------------------------------
 inline void SThreadCond::wait( SMutex& mutex ) {
   // -------------------------------------------------------------------------------------
-  std::unique_lock<std::mutex> lck(mutex.mtx);
+  std::unique_lock<std::mutex> lck( mutex.mtx, std::adopt_lock );
   this->cond.wait( lck );
+  lck.release();
 }
 
 // =======================================================================================
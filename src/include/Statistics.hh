@@ -39,6 +39,7 @@
 
 #include <Table.hh>
 #include <Matrix.hh>
+#include <vector>
 
 // =======================================================================================
 class Statistics {
@@ -132,6 +133,143 @@ class Statistics {
   }; // end class Statistics::single
 
 
+  // =====================================================================================
+  class moments {                                                   // Statistics::moments
+    // -----------------------------------------------------------------------------------
+   protected:
+    int64_t  n_samp;   ///< Number of samples
+    real8_t  m_mean;   ///< Mean of the samples
+    real8_t  m_M2;     ///< Sum of the squared   deviations from the mean
+    real8_t  m_M3;     ///< Sum of the cubed     deviations from the mean
+    real8_t  m_M4;     ///< Sum of the quartic   deviations from the mean
+    real8_t  m_minv;   ///< Minimum sample value
+    real8_t  m_maxv;   ///< Maximum sample value
+    int64_t  m_minidx; ///< Index of the minimum value (first occurance)
+    int64_t  m_maxidx; ///< Index of the maximum value (first occurance)
+
+   public:
+    moments  ( void );
+    ~moments ( void );
+
+    int64_t  count  ( void ) const { return n_samp;   };
+    real8_t  minv   ( void ) const { return m_minv;   };
+    real8_t  maxv   ( void ) const { return m_maxv;   };
+    int64_t  minidx ( void ) const { return m_minidx; };
+    int64_t  maxidx ( void ) const { return m_maxidx; };
+    real8_t  mean   ( void ) const { return m_mean;   };
+    real8_t  sum2   ( void ) const { return m_M2;     };
+    real8_t  sum3   ( void ) const { return m_M3;     };
+    real8_t  sum4   ( void ) const { return m_M4;     };
+
+    real8_t  var    ( void ) const;
+    real8_t  sigma  ( void ) const;
+    real8_t  skew   ( void ) const;
+    real8_t  kurt   ( void ) const;
+
+    void     reset  ( void );
+    void     report ( std::ostream& os, const std::string sfmt = "%g" );
+
+    void     merge  ( const moments& that );
+    void     batch  ( const real8_t* a, const int64_t n );
+    void     batch  ( const Table& tab, const int32_t vidx );
+
+    template<class T> void update ( T v );
+
+  }; // end class Statistics::moments
+
+
+  // =====================================================================================
+  /** @brief Streaming quantile sketch.
+   *
+   *  KLL sketch (Karnin, Lang & Liberty, 2016). Samples are kept in a stack of
+   *  compactors; when a compactor is full it is sorted and every other item is
+   *  promoted to the next level with twice the weight. Memory is O(k) and the rank
+   *  error is bounded by rank_error() with high probability. Sketches with the same
+   *  k are mergeable.
+   */
+  class quantile {                                                 // Statistics::quantile
+    // -----------------------------------------------------------------------------------
+   protected:
+    int32_t   k_param;                              ///< Accuracy parameter
+    int64_t   n_samp;                               ///< Number of samples
+    int32_t   n_kept;                               ///< Number of items retained
+    int32_t   n_max;                                ///< Retained items before a compaction
+    real8_t   m_minv;                               ///< Minimum sample value
+    real8_t   m_maxv;                               ///< Maximum sample value
+    u_int64_t seed;                                 ///< Compaction coin state
+    std::vector< std::vector<real8_t> > compactor;  ///< Level h carries weight 2^h
+
+    int32_t   capacity ( const int32_t h ) const;
+    void      grow     ( void );
+    void      compress ( void );
+    bool      coin     ( void );
+
+    void      weighted ( std::vector<real8_t>& val, std::vector<int64_t>& wgt ) const;
+
+   public:
+    quantile  ( const int32_t k = 200, const u_int64_t s = 0 );
+    ~quantile ( void );
+
+    int64_t  count      ( void ) const { return n_samp;  };
+    int32_t  retained   ( void ) const { return n_kept;  };
+    real8_t  minv       ( void ) const { return m_minv;  };
+    real8_t  maxv       ( void ) const { return m_maxv;  };
+    real8_t  rank_error ( void ) const;
+
+    void     reset      ( void );
+    void     update     ( const real8_t x );
+    void     batch      ( const real8_t* a, const int64_t n );
+    void     batch      ( const Table& tab, const int32_t vidx );
+    bool     merge      ( const quantile& that );
+
+    real8_t  rank       ( const real8_t x ) const;
+    real8_t  get        ( const real8_t q ) const;
+    void     get        ( real8_t* v, const real8_t* q, const int32_t n ) const;
+    real8_t  median     ( void ) const { return get( D_HALF ); };
+
+  }; // end class Statistics::quantile
+
+
+  // =====================================================================================
+  /** @brief Distinct value counter.
+   *
+   *  HyperLogLog (Flajolet et. al. 2007) with 2^p one byte registers and a 64 bit
+   *  hash, using linear counting for small cardinalities. The relative standard
+   *  error is 1.04/sqrt(2^p). Counters with the same precision are mergeable.
+   */
+  class distinct {                                                 // Statistics::distinct
+    // -----------------------------------------------------------------------------------
+   protected:
+    int32_t   prec;       ///< Precision, number of index bits
+    int32_t   nreg;       ///< Number of registers (2^prec)
+    u_int8_t* reg;        ///< Registers
+
+   public:
+    distinct  ( const int32_t p = 14 );
+    distinct  ( const distinct& that );
+    ~distinct ( void );
+
+    distinct& operator= ( const distinct& that );
+
+    int32_t  precision  ( void ) const { return prec; };
+    real8_t  rel_error  ( void ) const;
+
+    void     reset      ( void );
+    void     insert     ( const u_int64_t h );
+    void     add        ( const real8_t   x );
+    void     add        ( const int64_t   x );
+    void     add        ( const int32_t   x ) { add( static_cast<int64_t>( x ) ); };
+    void     add        ( const std::string& str );
+    void     batch      ( const real8_t* a, const int64_t n );
+    bool     merge      ( const distinct& that );
+
+    real8_t  estimate   ( void ) const;
+
+    static u_int64_t hash ( u_int64_t x );
+
+  }; // end class Statistics::distinct
+
+
   // =====================================================================================
   class multi {                                                       // Statistics::multi
     // -----------------------------------------------------------------------------------
@@ -201,8 +339,13 @@ class Statistics {
     int32_t* hbin;       ///< The bins
     real8_t* hctr;       ///< Numeric center of each bin
     int32_t  nsamp;      ///< Number of samples
+    bool     sorted;     ///< Bin centers are in ascending order
+    bool     uniform;    ///< Bin centers are (nearly) evenly spaced
+    real8_t  origin;     ///< Center of the first bin          (uniform only)
+    real8_t  scale;      ///< Reciprocal of the center spacing (uniform only)
 
-    void  init      ( const real8_t* centers, const int32_t n );
+    void    init    ( const real8_t* centers, const int32_t n );
+    int32_t refine  ( const real8_t x, int32_t idx ) const;
     
    public:
     histogram      (                                             const int32_t n );
@@ -301,6 +444,43 @@ void Statistics::running::batch( T* a, int32_t n ) {
 }
 
 
+// =======================================================================================
+/** @brief Update.
+ *  @param[in] v sample value.
+ *
+ *  Single sample update of the central moments (Welford, extended by Pebay to the
+ *  third and fourth moments). The index of the sample is its position in the stream.
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+void Statistics::moments::update( T v ) {
+  // -------------------------------------------------------------------------------------
+  const real8_t x  = (real8_t) v;
+  const real8_t n1 = (real8_t) n_samp;
+
+  if ( 0 == n_samp ) {
+    m_minv   = x;   m_minidx = 0;
+    m_maxv   = x;   m_maxidx = 0;
+  } else {
+    if ( x < m_minv ) { m_minv = x;  m_minidx = n_samp; }
+    if ( x > m_maxv ) { m_maxv = x;  m_maxidx = n_samp; }
+  }
+
+  n_samp += 1;
+
+  const real8_t n     = (real8_t) n_samp;
+  const real8_t delta = x - m_mean;
+  const real8_t dn    = delta / n;
+  const real8_t dn2   = dn * dn;
+  const real8_t term1 = delta * dn * n1;
+
+  m_mean += dn;
+  m_M4   += ( term1*dn2*(n*n - 3.0*n + 3.0) + 6.0*dn2*m_M2 - 4.0*dn*m_M3 );
+  m_M3   += ( term1*dn*(n - 2.0) - 3.0*dn*m_M2 );
+  m_M2   += term1;
+}
+
+
 // =======================================================================================
 /** @brief Minimum.
  *  @return minimum sampled value.
@@ -30,7 +30,9 @@
  *  @date   2014-01-27  Original release.
  *  @date   2019-Jun-14 CMake refactorization.
  *
- *  Provides the interface for precision time keeping.
+ *  Provides the interface for precision time keeping. Elapsed time is wall clock time
+ *  from the monotonic steady_clock, so it is meaningful for multi-threaded code; the
+ *  process CPU time (summed over all threads) is still available from cpu().
  */
 // =======================================================================================
 
@@ -41,6 +43,10 @@
 
 #include <trncmp.hh>
 #include <time.h>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
 
 // =======================================================================================
@@ -50,14 +56,19 @@
 class StopWatch {
   // -------------------------------------------------------------------------------------
 private:
-  clock_t start_time;  ///< Start time in CPU clock ticks
+  std::chrono::steady_clock::time_point start_time;  ///< Start time (monotonic wall clock)
+  clock_t                               start_cpu;   ///< Start time in CPU clock ticks
 
 public:
-  StopWatch     ( void ) : start_time(0) { };
+  StopWatch     ( void ) : start_time(std::chrono::steady_clock::now()), start_cpu(clock()) { };
   ~StopWatch    ( void ) {};
 
   void    reset ( void );
   real8_t check ( void );
+  real8_t cpu   ( void );
+
+  static u_int64_t nanoseconds ( void );
+  static u_int64_t cycles      ( void );
   
 }; // end class StopWatch
 
@@ -70,20 +81,62 @@ public:
 // ------------------------------------------------------------------------------------------
 inline  void StopWatch::reset( void ) {
   // ----------------------------------------------------------------------------------------
-  start_time = clock();
+  start_cpu  = clock();
+  start_time = std::chrono::steady_clock::now();
 }
 
 
 // ==========================================================================================
 /** @brief Elapse.
- *  @return Elapsed time in seconds.
+ *  @return Elapsed wall clock time in seconds.
  *
  *  Return the time that elapsed between reset and now.
  */
 // ------------------------------------------------------------------------------------------
 inline  real8_t StopWatch::check( void ) {
   // ----------------------------------------------------------------------------------------
-  return (real8_t)(clock() - start_time) / (real8_t) CLOCKS_PER_SEC;
+  return std::chrono::duration<real8_t>( std::chrono::steady_clock::now() - start_time ).count();
+}
+
+
+// ==========================================================================================
+/** @brief CPU time.
+ *  @return CPU time in seconds used by the process (all threads) since reset.
+ */
+// ------------------------------------------------------------------------------------------
+inline  real8_t StopWatch::cpu( void ) {
+  // ----------------------------------------------------------------------------------------
+  return (real8_t)(clock() - start_cpu) / (real8_t) CLOCKS_PER_SEC;
+}
+
+
+// ==========================================================================================
+/** @brief Nanoseconds.
+ *  @return monotonic wall clock reading in nanoseconds (arbitrary origin).
+ */
+// ------------------------------------------------------------------------------------------
+inline  u_int64_t StopWatch::nanoseconds( void ) {
+  // ----------------------------------------------------------------------------------------
+  return static_cast<u_int64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>
+                                 ( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+}
+
+
+// ==========================================================================================
+/** @brief Cycles.
+ *  @return time stamp counter on x86, otherwise nanoseconds().
+ *
+ *  The cheapest available tick count, for comparing short intervals on one core. The
+ *  unit is not converted to seconds.
+ */
+// ------------------------------------------------------------------------------------------
+inline  u_int64_t StopWatch::cycles( void ) {
+  // ----------------------------------------------------------------------------------------
+#if defined(__x86_64__) || defined(__i386__)
+  return static_cast<u_int64_t>( __rdtsc() );
+#else
+  return nanoseconds();
+#endif
 }
 
 
@@ -41,6 +41,12 @@
 #include <trncmp.hh>
 #include <stdarg.h>
 #include <sys/types.h>
+#include <cstring>
+#include <tuple>
+#include <new>
+#include <type_traits>
+
+class TLoggerAsync;
 
 // =======================================================================================
 /** @brief Console/file logger
@@ -59,6 +65,11 @@ class TLogger {
   static const int INFO;      ///< Level is set to Information
   static const int DEBUG;     ///< Level is set to Debugging
 
+  static const size_t DEFERRED_BYTES = 512;  ///< capacity of one asynchronous record
+
+  /** @brief Render a deferred record into text (runs on the writer thread). */
+  typedef int32_t (*render_t)( char* buffer, size_t n, const void* payload );
+
   // ===================================================
   /** @brief Abort handler
    */
@@ -107,14 +118,36 @@ class TLogger {
   void setWriteLevel         ( int level );
   void setLogfile            ( const char* fspc, int new_level = TLogger::UNSET );
 
+  bool      setAsync ( bool enable, int32_t ring_records = 256 );
+  bool      isAsync  ( void ) const;
+  void      flush    ( void );
+  u_int64_t dropped  ( void ) const;
+
+  bool      wants    ( int level ) const;
+
+  template<typename... A>
+  void      deferred ( int level, int line, const char* file, const char* func,
+                       const char* fmt, A... args );
+
+  static int32_t vformat ( char* buffer, size_t n, const char* fmt, ... );
+
  private:
   static TLogger*      theInstance;
   static AbortHandler* DEFAULT_ABORT_HANDLER;
 
   char* format_location( int line, const char* file, const char* func );
+  void  format_line( char* buffer, size_t n, const char* tstamp, char code,
+                     const char* fmt, va_list list, const char* extra );
+
+  void* defer_begin ( int level, render_t fn );
+  void  defer_end   ( void );
+  void  log         ( int level, int line, const char* file, const char* func,
+                      const char* fmt, ... );
 
   TLogger( void );
 
+  static void exitFlush ( void );
+
  protected:
   TLogger(const TLogger&);            ///< dummy entry
   TLogger& operator=(const TLogger&); ///< dummy entry
@@ -125,10 +158,197 @@ class TLogger {
   int           abort_level;     ///< Minimum level to abort the process
   AbortHandler* abort_handler;   ///< Handler for custom abort actions
   bool          flag;            ///< Toggle loging without altering properties
+  TLoggerAsync* async;           ///< Background writer (null when synchronous)
 };
 
 #define LOCATION  __LINE__, __FILE__, __PRETTY_FUNCTION__
 
+// =======================================================================================
+// Compile time level filter.
+//
+// TLOG_* call sites above TLOGGER_COMPILE_LEVEL (0=none ... 5=debug) reduce to a constant
+// false branch; the compiler removes the call and its arguments are never evaluated. The
+// remaining sites test the runtime levels inline before doing any work and, when the
+// logger is asynchronous, capture the format pointer and the argument values in a binary
+// record that is formatted on the writer thread.
+//
+//   TLOG_DEBUG( logger, "resize n=%d", n );
+// ---------------------------------------------------------------------------------------
+
+#ifndef TLOGGER_COMPILE_LEVEL
+#define TLOGGER_COMPILE_LEVEL 5
+#endif
+
+#define TLOGGER_EMIT( _lg, _lvl, ... )                                  \
+  do {                                                                  \
+    if ( ( TLOGGER_COMPILE_LEVEL >= (_lvl) ) && (_lg)->wants(_lvl) ) {  \
+      (_lg)->deferred( (_lvl), LOCATION, __VA_ARGS__ );                 \
+    }                                                                   \
+  } while(0)
+
+#define TLOG_CRITICAL( _lg, ... )  TLOGGER_EMIT( _lg, 1, __VA_ARGS__ )
+#define TLOG_ERROR( _lg, ... )     TLOGGER_EMIT( _lg, 2, __VA_ARGS__ )
+#define TLOG_WARN( _lg, ... )      TLOGGER_EMIT( _lg, 3, __VA_ARGS__ )
+#define TLOG_INFO( _lg, ... )      TLOGGER_EMIT( _lg, 4, __VA_ARGS__ )
+#define TLOG_DEBUG( _lg, ... )     TLOGGER_EMIT( _lg, 5, __VA_ARGS__ )
+
+
+// =======================================================================================
+/** @brief Deferred record support.
+ *
+ *  Arguments are stored by value. C strings are copied into the record behind the
+ *  argument tuple and replaced by their offset, so the caller's buffers may be released
+ *  as soon as the call returns.
+ */
+// ---------------------------------------------------------------------------------------
+namespace tlogger_detail {
+
+template<int...> struct seq {};
+template<int N, int... S> struct gen : gen<N-1, N-1, S...> {};
+template<int... S> struct gen<0, S...> { typedef seq<S...> type; };
+
+struct str_ref { u_int16_t off; };   ///< offset of a copied string (0 = null)
+
+template<typename T> struct stored              { typedef T       type; };
+template<>           struct stored<const char*> { typedef str_ref type; };
+template<>           struct stored<char*>       { typedef str_ref type; };
+
+// ---------------------------------------------------------------------------------------
+inline size_t strsize( void ) { return 0; }
+
+template<typename T, typename... R>
+inline size_t strsize( T, R... r ) { return strsize( r... ); }
+
+template<typename... R>
+inline size_t strsize( const char* s, R... r ) {
+  return ( ( 0 == s ) ? 0 : ( strlen( s ) + 1 ) ) + strsize( r... );
+}
+
+template<typename... R>
+inline size_t strsize( char* s, R... r ) {
+  return strsize( static_cast<const char*>( s ), r... );
+}
+
+// ---------------------------------------------------------------------------------------
+template<typename T>
+inline T pack( T v, char*, size_t& ) {
+  static_assert( std::is_scalar<T>::value,
+                 "deferred log arguments must be scalars or C strings" );
+  return v;
+}
+
+inline str_ref pack( const char* s, char* base, size_t& k ) {
+  str_ref r;
+  r.off = 0;
+  if ( 0 != s ) {
+    const size_t n = strlen( s ) + 1;
+    memcpy( base + k, s, n );
+    r.off = static_cast<u_int16_t>( k );
+    k    += n;
+  }
+  return r;
+}
+
+inline str_ref pack( char* s, char* base, size_t& k ) {
+  return pack( static_cast<const char*>( s ), base, k );
+}
+
+template<typename T>
+inline T unpack( T v, const char* ) { return v; }
+
+inline const char* unpack( str_ref r, const char* base ) {
+  return ( 0 == r.off ) ? "(null)" : ( base + r.off );
+}
+
+// ---------------------------------------------------------------------------------------
+template<typename... A>
+struct record {
+  int32_t     line;
+  const char* file;
+  const char* func;
+  const char* fmt;
+  std::tuple< typename stored<A>::type... > args;
+
+  record( int32_t ln, const char* fl, const char* fn, const char* fm,
+          const std::tuple< typename stored<A>::type... >& ar )
+      : line(ln), file(fl), func(fn), fmt(fm), args(ar) {}
+};
+
+template<typename... A, int... S>
+inline int32_t render_seq( char* buffer, size_t n, const record<A...>* R, seq<S...> ) {
+  const char* base = reinterpret_cast<const char*>( R );
+  (void) base;
+  int32_t k = TLogger::vformat( buffer, n, R->fmt, unpack( std::get<S>( R->args ), base )... );
+  if ( ( 0 <= k ) && ( static_cast<size_t>(k) < n ) ) {
+    const int32_t m = TLogger::vformat( buffer + k, n - static_cast<size_t>(k),
+                                        " ( %s %s:%d )", R->func, R->file, R->line );
+    if ( 0 < m ) { k += m; }
+  }
+  return k;
+}
+
+template<typename... A>
+int32_t render( char* buffer, size_t n, const void* payload ) {
+  return render_seq( buffer, n, static_cast<const record<A...>*>( payload ),
+                     typename gen<sizeof...(A)>::type() );
+}
+
+} // end namespace tlogger_detail
+
+
+// =======================================================================================
+/** @brief Wants.
+ *  @param level message severity level.
+ *  @return true if a message at this level would be displayed, written or abort.
+ *
+ *  Inline pre-check used by the TLOG_* macros to skip all work for filtered levels.
+ */
+// ---------------------------------------------------------------------------------------
+inline bool TLogger::wants( int level ) const {
+  // -------------------------------------------------------------------------------------
+  return flag && ( ( level <= console_level ) || ( level <= abort_level ) ||
+                   ( ( static_cast<char*>(0) != logfile_name ) && ( level <= write_level ) ) );
+}
+
+
+// =======================================================================================
+/** @brief Deferred message.
+ *  @param level message severity level.
+ *  @param line  source code line number      (__LINE__)
+ *  @param file  name of the source code file (__FILE__)
+ *  @param func  name of the calling function (__PRETTY_FUNCTION__)
+ *  @param fmt   printf style format string (must outlive the program, i.e. a literal).
+ *  @param args  scalar or C string arguments.
+ *
+ *  In asynchronous mode, below the abort level, the format pointer and a binary copy of
+ *  the arguments are placed in the calling thread's ring and formatted by the writer.
+ *  Otherwise the message is formatted immediately, exactly as error(LOCATION, ...) etc.
+ */
+// ---------------------------------------------------------------------------------------
+template<typename... A>
+inline void TLogger::deferred( int level, int line, const char* file, const char* func,
+                               const char* fmt, A... args ) {
+  // -------------------------------------------------------------------------------------
+  typedef tlogger_detail::record<A...> rec_t;
+
+  if ( ( static_cast<TLoggerAsync*>(0) != async ) && ( level > abort_level ) &&
+       ( sizeof(rec_t) + tlogger_detail::strsize( args... ) <= DEFERRED_BYTES ) ) {
+    void* P = defer_begin( level, &tlogger_detail::render<A...> );
+    if ( static_cast<void*>(0) != P ) {
+      char*  base = static_cast<char*>( P );
+      size_t k    = sizeof(rec_t);
+      (void) base;
+      (void) k;
+      new (P) rec_t( line, file, func, fmt,
+                     std::make_tuple( tlogger_detail::pack( args, base, k )... ) );
+      defer_end();
+    }
+    return;
+  }
+
+  log( level, line, file, func, fmt, args... );
+}
+
 #define TLOGGER_REFERENCE(_clnam, _vnam)  TLogger* _clnam::_vnam = TLogger::getInstance()
 #define TLOGGER_INSTANCE(_vnam)           static TLogger*  _vnam = TLogger::getInstance()
 #define TLOGGER_HEADER(_vnam)             static TLogger*  _vnam
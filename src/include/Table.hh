@@ -31,6 +31,24 @@
  *
  *  Provides the interface for a 2D Table
  *  @see Statistics, Covariance, and PCA
+ *
+ *  Tables are stored column major, so each variable is a contiguous run of nsamp values.
+ *  The native binary format keeps that layout on disk: a 64 byte header followed, at an
+ *  aligned offset, by the raw columns.
+ *
+ *    offset  size  field
+ *         0     8  magic "TRNTABLE"
+ *         8     4  endian tag 0x01020304 written in the producer's byte order
+ *        12     4  format version (1)
+ *        16     4  element size in bytes (8)
+ *        20     4  alignment of the data block in bytes (64)
+ *        24     8  number of samples
+ *        32     8  number of variables
+ *        40     8  byte offset of the data block
+ *        48    16  reserved (zero)
+ *
+ *  map() makes the Table a zero-copy view of such a file; col() then points straight into
+ *  the mapping.
  */
 // =======================================================================================
 
@@ -47,6 +65,8 @@ class Table {
   int32_t  nsamp;   ///< number of samples
   int32_t  nvar;    ///< number of variables
   int32_t  nalloc;  /// < max allocation (@see: Resize)
+  void*    mbase;   ///< start of the file mapping, null when data is owned
+  size_t   mbytes;  ///< length of the file mapping in bytes
 
   TLOGGER_HEADER( logger );
 
@@ -74,6 +94,7 @@ class Table {
 
   void     row          ( real8_t* row, const int32_t sidx );
   real8_t* col          ( const int32_t vidx );
+  const real8_t* col    ( const int32_t vidx ) const;
 
   bool     read_ascii   ( std::istream& inf );
   bool     write_ascii  ( std::ostream& outf, const std::string sfmt="%23.16e" );
@@ -82,6 +103,15 @@ class Table {
   
   bool     read_ascii   ( const std::string fspc );
   bool     write_ascii  ( const std::string fspc, const std::string sfmt="%23.16e" );
+
+  bool     read_binary  ( std::istream& inf );
+  bool     write_binary ( std::ostream& outf ) const;
+
+  bool     read_binary  ( const std::string fspc );
+  bool     write_binary ( const std::string fspc ) const;
+
+  bool     map          ( const std::string fspc, const bool writable=false );
+  bool     isMapped     ( void ) const { return ( static_cast<void*>(0) != mbase ); }
   
   int      sum          ( real8_t* s, const int32_t n, const int axis=0 ) const;
   int      mean         ( real8_t* s, const int32_t n, const int axis=0 ) const;
@@ -165,6 +195,18 @@ inline  real8_t* Table::col( const int32_t vidx ) {
   return (data + vidx*nsamp);
 }
 
+
+// =======================================================================================
+/** @brief Column.
+ *  @param[in] vidx vaiable index (column)
+ *  @return read only pointer to the start of the column.
+ */
+// ---------------------------------------------------------------------------------------
+inline  const real8_t* Table::col( const int32_t vidx ) const {
+  // -------------------------------------------------------------------------------------
+  return (data + vidx*nsamp);
+}
+
 // =======================================================================================
 /** @brief Copy.
  *  @param[in] tab reference to a source Table.
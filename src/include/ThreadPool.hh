@@ -0,0 +1,257 @@
+// ====================================================================== BEGIN FILE =====
+// **                                T H R E A D P O O L                                **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Work stealing thread pool.
+ *  @file   ThreadPool.hh
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18.
+ *
+ *  Provides the interface for a work stealing task scheduler built on SThread.
+ *
+ *  Each worker owns a deque. A worker pushes and pops tasks at the back of its own deque
+ *  and, when it runs dry, steals from the front of the others. Tasks submitted from
+ *  outside the pool are dealt round robin onto the worker deques. A thread waiting on
+ *  a parallel_for or parallel_reduce keeps executing tasks until its own work is done,
+ *  so nested loops do not deadlock.
+ */
+// =======================================================================================
+
+#ifndef __HH_THREADPOOL_TRNCMP
+#define __HH_THREADPOOL_TRNCMP
+
+#include <SThread.hh>
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <functional>
+#include <exception>
+#include <future>
+#include <memory>
+
+
+// =======================================================================================
+/** @brief Work stealing thread pool.
+ */
+// ---------------------------------------------------------------------------------------
+class ThreadPool {
+  // -------------------------------------------------------------------------------------
+ public:
+  typedef std::function<void(void)> task_t;  ///< unit of work
+
+ protected:
+
+  // =====================================================================================
+  /** @brief Worker thread.
+   */
+  // -------------------------------------------------------------------------------------
+  class Worker : public SThread {       // ThreadPool::Worker
+    // -----------------------------------------------------------------------------------
+   public:
+    ThreadPool*        pool;   ///< owning pool
+    int32_t            index;  ///< position in the pool
+    std::deque<task_t> tasks;  ///< local deque (owner uses the back, thieves the front)
+    SMutex             guard;  ///< protects tasks
+
+    Worker( ThreadPool* p, int32_t i ) : SThread(), pool(p), index(i), tasks(), guard() {}
+    virtual ~Worker( void ) {}
+    virtual void run( void );
+
+   private:
+    Worker( const Worker& );
+    Worker& operator=( const Worker& );
+  };
+
+  std::vector<Worker*>    worker;   ///< workers
+  int32_t                 n_work;   ///< number of workers
+  std::atomic<int64_t>    queued;   ///< tasks waiting in any deque
+  std::atomic<u_int32_t>  deal;     ///< round robin target for outside submissions
+  std::atomic<bool>       stopping; ///< workers should exit
+  std::mutex              idle_mtx; ///< guards idle waits
+  std::condition_variable idle_cv;  ///< wakes sleeping workers
+
+  void push       ( task_t task );
+  bool take       ( int32_t self, task_t& task );
+  void help_until ( std::atomic<int64_t>& remaining );
+
+  static void        complete ( std::atomic<int64_t>* remaining );
+
+ public:
+  ThreadPool  ( int32_t n = 0 );
+  ~ThreadPool ( void );
+
+  int32_t size( void ) const { return n_work; }
+
+  static ThreadPool* global ( void );
+
+  template<class F>
+  std::future<typename std::result_of<F()>::type> submit( F func );
+
+  template<class F>
+  void parallel_for( int64_t first, int64_t last, F body, int64_t grain = 0 );
+
+  template<class T, class M, class R>
+  T parallel_reduce( int64_t first, int64_t last, T identity, M map, R reduce,
+                     int64_t grain = 0 );
+
+ private:
+  ThreadPool( const ThreadPool& );
+  ThreadPool& operator=( const ThreadPool& );
+
+  int64_t grain_for( int64_t n, int64_t grain ) const;
+};
+
+
+// =======================================================================================
+/** @brief Submit.
+ *  @param func callable taking no arguments.
+ *  @return future holding the result (or exception) of func.
+ *
+ *  Queue func for execution on the pool.
+ */
+// ---------------------------------------------------------------------------------------
+template<class F>
+inline std::future<typename std::result_of<F()>::type> ThreadPool::submit( F func ) {
+  // -------------------------------------------------------------------------------------
+  typedef typename std::result_of<F()>::type ret_t;
+
+  std::shared_ptr< std::packaged_task<ret_t()> > job =
+      std::make_shared< std::packaged_task<ret_t()> >( func );
+
+  std::future<ret_t> fut = job->get_future();
+  push( [job]( void ) { (*job)(); } );
+  return fut;
+}
+
+
+// =======================================================================================
+/** @brief Parallel for.
+ *  @param first first index.
+ *  @param last  one past the last index.
+ *  @param body  callable body( i0, i1 ) processing the half open range [i0,i1).
+ *  @param grain minimum number of indices per task (0 = about four tasks per worker).
+ *
+ *  Split [first,last) into contiguous chunks of at least grain indices and execute them
+ *  on the pool. The calling thread executes tasks until every chunk has finished.
+ *
+ *  If body throws, the first exception is kept, chunks that have not started yet are
+ *  skipped, and the exception is rethrown on the calling thread once every chunk has
+ *  finished.
+ */
+// ---------------------------------------------------------------------------------------
+template<class F>
+inline void ThreadPool::parallel_for( int64_t first, int64_t last, F body, int64_t grain ) {
+  // -------------------------------------------------------------------------------------
+  const int64_t n = last - first;
+  if ( 0 >= n ) { return; }
+
+  const int64_t g = grain_for( n, grain );
+  if ( g >= n ) {
+    body( first, last );
+    return;
+  }
+
+  const int64_t        nchunk = ( n + g - 1 ) / g;
+  std::atomic<int64_t> remaining( nchunk );
+  std::atomic<bool>    thrown( false );
+  std::exception_ptr   error;
+
+  auto chunk = [&body, &thrown, &error]( int64_t i0, int64_t i1 ) {
+    if ( thrown.load() ) { return; }
+    try {
+      body( i0, i1 );
+    } catch ( ... ) {
+      if ( ! thrown.exchange( true ) ) { error = std::current_exception(); }
+    }
+  };
+
+  std::atomic<int64_t>* rp = &remaining;
+  decltype( chunk )*    cp = &chunk;
+
+  for ( int64_t c=1; c<nchunk; c++ ) {
+    const int64_t i0 = first + c*g;
+    const int64_t i1 = ( i0 + g < last ) ? ( i0 + g ) : last;
+    push( [cp, rp, i0, i1]( void ) { (*cp)( i0, i1 ); complete( rp ); } );
+  }
+
+  chunk( first, first + g );
+  complete( rp );
+
+  help_until( remaining );
+
+  if ( error ) { std::rethrow_exception( error ); }
+}
+
+
+// =======================================================================================
+/** @brief Parallel reduce.
+ *  @param first    first index.
+ *  @param last     one past the last index.
+ *  @param identity identity element of reduce.
+ *  @param map      callable map( i0, i1 ) returning the partial result over [i0,i1).
+ *  @param reduce   callable reduce( a, b ) combining two partial results.
+ *  @param grain    minimum number of indices per task (0 = about four tasks per worker).
+ *  @return reduction of all partial results.
+ *
+ *  Partial results are combined in index order, so the result does not depend on which
+ *  worker executed which chunk.
+ */
+// ---------------------------------------------------------------------------------------
+template<class T, class M, class R>
+inline T ThreadPool::parallel_reduce( int64_t first, int64_t last, T identity, M map,
+                                      R reduce, int64_t grain ) {
+  // -------------------------------------------------------------------------------------
+  const int64_t n = last - first;
+  if ( 0 >= n ) { return identity; }
+
+  const int64_t g      = grain_for( n, grain );
+  const int64_t nchunk = ( n + g - 1 ) / g;
+
+  std::vector<T> part( static_cast<size_t>( nchunk ), identity );
+  T*  pp = part.data();
+  M*  mp = &map;
+
+  parallel_for( 0, nchunk, [pp, mp, first, last, g]( int64_t c0, int64_t c1 ) {
+      for ( int64_t c=c0; c<c1; c++ ) {
+        const int64_t i0 = first + c*g;
+        const int64_t i1 = ( i0 + g < last ) ? ( i0 + g ) : last;
+        pp[c] = (*mp)( i0, i1 );
+      }
+    }, 1 );
+
+  T acc = identity;
+  for ( int64_t c=0; c<nchunk; c++ ) {
+    acc = reduce( acc, pp[c] );
+  }
+  return acc;
+}
+
+
+#endif
+
+
+// =======================================================================================
+// **                                T H R E A D P O O L                                **
+// ======================================================================== END FILE =====
@@ -30,6 +30,15 @@
  *  @date   2019-Aug-14.
  *
  *  Provides a Model of the Solar System. All coordinates will Heliocentric.
+ *
+ *  States are computed from the JPL mean Keplerian elements (E.M. Standish, valid
+ *  1800-2050 AD) referred to the mean ecliptic and equinox of J2000. The state vector
+ *  is { x, y, z, vx, vy, vz } in meters and meters per second, and time is given as a
+ *  Julian date (see AbsoluteDate::getJD). EARTH is the Earth-Moon barycenter.
+ *
+ *  A call to cache() fits Chebyshev segments to each planet over a span of dates.
+ *  Inside that span a state costs one segment lookup and a short recurrence instead
+ *  of a Kepler solve, and the batch state() over an array of dates is vectorized.
  */
 // =======================================================================================
 
@@ -37,25 +46,88 @@
 #define __HH_ORREY_TRNCMP
 
 #include <trncmp.hh>
+#include <vector>
 
 typedef enum { SUN, MERCURY, VENUS, EARTH, MARS, JUPITER,
                SATURN, URANUS, NEPTUNE, PLUTO } planet_e;
 
-  // =======================================================================================
+// =======================================================================================
 class Orrey {
   // -------------------------------------------------------------------------------------
  public:
-  
-  Orrey( void );
-  ~Orrey( void );
+  static const int32_t NUM_BODY  = 10;  ///< number of bodies in planet_e
+  static const int32_t NUM_COEF  = 12;  ///< Chebyshev coefficients per component
+  static const int32_t STATE_LEN = 6;   ///< length of a state vector
+
+ protected:
+  real8_t              jd_epoch;              ///< current epoch (Julian date)
+  real8_t              cache_start;           ///< first date in the cache
+  real8_t              cache_stop;            ///< last  date in the cache
+  int32_t              num_seg  [NUM_BODY];   ///< number of segments per body
+  real8_t              seg_span [NUM_BODY];   ///< length of a segment (days)
+  std::vector<real8_t> coef     [NUM_BODY];   ///< coefficients [seg][xyz][NUM_COEF]
+
+  static bool check       ( const planet_e planet );
+  void        fitSegments ( const planet_e planet );
+
+ public:
+
+  Orrey  ( void );
+  ~Orrey ( void );
+
+  void     setEpoch ( const real8_t jd );
+  real8_t  epoch    ( void ) const;
+
+  int      state    ( planet_e planet, real8_t* state );
+  int      state    ( planet_e planet, const real8_t jd, real8_t* state ) const;
+  int      state    ( planet_e planet, const real8_t* jd, const int32_t n,
+                      real8_t* states ) const;
+  int      kepler   ( planet_e planet, const real8_t jd, real8_t* state ) const;
 
-  int      state  ( planet_e planet, real8_t* state );
-  real8_t  mu     ( planet_e planet );
-  real8_t  radius ( planet_e planet );
+  bool     cache    ( const real8_t jd0, const real8_t jd1 );
+  void     clear    ( void );
+  bool     cached   ( const real8_t jd ) const;
+
+  real8_t  mu       ( planet_e planet );
+  real8_t  radius   ( planet_e planet );
   
 }; // end class Orrey
 
 
+// =======================================================================================
+/** @brief Epoch.
+ *  @return the current epoch as a Julian date.
+ */
+// ---------------------------------------------------------------------------------------
+inline  real8_t Orrey::epoch( void ) const {
+  // -------------------------------------------------------------------------------------
+  return jd_epoch;
+}
+
+
+// =======================================================================================
+/** @brief Set Epoch.
+ *  @param[in] jd Julian date of the epoch used by state( planet, state ).
+ */
+// ---------------------------------------------------------------------------------------
+inline  void Orrey::setEpoch( const real8_t jd ) {
+  // -------------------------------------------------------------------------------------
+  jd_epoch = jd;
+}
+
+
+// =======================================================================================
+/** @brief Cached.
+ *  @param[in] jd Julian date.
+ *  @return true if jd lies inside the span of the Chebyshev cache.
+ */
+// ---------------------------------------------------------------------------------------
+inline  bool Orrey::cached( const real8_t jd ) const {
+  // -------------------------------------------------------------------------------------
+  return ( ( jd >= cache_start ) && ( jd <= cache_stop ) );
+}
+
+
 #endif
 
 
@@ -128,6 +128,20 @@ extern "C" {
 		      const real8_t* C,
 		      const int32_t* ldc );
 
+  // -------------------------------------------------------------------------------------
+  //          C := alpha*A*A**T + beta*C    or    C := alpha*A**T*A + beta*C
+  // -------------------------------------------------------------------------------------
+  extern void dsyrk_( const char*    uplo,
+		      const char*    trans,
+		      const int32_t* n,
+		      const int32_t* k,
+		      const real8_t* alpha,
+		      const real8_t* A,
+		      const int32_t* lda,
+		      const real8_t* beta,
+		      const real8_t* C,
+		      const int32_t* ldc );
+
 } // end extern "C"
 
 
@@ -42,6 +42,7 @@
 
 #include <fuzzy/Partition.hh>
 #include <VarReal.hh>
+#include <Table.hh>
 #include <TLogger.hh>
 
 
@@ -84,7 +85,9 @@ class Group {
   // ----- execution --------------------------------------
 
   void       fuzzify       ( real8_t* mu, real8_t* x  );
+  void       fuzzify       ( Table& mu, const Table& x );
   void       defuzzify     ( real8_t* x,  real8_t* mu );
+  void       defuzzify     ( Table& x, const Table& mu );
   
   // ----- storage and transfer ---------------------------
 
@@ -0,0 +1,161 @@
+// ====================================================================== BEGIN FILE =====
+// **                             F U Z Z Y : : K E R N E L                             **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Compiled fuzzy group.
+ *  @file   fuzzy/Kernel.hh
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides the interface for a compiled fuzzy group.
+ *
+ *  A Kernel flattens the Partitions of a Group into contiguous breakpoint arrays so that
+ *  membership is evaluated without virtual calls. Partitions built by balance() or
+ *  set(ctrs) have ordered centers, so at most two adjacent sets are non-zero for any
+ *  input. active() finds that pair with an arithmetic guess and a binary search fallback.
+ *
+ *  The batch fuzzify(Table&,const Table&) evaluates one set at a time over a block of
+ *  samples with branch free loops that the compiler vectorises. Blocks run in parallel
+ *  on the global ThreadPool.
+ *
+ *  defuzzify() computes the center of area from the area and moment polynomials that each
+ *  Partition tabulates when its sets are placed. The batch form accumulates them for a
+ *  block of membership vectors in one vectorised pass per set.
+ *
+ *  A Kernel is a snapshot. Compile it again after the Group is changed.
+ */
+// =======================================================================================
+
+
+#ifndef __HH_FUZZY_KERNEL_TRNCMP
+#define __HH_FUZZY_KERNEL_TRNCMP
+
+
+#include <fuzzy/Group.hh>
+#include <Table.hh>
+#include <vector>
+
+
+namespace fuzzy {
+
+
+// =======================================================================================
+class Kernel {
+  // -------------------------------------------------------------------------------------
+ public:
+  enum { LEFT=0, TRIANGLE=1, RIGHT=2 };
+
+ protected:
+  TLOGGER_HEADER( logger );
+
+  int32_t              num_in;   ///< number of inputs (partitions)
+  int32_t              num_out;  ///< number of outputs (sets)
+  std::vector<int32_t> first;    ///< index of the first set of each input [num_in+1]
+  std::vector<real8_t> scale;    ///< (n-1)/(c[n-1]-c[0]) for the arithmetic guess
+  std::vector<int32_t> kind;     ///< shape of each set
+  std::vector<real8_t> left;     ///< left extreme of each set
+  std::vector<real8_t> center;   ///< center of each set
+  std::vector<real8_t> right;    ///< right extreme of each set
+  std::vector<real8_t> poly;     ///< Partition::coefficients of each set
+
+ public:
+  Kernel  ( void );
+  Kernel  ( Group& G );
+  ~Kernel ( void );
+
+  void    compile   ( Group& G );
+
+  int32_t nIn       ( void ) const;
+  int32_t nOut      ( void ) const;
+  int32_t nSet      ( const int32_t i ) const;
+  int32_t offset    ( const int32_t i ) const;
+
+  // ----- execution --------------------------------------
+
+  int32_t active    ( const int32_t i, const real8_t x, real8_t& m0, real8_t& m1 ) const;
+  void    mu        ( real8_t* degree, const int32_t i, const real8_t x ) const;
+  void    fuzzify   ( real8_t* mu, const real8_t* x ) const;
+  void    fuzzify   ( Table& mu, const Table& x ) const;
+  void    defuzzify ( real8_t* x, const real8_t* mu ) const;
+  void    defuzzify ( Table& x, const Table& mu ) const;
+
+}; // end class Kernel
+
+
+// =======================================================================================
+/** @brief Number of Inputs.
+ *  @return number of inputs.
+ */
+// ---------------------------------------------------------------------------------------
+inline  int32_t Kernel::nIn( void ) const {
+  // -------------------------------------------------------------------------------------
+  return num_in;
+}
+
+
+// =======================================================================================
+/** @brief Number of Outputs.
+ *  @return number of outputs, the total number of sets.
+ */
+// ---------------------------------------------------------------------------------------
+inline  int32_t Kernel::nOut( void ) const {
+  // -------------------------------------------------------------------------------------
+  return num_out;
+}
+
+
+// =======================================================================================
+/** @brief Number of Sets.
+ *  @param[in] i index of the input.
+ *  @return number of sets in the partition of the ith input.
+ */
+// ---------------------------------------------------------------------------------------
+inline  int32_t Kernel::nSet( const int32_t i ) const {
+  // -------------------------------------------------------------------------------------
+  return first[ static_cast<size_t>(i+1) ] - first[ static_cast<size_t>(i) ];
+}
+
+
+// =======================================================================================
+/** @brief Offset.
+ *  @param[in] i index of the input.
+ *  @return index of the first output of the ith input.
+ */
+// ---------------------------------------------------------------------------------------
+inline  int32_t Kernel::offset( const int32_t i ) const {
+  // -------------------------------------------------------------------------------------
+  return first[ static_cast<size_t>(i) ];
+}
+
+
+}; // end namespace fuzzy
+
+
+#endif
+
+
+// =======================================================================================
+// **                             F U Z Z Y : : K E R N E L                             **
+// ======================================================================== END FILE =====
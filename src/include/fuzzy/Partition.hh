@@ -65,14 +65,16 @@ class Partition {
 
   Partition& operator=(const fuzzy::Partition&);
 
-  Set**   fset;
-  int32_t num_set;
-  real8_t min_ctr;
-  real8_t max_ctr;
+  Set**    fset;
+  int32_t  num_set;
+  real8_t  min_ctr;
+  real8_t  max_ctr;
+  real8_t* poly;    ///< area and moment coefficients, NUM_COEF per set
 
   
-  void destroy ( void );
-  bool resize  ( const int32_t n );
+  void destroy  ( void );
+  bool resize   ( const int32_t n );
+  void tabulate ( void );
 
   
  public:
@@ -92,6 +94,9 @@ class Partition {
   real8_t*    create_buffer ( void );
   real8_t     getCenter     ( const int32_t idx ) const;
 
+  static const int32_t NUM_COEF = 5;
+  const real8_t* coefficients ( void ) const;
+
   // ----- configuration ----------------------------------
 
   void        balance   ( void );
@@ -0,0 +1,188 @@
+// ====================================================================== BEGIN FILE =====
+// **                           F U Z Z Y : : R U L E B A S E                           **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Fuzzy rule base.
+ *  @file   fuzzy/RuleBase.hh
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides the interface for a fuzzy rule base that connects the fuzzification of an
+ *  input Group to the outputs.
+ *
+ *  There is one rule for each combination of one set per input, so the rules form a
+ *  dense table indexed by a mixed radix number. Two kinds of consequent are supported.
+ *
+ *    MAMDANI  each rule names one set of each output partition. Firing strength is the
+ *             minimum of the antecedent memberships and the output membership is the
+ *             maximum over the rules that name it (max-min). defuzzify of the output
+ *             Group gives the crisp outputs.
+ *
+ *    TSK      each rule holds an affine function of the crisp inputs for each output.
+ *             Firing strength is the product of the antecedent memberships and the output
+ *             is the firing weighted mean of the rule functions.
+ *
+ *  Ordered partitions have at most two non-zero sets per input (Kernel::active), so at
+ *  most 2^nIn rules can fire and only those are visited. Sets with zero membership are
+ *  skipped, so a sample on a center visits fewer still.
+ *
+ *  The consequents are the trainable parameters. size(), load() and store() follow the
+ *  Group convention, so an evo::RealEncoding of size() elements can be loaded directly
+ *  from its get_data(). Mamdani set indices are rounded and clamped when loaded.
+ */
+// =======================================================================================
+
+
+#ifndef __HH_FUZZY_RULEBASE_TRNCMP
+#define __HH_FUZZY_RULEBASE_TRNCMP
+
+
+#include <fuzzy/Kernel.hh>
+
+
+namespace fuzzy {
+
+
+// =======================================================================================
+class RuleBase {
+  // -------------------------------------------------------------------------------------
+ public:
+  enum { MAMDANI=0, TSK=1 };
+
+ protected:
+  TLOGGER_HEADER( logger );
+
+  int32_t              mode;      ///< MAMDANI or TSK
+  Kernel               input;     ///< compiled antecedent Group
+  Kernel               output;    ///< compiled consequent Group (MAMDANI)
+  int32_t              num_in;    ///< number of crisp inputs
+  int32_t              num_out;   ///< number of crisp outputs
+  int32_t              num_rule;  ///< number of rules
+  std::vector<int32_t> stride;    ///< rule index stride of each input
+  std::vector<int32_t> conseq;    ///< MAMDANI [rule*num_out + o] output set index
+  std::vector<real8_t> coef;      ///< TSK [(rule*num_out + o)*(num_in+1) + k]
+  bool                 failed;    ///< the rules could not be built
+
+  void    shape    ( void );
+
+ public:
+  RuleBase  ( Group& in, Group& out );
+  RuleBase  ( Group& in, const int32_t nout );
+  ~RuleBase ( void );
+
+  bool    bad      ( void ) const;
+  int32_t kind     ( void ) const;
+  int32_t nIn      ( void ) const;
+  int32_t nOut     ( void ) const;
+  int32_t nRule    ( void ) const;
+  int32_t index    ( const int32_t* sets ) const;
+
+  void    set      ( const int32_t r, const int32_t o, const int32_t k );
+  int32_t get      ( const int32_t r, const int32_t o ) const;
+  void    set      ( const int32_t r, const int32_t o, const real8_t* c );
+  const real8_t* coefficients ( const int32_t r, const int32_t o ) const;
+
+  // ----- execution --------------------------------------
+
+  void    fire     ( real8_t* mu, const real8_t* x ) const;
+  void    evaluate ( real8_t* y,  const real8_t* x ) const;
+  void    evaluate ( Table& y, const Table& x ) const;
+
+  // ----- storage and transfer ---------------------------
+
+  int32_t  size    ( void ) const;
+  real8_t* load    ( real8_t* src );
+  real8_t* store   ( real8_t* dst ) const;
+
+}; // end class RuleBase
+
+
+// =======================================================================================
+/** @brief Bad.
+ *  @return true if the rule base could not be built (no inputs, or too many rules).
+ *
+ *  A bad rule base has no rules; set() is ignored and fire() and evaluate() return
+ *  zeros.
+ */
+// ---------------------------------------------------------------------------------------
+inline  bool RuleBase::bad( void ) const {
+  // -------------------------------------------------------------------------------------
+  return failed;
+}
+
+
+// =======================================================================================
+/** @brief Kind.
+ *  @return MAMDANI or TSK.
+ */
+// ---------------------------------------------------------------------------------------
+inline  int32_t RuleBase::kind( void ) const {
+  // -------------------------------------------------------------------------------------
+  return mode;
+}
+
+
+// =======================================================================================
+/** @brief Number of Inputs.
+ *  @return number of crisp inputs.
+ */
+// ---------------------------------------------------------------------------------------
+inline  int32_t RuleBase::nIn( void ) const {
+  // -------------------------------------------------------------------------------------
+  return num_in;
+}
+
+
+// =======================================================================================
+/** @brief Number of Outputs.
+ *  @return number of crisp outputs.
+ */
+// ---------------------------------------------------------------------------------------
+inline  int32_t RuleBase::nOut( void ) const {
+  // -------------------------------------------------------------------------------------
+  return num_out;
+}
+
+
+// =======================================================================================
+/** @brief Number of Rules.
+ *  @return number of rules, the product of the number of sets of each input.
+ */
+// ---------------------------------------------------------------------------------------
+inline  int32_t RuleBase::nRule( void ) const {
+  // -------------------------------------------------------------------------------------
+  return num_rule;
+}
+
+
+}; // end namespace fuzzy
+
+
+#endif
+
+
+// =======================================================================================
+// **                           F U Z Z Y : : R U L E B A S E                           **
+// ======================================================================== END FILE =====
@@ -119,6 +119,33 @@ extern "C" {
                        const int32_t* iwork,
                        const int32_t* info );
 
+  // -------------------------------------------------------------------------------------
+  // DGEQRF - compute a QR factorization of a real M-by-N matrix A
+  // -------------------------------------------------------------------------------------
+
+  extern void dgeqrf_( const int32_t* m,
+                       const int32_t* n,
+                       const real8_t* A,
+                       const int32_t* lda,
+                       const real8_t* tau,
+                       const real8_t* work,
+                       const int32_t* lwork,
+                       const int32_t* info );
+
+  // -------------------------------------------------------------------------------------
+  // DORGQR - generate the M-by-N matrix Q with orthonormal columns from DGEQRF
+  // -------------------------------------------------------------------------------------
+
+  extern void dorgqr_( const int32_t* m,
+                       const int32_t* n,
+                       const int32_t* k,
+                       const real8_t* A,
+                       const int32_t* lda,
+                       const real8_t* tau,
+                       const real8_t* work,
+                       const int32_t* lwork,
+                       const int32_t* info );
+
   // -------------------------------------------------------------------------------------
   // ILAENV - called from the LAPACK routines to choose problem-dependent parameters
   //          for the local environment
@@ -38,6 +38,12 @@
 #ifndef __HH_SUMMATION_TRNCMP
 #define __HH_SUMMATION_TRNCMP
 
+#include <cmath>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 // =======================================================================================t
 /** @brief Sum.
@@ -183,11 +189,462 @@ T centerOfMass( T* W, T* X, size_t n ) {
 }
 
 
+// =======================================================================================
+// **                      C O M P E N S A T E D   S U M M A T I O N                    **
+// =======================================================================================
+//
+//  The Kahan and Pairwise variants below are meant for real4_t and real8_t arrays that
+//  are long enough for the round-off of a single accumulator to matter. Each thread
+//  keeps summation::LANES independent accumulators, so that the inner loop can be
+//  vectorized, and arrays of at least summation::PARALLEL_MIN elements are split into
+//  one contiguous block per OpenMP thread. The partial results are combined in thread
+//  order, so the result only depends on the number of threads.
+//
+//  Kahan variants carry a Neumaier (Kahan-Babuska) compensation term in every lane;
+//  the error is bounded by a few ulp independent of n. Pairwise variants sum blocks
+//  of summation::PAIRWISE_BLOCK elements and combine them in a binary tree; the error
+//  grows with log(n) at the cost of a plain sum.
+//
+// ---------------------------------------------------------------------------------------
+
+namespace summation {
+
+static const size_t LANES          = 8;      ///< accumulators per thread
+static const size_t PAIRWISE_BLOCK = 128;    ///< leaf size of the pairwise tree
+static const size_t PARALLEL_MIN   = 65536;  ///< smallest array split across threads
+
+
+// =======================================================================================
+/** @brief Neumaier step.
+ *  @param[in,out] s running sum.
+ *  @param[in,out] c running compensation.
+ *  @param[in]     x term to add.
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+inline void neumaier( T& s, T& c, const T x ) {
+  // -------------------------------------------------------------------------------------
+  const T t = s + x;
+  c += ( std::fabs( s ) >= std::fabs( x ) ) ? ( ( s - t ) + x ) : ( ( x - t ) + s );
+  s  = t;
+}
+
+
+// =======================================================================================
+/** @brief Compensated block.
+ *  @param[out] s    sum of the block.
+ *  @param[out] c    compensation of the block.
+ *  @param[in]  term callable term( i ) returning the ith term.
+ *  @param[in]  i0   first index.
+ *  @param[in]  i1   one past the last index.
+ */
+// ---------------------------------------------------------------------------------------
+template<class T, class F>
+inline void compensatedBlock( T& s, T& c, const F& term, const size_t i0, const size_t i1 ) {
+  // -------------------------------------------------------------------------------------
+  T ls[ LANES ];
+  T lc[ LANES ];
+  for ( size_t k=0; k<LANES; k++ ) { ls[k] = static_cast<T>(0); lc[k] = static_cast<T>(0); }
+
+  size_t i = i0;
+  for ( ; i+LANES<=i1; i+=LANES ) {
+#pragma omp simd
+    for ( size_t k=0; k<LANES; k++ ) {
+      const T x = term( i+k );
+      const T t = ls[k] + x;
+      lc[k] += ( std::fabs( ls[k] ) >= std::fabs( x ) ) ?
+          ( ( ls[k] - t ) + x ) : ( ( x - t ) + ls[k] );
+      ls[k] = t;
+    }
+  }
+  for ( ; i<i1; i++ ) {
+    neumaier( ls[0], lc[0], term( i ) );
+  }
+
+  s = static_cast<T>(0);
+  c = static_cast<T>(0);
+  for ( size_t k=0; k<LANES; k++ ) {
+    neumaier( s, c, ls[k] );
+    c += lc[k];
+  }
+}
+
+
+// =======================================================================================
+/** @brief Compensated sum.
+ *  @param[in] term callable term( i ) returning the ith term.
+ *  @param[in] n    number of terms.
+ *  @return sum of the terms.
+ */
+// ---------------------------------------------------------------------------------------
+template<class T, class F>
+T compensated( const F& term, const size_t n ) {
+  // -------------------------------------------------------------------------------------
+#ifdef _OPENMP
+  const int32_t nthr = ( PARALLEL_MIN > n ) ? ( 1 ) : ( omp_get_max_threads() );
+#else
+  const int32_t nthr = 1;
+#endif
+
+  T s, c;
+
+  if ( 1 == nthr ) {
+    compensatedBlock( s, c, term, 0, n );
+    return s + c;
+  }
+
+  std::vector<T> ps( static_cast<size_t>( nthr ) );
+  std::vector<T> pc( static_cast<size_t>( nthr ) );
+
+#pragma omp parallel num_threads( nthr )
+  {
+#ifdef _OPENMP
+    const size_t tid = static_cast<size_t>( omp_get_thread_num() );
+#else
+    const size_t tid = 0;
+#endif
+    const size_t nt = static_cast<size_t>( nthr );
+    compensatedBlock( ps[tid], pc[tid], term, ( tid*n )/nt, ( ( tid + 1 )*n )/nt );
+  }
+
+  s = static_cast<T>(0);
+  c = static_cast<T>(0);
+  for ( size_t t=0; t<static_cast<size_t>( nthr ); t++ ) {
+    neumaier( s, c, ps[t] );
+    c += pc[t];
+  }
+  return s + c;
+}
+
+
+// =======================================================================================
+/** @brief Pairwise block.
+ *  @param[in] term callable term( i ) returning the ith term.
+ *  @param[in] i0   first index.
+ *  @param[in] i1   one past the last index.
+ *  @return sum of the terms.
+ */
+// ---------------------------------------------------------------------------------------
+template<class T, class F>
+T pairwiseBlock( const F& term, const size_t i0, const size_t i1 ) {
+  // -------------------------------------------------------------------------------------
+  const size_t n = i1 - i0;
+  if ( n > PAIRWISE_BLOCK ) {
+    const size_t h = i0 + ( ( n / 2 + LANES - 1 ) / LANES ) * LANES;
+    return pairwiseBlock<T>( term, i0, h ) + pairwiseBlock<T>( term, h, i1 );
+  }
+
+  T ls[ LANES ];
+  for ( size_t k=0; k<LANES; k++ ) { ls[k] = static_cast<T>(0); }
+
+  size_t i = i0;
+  for ( ; i+LANES<=i1; i+=LANES ) {
+#pragma omp simd
+    for ( size_t k=0; k<LANES; k++ ) {
+      ls[k] += term( i+k );
+    }
+  }
+  for ( ; i<i1; i++ ) {
+    ls[0] += term( i );
+  }
+
+  for ( size_t w=LANES/2; w>0; w/=2 ) {
+    for ( size_t k=0; k<w; k++ ) {
+      ls[k] += ls[k+w];
+    }
+  }
+  return ls[0];
+}
+
+
+// =======================================================================================
+/** @brief Pairwise sum.
+ *  @param[in] term callable term( i ) returning the ith term.
+ *  @param[in] n    number of terms.
+ *  @return sum of the terms.
+ */
+// ---------------------------------------------------------------------------------------
+template<class T, class F>
+T pairwise( const F& term, const size_t n ) {
+  // -------------------------------------------------------------------------------------
+#ifdef _OPENMP
+  const int32_t nthr = ( PARALLEL_MIN > n ) ? ( 1 ) : ( omp_get_max_threads() );
+#else
+  const int32_t nthr = 1;
+#endif
+
+  if ( 1 == nthr ) {
+    return ( 0 == n ) ? static_cast<T>(0) : pairwiseBlock<T>( term, 0, n );
+  }
+
+  std::vector<T> ps( static_cast<size_t>( nthr ) );
+
+#pragma omp parallel num_threads( nthr )
+  {
+#ifdef _OPENMP
+    const size_t tid = static_cast<size_t>( omp_get_thread_num() );
+#else
+    const size_t tid = 0;
+#endif
+    const size_t nt = static_cast<size_t>( nthr );
+    ps[tid] = pairwiseBlock<T>( term, ( tid*n )/nt, ( ( tid + 1 )*n )/nt );
+  }
+
+  for ( size_t w=1; w<ps.size(); w*=2 ) {
+    for ( size_t k=0; k+w<ps.size(); k+=2*w ) {
+      ps[k] += ps[k+w];
+    }
+  }
+  return ps[0];
+}
+
+
+} // end namespace summation
+
+
+// =======================================================================================
+/** @brief Compensated Sum.
+ *  @param[in] X pointer to a list.
+ *  @param[in] n number of elements in the list.
+ *  @return sum of the elements of the list.
+ *
+ *  $sum = SUM^n_{i=1} X_i$
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+T sumKahan( const T* X, const size_t n ) {
+  // -------------------------------------------------------------------------------------
+  return summation::compensated<T>( [X]( const size_t i ) { return X[i]; }, n );
+}
+
+
+// =======================================================================================
+/** @brief Pairwise Sum.
+ *  @param[in] X pointer to a list.
+ *  @param[in] n number of elements in the list.
+ *  @return sum of the elements of the list.
+ *
+ *  $sum = SUM^n_{i=1} X_i$
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+T sumPairwise( const T* X, const size_t n ) {
+  // -------------------------------------------------------------------------------------
+  return summation::pairwise<T>( [X]( const size_t i ) { return X[i]; }, n );
+}
+
+
+// =======================================================================================
+/** @brief Compensated Sum of squares.
+ *  @param[in] X pointer to a list.
+ *  @param[in] n number of elements in the list.
+ *  @return sum of the squares of the elements of the list.
+ *
+ *  $sum = SUM^n_{i=1} {\(X_i\)}^2$
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+T sumsqKahan( const T* X, const size_t n ) {
+  // -------------------------------------------------------------------------------------
+  return summation::compensated<T>( [X]( const size_t i ) { return X[i]*X[i]; }, n );
+}
+
+
+// =======================================================================================
+/** @brief Compensated weighted Sum.
+ *  @param[in] W pointer to a list.
+ *  @param[in] X pointer to a list.
+ *  @param[in] n number of elements in the list.
+ *  @return sum of the elements of the list.
+ *
+ *  $sum = SUM^n_{i=1} W_i cdot X_i$
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+T wsumKahan( const T* W, const T* X, const size_t n ) {
+  // -------------------------------------------------------------------------------------
+  return summation::compensated<T>( [W, X]( const size_t i ) { return W[i]*X[i]; }, n );
+}
+
+
+// =======================================================================================
+/** @brief Compensated Sum of squares of the differences.
+ *  @param[in] X pointer to a list.
+ *  @param[in] Y pointer to another list.
+ *  @param[in] n number of elements in the list.
+ *  @return sum of the squares of the elements of the list.
+ *
+ *  $sum = SUM^n_{i=1} {\(X_i - Y_i\)}^2$
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+T sumsqDiffKahan( const T* X, const T* Y, const size_t n ) {
+  // -------------------------------------------------------------------------------------
+  return summation::compensated<T>( [X, Y]( const size_t i ) {
+      const T d = X[i] - Y[i];
+      return d*d; }, n );
+}
+
+
+// =======================================================================================
+/** @brief Compensated Mean Square Error.
+ *  @param[in] X pointer to a list.
+ *  @param[in] Y pointer to another list.
+ *  @param[in] n number of elements in the list.
+ *  @return mean of the squares of the elements of the list.
+ *
+ *  $mse = \frac{1}{n} SUM^n_{i=1} {\(X_i - Y_i\)}^2$
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+real8_t MSEKahan( const T* X, const T* Y, const size_t n ) {
+  // -------------------------------------------------------------------------------------
+  return static_cast<real8_t>( sumsqDiffKahan( X, Y, n ) ) / static_cast<real8_t>(n);
+}
+
+
+// =======================================================================================
+// **                     R A D I A L   C E N T E R   O F   M A S S                     **
+// =======================================================================================
+//
+//  centerOfMassRad and centerOfMassRadPM accumulate the weight and both components of
+//  the weighted unit vectors in a single pass. The sine and cosine of each direction
+//  come from summation::sinCos, a branch-free polynomial that the compiler vectorizes
+//  with the surrounding loop.
+//
+//  sinCos reduces the angle by the nearest multiple of Pi/2 (Cody-Waite, three parts)
+//  and evaluates minimax polynomials on [-Pi/4,+Pi/4]. Inside the documented range the
+//  absolute error is below summation::SINCOS8_ERROR for real8_t and below
+//  summation::SINCOS4_ERROR for real4_t. Outside that range sinCos stays well defined
+//  (a NaN gives NaN) but loses accuracy; the center of mass functions detect such
+//  bearings and fall back to std::sin and std::cos for the affected array or segment.
+//
+//  The segmented overloads compute one circular mean per segment of a CSR-style array:
+//  segment k covers the elements [ offset[k], offset[k+1] ). Segments are distributed
+//  over OpenMP threads by element count, so a few long segments do not serialize the
+//  batch.
+//
+// ---------------------------------------------------------------------------------------
+
+namespace summation {
+
+static const real8_t SINCOS8_RANGE = 1.0e6;    ///< largest |x| for real8_t sinCos
+static const real8_t SINCOS8_ERROR = 4.0e-16;  ///< absolute error bound for real8_t
+static const real4_t SINCOS4_RANGE = 8.0e3f;   ///< largest |x| for real4_t sinCos
+static const real4_t SINCOS4_ERROR = 4.0e-7f;  ///< absolute error bound for real4_t
+
+
+// =======================================================================================
+/** @brief Sine and Cosine.
+ *  @param[in]  x angle in radians. The error bound holds for |x| <= SINCOS8_RANGE.
+ *  @param[out] s sine of x.
+ *  @param[out] c cosine of x.
+ */
+// ---------------------------------------------------------------------------------------
+inline void sinCos( const real8_t x, real8_t& s, real8_t& c ) {
+  // -------------------------------------------------------------------------------------
+  const real8_t round = 6755399441055744.0;  // 1.5 * 2^52, rounds to nearest integer
+  const real8_t j     = ( x * 6.36619772367581382433e-01 + round ) - round;
+  const int32_t q     = static_cast<int32_t>( ( std::fabs( j ) < 1.0e9 ) ? j : 0.0 );
+
+  const real8_t r = ( ( x - j * 1.57079632673412561417e+00 )
+                      - j * 6.07710050630396597660e-11 )
+      - j * 2.02226624879595063154e-21;
+  const real8_t z = r * r;
+
+  const real8_t ps = r + r * z * ( -1.66666666666666324348e-01 +
+                                   z * (  8.33333333332248946124e-03 +
+                                          z * ( -1.98412698298579493134e-04 +
+                                                z * (  2.75573137070700676789e-06 +
+                                                       z * ( -2.50507602534068634195e-08 +
+                                                             z * 1.58969099521155010221e-10 )))));
+
+  const real8_t pc = 1.0 - 0.5 * z + z * z * ( 4.16666666666666019037e-02 +
+                                               z * ( -1.38888888888741095749e-03 +
+                                                     z * (  2.48015872894767294178e-05 +
+                                                            z * ( -2.75573143513906633035e-07 +
+                                                                  z * (  2.08757232129817482790e-09 +
+                                                                         z * -1.13596475577881948265e-11 )))));
+
+  const real8_t a = ( q & 1 ) ? pc : ps;
+  const real8_t b = ( q & 1 ) ? ps : pc;
+  s = ( q       & 2 ) ? -a : a;
+  c = ( ( q+1 ) & 2 ) ? -b : b;
+}
+
+
+// =======================================================================================
+/** @brief Sine and Cosine.
+ *  @param[in]  x angle in radians. The error bound holds for |x| <= SINCOS4_RANGE.
+ *  @param[out] s sine of x.
+ *  @param[out] c cosine of x.
+ */
+// ---------------------------------------------------------------------------------------
+inline void sinCos( const real4_t x, real4_t& s, real4_t& c ) {
+  // -------------------------------------------------------------------------------------
+  const real4_t round = 12582912.0f;  // 1.5 * 2^23, rounds to nearest integer
+  const real4_t j     = ( x * 6.36619772e-01f + round ) - round;
+  const int32_t q     = static_cast<int32_t>( ( std::fabs( j ) < 1.0e9f ) ? j : 0.0f );
+
+  const real4_t r = ( ( x - j * 1.5703125f ) - j * 4.83751296997070312e-04f )
+      - j * 7.54978995489188216e-08f;
+  const real4_t z = r * r;
+
+  const real4_t ps = r + r * z * ( -1.6666654611e-01f +
+                                   z * (  8.3321608736e-03f +
+                                          z * -1.9515295891e-04f ) );
+
+  const real4_t pc = 1.0f - 0.5f * z + z * z * ( 4.166664568298827e-02f +
+                                                 z * ( -1.388731625493765e-03f +
+                                                       z * 2.443315711809948e-05f ) );
+
+  const real4_t a = ( q & 1 ) ? pc : ps;
+  const real4_t b = ( q & 1 ) ? ps : pc;
+  s = ( q       & 2 ) ? -a : a;
+  c = ( ( q+1 ) & 2 ) ? -b : b;
+}
+
+
+// =======================================================================================
+/** @brief Inside the sinCos range.
+ *  @param[in] x angle in radians.
+ *  @return true if |x| <= SINCOS8_RANGE (false for NaN).
+ */
+// ---------------------------------------------------------------------------------------
+inline bool sinCosRange( const real8_t x ) {
+  // -------------------------------------------------------------------------------------
+  return ( std::fabs( x ) <= SINCOS8_RANGE );
+}
+
+
+// =======================================================================================
+/** @brief Inside the sinCos range.
+ *  @param[in] x angle in radians.
+ *  @return true if |x| <= SINCOS4_RANGE (false for NaN).
+ */
+// ---------------------------------------------------------------------------------------
+inline bool sinCosRange( const real4_t x ) {
+  // -------------------------------------------------------------------------------------
+  return ( std::fabs( x ) <= SINCOS4_RANGE );
+}
+
+} // end namespace summation
+
+
 real8_t centerOfMassRad   ( const real8_t* mag, const real8_t* rad, const size_t n );
 real8_t centerOfMassRadPM ( const real8_t* mag, const real8_t* rad, const size_t n );
 real4_t centerOfMassRad   ( const real4_t* mag, const real4_t* rad, const size_t n );
 real4_t centerOfMassRadPM ( const real4_t* mag, const real4_t* rad, const size_t n );
 
+bool centerOfMassRad   ( real8_t* com, const real8_t* mag, const real8_t* rad,
+                         const size_t* offset, const size_t nseg );
+bool centerOfMassRadPM ( real8_t* com, const real8_t* mag, const real8_t* rad,
+                         const size_t* offset, const size_t nseg );
+bool centerOfMassRad   ( real4_t* com, const real4_t* mag, const real4_t* rad,
+                         const size_t* offset, const size_t nseg );
+bool centerOfMassRadPM ( real4_t* com, const real4_t* mag, const real4_t* rad,
+                         const size_t* offset, const size_t nseg );
+
 
 #endif
 
@@ -34,94 +34,584 @@
 // =======================================================================================
 
 
+
 #include <AbsoluteDate.hh>
+#include <ThreadPool.hh>
+#include <cmath>
+#include <atomic>
+
+
+const int32_t AbsoluteDate::ISO_LENGTH;
+
+
+namespace {
+
+
+const int64_t SEC_PER_DAY   = 86400;
+const real8_t JD_UNIX_EPOCH = 2.4405875e6;  ///< Julian date of 1970-01-01T00:00:00Z
+
+/** Days in each month of a common year (index 1-12). */
+const int32_t DAYS_IN_MONTH[16] = { 0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31,
+                                    0, 0, 0 };
+
+/** Two digit decimal strings 00-99. */
+const char DIGIT_PAIR[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
 
 // =======================================================================================
+/** @brief Days from Civil.
+ *  @param[in] y year.
+ *  @param[in] m month (1-12).
+ *  @param[in] d day of the month (1-31).
+ *  @return days since 1970-01-01 in the proleptic Gregorian calendar.
+ */
 // ---------------------------------------------------------------------------------------
-  void AbsoluteDate::set( const int32_t yr, const int32_t mo, const int32_t da,
-                      const int32_t hr, const int32_t mn, const real8_t sc,
-                      const int32_t ut ) {
+inline int64_t daysFromCivil( int64_t y, const int64_t m, const int64_t d ) {
   // -------------------------------------------------------------------------------------
-  }
+  y -= ( m <= 2 ) ? 1 : 0;
+  const int64_t era = ( ( 0 <= y ) ? y : ( y - 399 ) ) / 400;
+  const int64_t yoe = y - era*400;
+  const int64_t doy = ( 153*( ( m > 2 ) ? ( m - 3 ) : ( m + 9 ) ) + 2 )/5 + d - 1;
+  const int64_t doe = yoe*365 + yoe/4 - yoe/100 + doy;
+  return era*146097 + doe - 719468;
+}
 
 
 // =======================================================================================
+/** @brief Civil from Days.
+ *  @param[out] y year.
+ *  @param[out] m month (1-12).
+ *  @param[out] d day of the month (1-31).
+ *  @param[in]  z days since 1970-01-01.
+ */
 // ---------------------------------------------------------------------------------------
-  real8_t AbsoluteDate::getJD( void ) const {
+inline void civilFromDays( int64_t& y, int64_t& m, int64_t& d, int64_t z ) {
   // -------------------------------------------------------------------------------------
-    return epoch.span / 8.64e4;
-  }
+  z += 719468;
+  const int64_t era = ( ( 0 <= z ) ? z : ( z - 146096 ) ) / 146097;
+  const int64_t doe = z - era*146097;
+  const int64_t yoe = ( doe - doe/1460 + doe/36524 - doe/146096 ) / 365;
+  const int64_t doy = doe - ( 365*yoe + yoe/4 - yoe/100 );
+  const int64_t mp  = ( 5*doy + 2 )/153;
+  d = doy - ( 153*mp + 2 )/5 + 1;
+  m = ( mp < 10 ) ? ( mp + 3 ) : ( mp - 9 );
+  y = yoe + era*400 + ( ( m <= 2 ) ? 1 : 0 );
+}
 
 
 // =======================================================================================
+/** @brief Days in Month.
+ *  @param[in] y year.
+ *  @param[in] m month (1-12).
+ *  @return number of days in the month.
+ */
 // ---------------------------------------------------------------------------------------
-  int32_t AbsoluteDate::getYear( void ) const {
+inline int32_t daysInMonth( const int64_t y, const int32_t m ) {
   // -------------------------------------------------------------------------------------
-    return 0;
-  }
+  const bool leap = ( 0 == ( y % 4 ) ) && ( ( 0 != ( y % 100 ) ) || ( 0 == ( y % 400 ) ) );
+  return DAYS_IN_MONTH[ m & 15 ] + ( ( leap && ( 2 == m ) ) ? 1 : 0 );
+}
 
 
 // =======================================================================================
+/** @brief Fixed Layout.
+ *  @param[out] sec epoch seconds.
+ *  @param[in]  s   pointer to at least ISO_LENGTH characters.
+ *  @return non-zero if s is not a valid YYYY-MM-DDThh:mm:ss.sssZ timestamp.
+ *
+ *  Branch free, so that a block of records can be converted in a simd loop.
+ */
 // ---------------------------------------------------------------------------------------
-  int32_t AbsoluteDate::getMonth( void ) const {
+inline int32_t fixedLayout( real8_t& sec, const char* s ) {
   // -------------------------------------------------------------------------------------
-    return 0;
+  const unsigned char* u = reinterpret_cast<const unsigned char*>( s );
+
+  int32_t bad = ( '-' != u[4]  ) | ( '-' != u[7]  ) | ( 'T' != u[10] ) |
+      /**/      ( ':' != u[13] ) | ( ':' != u[16] ) | ( '.' != u[19] ) | ( 'Z' != u[23] );
+
+#define ISO_DIGIT(_k) static_cast<u_int32_t>( u[_k] - '0' )
+  const u_int32_t d[17] = {
+    ISO_DIGIT(0),  ISO_DIGIT(1),  ISO_DIGIT(2),  ISO_DIGIT(3),  ISO_DIGIT(5),
+    ISO_DIGIT(6),  ISO_DIGIT(8),  ISO_DIGIT(9),  ISO_DIGIT(11), ISO_DIGIT(12),
+    ISO_DIGIT(14), ISO_DIGIT(15), ISO_DIGIT(17), ISO_DIGIT(18), ISO_DIGIT(20),
+    ISO_DIGIT(21), ISO_DIGIT(22) };
+#undef ISO_DIGIT
+
+  for ( int32_t k=0; k<17; k++ ) {
+    bad |= ( d[k] > 9u ) ? 1 : 0;
   }
 
+  const int32_t year = static_cast<int32_t>( d[0]*1000 + d[1]*100 + d[2]*10 + d[3] );
+  const int32_t mon  = static_cast<int32_t>( d[4]*10  + d[5]  );
+  const int32_t day  = static_cast<int32_t>( d[6]*10  + d[7]  );
+  const int32_t hour = static_cast<int32_t>( d[8]*10  + d[9]  );
+  const int32_t min  = static_cast<int32_t>( d[10]*10 + d[11] );
+  const int32_t sc   = static_cast<int32_t>( d[12]*10 + d[13] );
+  const int32_t ms   = static_cast<int32_t>( d[14]*100 + d[15]*10 + d[16] );
+
+  const int32_t leap = ( ( 0 == ( year & 3 ) ) &
+                         ( ( 0 != ( year % 100 ) ) | ( 0 == ( year % 400 ) ) ) ) ? 1 : 0;
+  const int32_t dim  = DAYS_IN_MONTH[ mon & 15 ] + ( ( 2 == mon ) ? leap : 0 );
+
+  bad |= ( mon  < 1 ) | ( mon > 12 ) | ( day < 1 ) | ( day > dim );
+  bad |= ( hour > 23 ) | ( min > 59 ) | ( sc > 60 );
+
+  // ----- days from civil, all years here are positive -----
+  const int32_t y   = year - ( ( mon <= 2 ) ? 1 : 0 );
+  const int32_t era = y / 400;
+  const int32_t yoe = y - era*400;
+  const int32_t doy = ( 153*( ( mon > 2 ) ? ( mon - 3 ) : ( mon + 9 ) ) + 2 )/5 + day - 1;
+  const int32_t doe = yoe*365 + yoe/4 - yoe/100 + doy;
+  const int64_t z   = static_cast<int64_t>( era )*146097 + doe - 719468;
+
+  sec = static_cast<real8_t>( z*SEC_PER_DAY + hour*3600 + min*60 + sc ) +
+      static_cast<real8_t>( ms ) * 1.0e-3;
+
+  return bad;
+}
+
 
 // =======================================================================================
+/** @brief Number.
+ *  @param[out] v   value of the digits.
+ *  @param[in]  s   string.
+ *  @param[in]  i   index of the first digit, advanced past the digits.
+ *  @param[in]  len length of the string.
+ *  @param[in]  n   number of digits required.
+ *  @return true if n digits were not found.
+ */
 // ---------------------------------------------------------------------------------------
-  int32_t AbsoluteDate::getDay( void ) const {
+inline bool number( int32_t& v, const char* s, size_t& i, const size_t len, const int32_t n ) {
   // -------------------------------------------------------------------------------------
-    return 0;
+  if ( i + static_cast<size_t>( n ) > len ) { return true; }
+  v = 0;
+  for ( int32_t k=0; k<n; k++, i++ ) {
+    const int32_t c = static_cast<int32_t>( s[i] ) - '0';
+    if ( ( c < 0 ) || ( c > 9 ) ) { return true; }
+    v = v*10 + c;
   }
+  return false;
+}
 
 
 // =======================================================================================
+/** @brief General Layout.
+ *  @param[out] sec epoch seconds.
+ *  @param[in]  s   string.
+ *  @param[in]  len maximum number of characters to examine.
+ *  @return true if s is not a valid timestamp.
+ *
+ *  Accepts the ISO-8601 extended layout YYYY-MM-DD[Thh:mm[:ss[.s...]][zone]], where
+ *  the separator may also be a space, the decimal mark a comma and the zone is Z,
+ *  +hh, +hhmm or +hh:mm. A missing zone is taken as UTC.
+ */
 // ---------------------------------------------------------------------------------------
-  int32_t AbsoluteDate::getDayOfYear( void ) const {
+bool generalLayout( real8_t& sec, const char* s, const size_t len ) {
   // -------------------------------------------------------------------------------------
-    return 0;
+  size_t  i = 0;
+  int32_t year, mon, day, hour = 0, min = 0, sc = 0, off = 0;
+  real8_t frac = D_ZERO;
+
+  if ( number( year, s, i, len, 4 ) )     { return true; }
+  if ( ( i >= len ) || ( '-' != s[i++] ) ) { return true; }
+  if ( number( mon,  s, i, len, 2 ) )     { return true; }
+  if ( ( i >= len ) || ( '-' != s[i++] ) ) { return true; }
+  if ( number( day,  s, i, len, 2 ) )     { return true; }
+
+  if ( ( mon < 1 ) || ( mon > 12 ) )                  { return true; }
+  if ( ( day < 1 ) || ( day > daysInMonth( year, mon ) ) ) { return true; }
+
+  if ( ( i < len ) && ( ( 'T' == s[i] ) || ( ' ' == s[i] ) ) ) {
+    i++;
+    if ( number( hour, s, i, len, 2 ) )     { return true; }
+    if ( ( i >= len ) || ( ':' != s[i++] ) ) { return true; }
+    if ( number( min,  s, i, len, 2 ) )     { return true; }
+    if ( ( i < len ) && ( ':' == s[i] ) ) {
+      i++;
+      if ( number( sc, s, i, len, 2 ) ) { return true; }
+      if ( ( i < len ) && ( ( '.' == s[i] ) || ( ',' == s[i] ) ) ) {
+        i++;
+        real8_t scale = 1.0e-1;
+        const size_t first = i;
+        while ( ( i < len ) && ( s[i] >= '0' ) && ( s[i] <= '9' ) ) {
+          frac  += scale * static_cast<real8_t>( s[i] - '0' );
+          scale *= 1.0e-1;
+          i++;
+        }
+        if ( first == i ) { return true; }
+      }
+    }
+
+    if ( ( hour > 23 ) || ( min > 59 ) || ( sc > 60 ) ) { return true; }
+
+    if ( i < len ) {
+      if ( 'Z' == s[i] ) {
+        i++;
+      } else if ( ( '+' == s[i] ) || ( '-' == s[i] ) ) {
+        const int32_t sgn = ( '-' == s[i++] ) ? -1 : 1;
+        int32_t oh = 0, om = 0;
+        if ( number( oh, s, i, len, 2 ) ) { return true; }
+        if ( ( i < len ) && ( ':' == s[i] ) ) {
+          i++;
+          if ( number( om, s, i, len, 2 ) ) { return true; }
+        } else if ( ( i + 1 < len ) && ( s[i] >= '0' ) && ( s[i] <= '9' ) ) {
+          if ( number( om, s, i, len, 2 ) ) { return true; }
+        }
+        if ( ( oh > 23 ) || ( om > 59 ) ) { return true; }
+        off = sgn*( 60*oh + om );
+      }
+    }
   }
 
+  sec = static_cast<real8_t>( daysFromCivil( year, mon, day )*SEC_PER_DAY +
+                              hour*3600 + ( min - off )*60 + sc ) + frac;
+  return false;
+}
+
 
 // =======================================================================================
+/** @brief Fixed Format.
+ *  @param[out] buf destination of ISO_LENGTH characters.
+ *  @param[in]  sec epoch seconds.
+ *
+ *  Write YYYY-MM-DDThh:mm:ss.sssZ rounded to the millisecond. Epochs that are not
+ *  finite or fall outside of the years 0000-9999 are written as blanks.
+ */
 // ---------------------------------------------------------------------------------------
-  int32_t AbsoluteDate::getHour( void ) const {
+inline void fixedFormat( char* buf, const real8_t sec ) {
   // -------------------------------------------------------------------------------------
-    return 0;
+  if ( !( std::fabs( sec ) < 2.6e11 ) ) {
+    for ( int32_t k=0; k<AbsoluteDate::ISO_LENGTH; k++ ) { buf[k] = ' '; }
+    return;
   }
 
+  const int64_t ms  = std::llround( sec * 1.0e3 );
+  const int64_t msd = SEC_PER_DAY*1000;
+  int64_t days = ms / msd;
+  int64_t rem  = ms - days*msd;
+  if ( rem < 0 ) { rem += msd; days -= 1; }
+
+  int64_t y, m, d;
+  civilFromDays( y, m, d, days );
+  if ( ( y < 0 ) || ( y > 9999 ) ) {
+    for ( int32_t k=0; k<AbsoluteDate::ISO_LENGTH; k++ ) { buf[k] = ' '; }
+    return;
+  }
+
+  const int64_t frac = rem % 1000;
+  const int64_t tsec = rem / 1000;
+  const int64_t hh   = tsec / 3600;
+  const int64_t mm   = ( tsec / 60 ) % 60;
+  const int64_t ss   = tsec % 60;
+
+  const char* p;
+  p = DIGIT_PAIR + 2*( y / 100 ); buf[0]  = p[0]; buf[1]  = p[1];
+  p = DIGIT_PAIR + 2*( y % 100 ); buf[2]  = p[0]; buf[3]  = p[1];
+  buf[4]  = '-';
+  p = DIGIT_PAIR + 2*m;           buf[5]  = p[0]; buf[6]  = p[1];
+  buf[7]  = '-';
+  p = DIGIT_PAIR + 2*d;           buf[8]  = p[0]; buf[9]  = p[1];
+  buf[10] = 'T';
+  p = DIGIT_PAIR + 2*hh;          buf[11] = p[0]; buf[12] = p[1];
+  buf[13] = ':';
+  p = DIGIT_PAIR + 2*mm;          buf[14] = p[0]; buf[15] = p[1];
+  buf[16] = ':';
+  p = DIGIT_PAIR + 2*ss;          buf[17] = p[0]; buf[18] = p[1];
+  buf[19] = '.';
+  buf[20] = static_cast<char>( '0' + frac / 100 );
+  p = DIGIT_PAIR + 2*( frac % 100 ); buf[21] = p[0]; buf[22] = p[1];
+  buf[23] = 'Z';
+}
+
+
+} // end namespace
+
 
 // =======================================================================================
+/** @brief Set.
+ *  @param[in] yr year.
+ *  @param[in] mo month.         (default: 0, taken as January)
+ *  @param[in] da day of month.  (default: 0, taken as the first)
+ *  @param[in] hr hour.          (default: 0)
+ *  @param[in] mn minute.        (default: 0)
+ *  @param[in] sc second.        (default: 0.000)
+ *  @param[in] ut UTC offset in minutes of the local time given. (default: 0)
+ */
 // ---------------------------------------------------------------------------------------
-  int32_t AbsoluteDate::getMinute( void ) const {
+void AbsoluteDate::set( const int32_t yr, const int32_t mo, const int32_t da,
+                        const int32_t hr, const int32_t mn, const real8_t sc,
+                        const int32_t ut ) {
   // -------------------------------------------------------------------------------------
-    return 0;
-  }
+  const int64_t days = daysFromCivil( yr, ( 0 < mo ) ? mo : 1, ( 0 < da ) ? da : 1 );
+  epoch.span = static_cast<real8_t>( days*SEC_PER_DAY + hr*3600 + ( mn - ut )*60 ) + sc;
+}
 
 
 // =======================================================================================
+/** @brief Julian Date.
+ *  @return the Julian date of this epoch.
+ */
 // ---------------------------------------------------------------------------------------
-  real8_t AbsoluteDate::getSecond( void ) const {
+real8_t AbsoluteDate::getJD( void ) const {
   // -------------------------------------------------------------------------------------
-    return 0.0;
-  }
+  return JD_UNIX_EPOCH + epoch.span / 8.64e4;
+}
+
+
+// =======================================================================================
+/** @brief Year.
+ *  @return the calendar year.
+ */
+// ---------------------------------------------------------------------------------------
+int32_t AbsoluteDate::getYear( void ) const {
+  // -------------------------------------------------------------------------------------
+  int64_t y, m, d;
+  civilFromDays( y, m, d, static_cast<int64_t>( std::floor( epoch.span / 8.64e4 ) ) );
+  return static_cast<int32_t>( y );
+}
+
+
+// =======================================================================================
+/** @brief Month.
+ *  @return the month of the year (1-12).
+ */
+// ---------------------------------------------------------------------------------------
+int32_t AbsoluteDate::getMonth( void ) const {
+  // -------------------------------------------------------------------------------------
+  int64_t y, m, d;
+  civilFromDays( y, m, d, static_cast<int64_t>( std::floor( epoch.span / 8.64e4 ) ) );
+  return static_cast<int32_t>( m );
+}
+
+
+// =======================================================================================
+/** @brief Day.
+ *  @return the day of the month (1-31).
+ */
+// ---------------------------------------------------------------------------------------
+int32_t AbsoluteDate::getDay( void ) const {
+  // -------------------------------------------------------------------------------------
+  int64_t y, m, d;
+  civilFromDays( y, m, d, static_cast<int64_t>( std::floor( epoch.span / 8.64e4 ) ) );
+  return static_cast<int32_t>( d );
+}
 
 
 // =======================================================================================
+/** @brief Day of Year.
+ *  @return the day of the year (1-366).
+ */
 // ---------------------------------------------------------------------------------------
-  void AbsoluteDate::fromString( std::string str ) {
+int32_t AbsoluteDate::getDayOfYear( void ) const {
   // -------------------------------------------------------------------------------------
+  int64_t y, m, d;
+  const int64_t z = static_cast<int64_t>( std::floor( epoch.span / 8.64e4 ) );
+  civilFromDays( y, m, d, z );
+  return static_cast<int32_t>( z - daysFromCivil( y, 1, 1 ) + 1 );
+}
+
+
+// =======================================================================================
+/** @brief Hour.
+ *  @return the hour of the day (0-23).
+ */
+// ---------------------------------------------------------------------------------------
+int32_t AbsoluteDate::getHour( void ) const {
+  // -------------------------------------------------------------------------------------
+  const real8_t s = epoch.span - 8.64e4*std::floor( epoch.span / 8.64e4 );
+  return static_cast<int32_t>( s / 3.6e3 );
+}
+
+
+// =======================================================================================
+/** @brief Minute.
+ *  @return the minute of the hour (0-59).
+ */
+// ---------------------------------------------------------------------------------------
+int32_t AbsoluteDate::getMinute( void ) const {
+  // -------------------------------------------------------------------------------------
+  const real8_t s = epoch.span - 3.6e3*std::floor( epoch.span / 3.6e3 );
+  return static_cast<int32_t>( s / 6.0e1 );
+}
+
+
+// =======================================================================================
+/** @brief Second.
+ *  @return the second of the minute, with its fraction.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t AbsoluteDate::getSecond( void ) const {
+  // -------------------------------------------------------------------------------------
+  return epoch.span - 6.0e1*std::floor( epoch.span / 6.0e1 );
+}
+
+
+// =======================================================================================
+/** @brief From String.
+ *  @param[in] str ISO-8601 timestamp.
+ *
+ *  Set this epoch from str. An invalid timestamp sets the epoch to NaN.
+ */
+// ---------------------------------------------------------------------------------------
+void AbsoluteDate::fromString( std::string str ) {
+  // -------------------------------------------------------------------------------------
+  if ( parse( epoch.span, str.c_str(), str.size() ) ) {
+    epoch.span = std::nan( "" );
   }
+}
+
+
+// =======================================================================================
+/** @brief To String.
+ *  @return this epoch as YYYY-MM-DDThh:mm:ss.sssZ.
+ */
+// ---------------------------------------------------------------------------------------
+std::string AbsoluteDate::toString( void ) const {
+  // -------------------------------------------------------------------------------------
+  char buf[ ISO_LENGTH ];
+  format( buf, epoch.span );
+  return std::string( buf, static_cast<size_t>( ISO_LENGTH ) );
+}
 
 
 // =======================================================================================
+/** @brief Parse.
+ *  @param[out] sec epoch seconds.
+ *  @param[in]  str timestamp.
+ *  @param[in]  len maximum number of characters to examine.
+ *  @return true on error.
+ *
+ *  Convert one ISO-8601 timestamp to seconds since 1970-01-01T00:00:00Z. The layout
+ *  YYYY-MM-DDThh:mm:ss.sssZ is converted directly, any other extended layout is
+ *  parsed field by field. Characters that follow a complete timestamp are ignored.
+ */
 // ---------------------------------------------------------------------------------------
-  std::string AbsoluteDate::toString( void ) const {
+bool AbsoluteDate::parse( real8_t& sec, const char* str, const size_t len ) {
   // -------------------------------------------------------------------------------------
-    return "1970-01-01T00:00:00Z";
+  if ( len >= static_cast<size_t>( ISO_LENGTH ) ) {
+    if ( 0 == fixedLayout( sec, str ) ) { return false; }
   }
+  return generalLayout( sec, str, len );
+}
+
+
+// =======================================================================================
+/** @brief Parse.
+ *  @param[out] sec    array of n epoch seconds.
+ *  @param[in]  buf    buffer of fixed width records.
+ *  @param[in]  stride distance in characters between records.
+ *  @param[in]  n      number of records.
+ *  @return number of records that could not be parsed, their epochs are NaN.
+ *
+ *  Blocks of records are checked against the fixed layout in a simd loop; records
+ *  that fail the fast path fall back to the general parser.
+ */
+// ---------------------------------------------------------------------------------------
+int32_t AbsoluteDate::parse( real8_t* sec, const char* buf, const size_t stride,
+                             const int32_t n ) {
+  // -------------------------------------------------------------------------------------
+  const bool           fast = ( stride >= static_cast<size_t>( ISO_LENGTH ) );
+  std::atomic<int32_t> fail( 0 );
+
+  ThreadPool::global()->parallel_for( 0, n, [&]( const int64_t i0, const int64_t i1 ) {
+      const int32_t BLOCK = 256;
+      int32_t bad[ BLOCK ];
+      int32_t count = 0;
+      for ( int64_t b=i0; b<i1; b+=BLOCK ) {
+        const int32_t m = static_cast<int32_t>( ( ( i1 - b ) < BLOCK ) ? ( i1 - b ) : BLOCK );
+        const char*   S = buf + static_cast<size_t>( b )*stride;
+        real8_t*      T = sec + b;
+        if ( fast ) {
+#pragma omp simd
+          for ( int32_t i=0; i<m; i++ ) {
+            bad[i] = fixedLayout( T[i], S + static_cast<size_t>( i )*stride );
+          }
+        } else {
+          for ( int32_t i=0; i<m; i++ ) { bad[i] = 1; }
+        }
+        for ( int32_t i=0; i<m; i++ ) {
+          if ( bad[i] ) {
+            if ( generalLayout( T[i], S + static_cast<size_t>( i )*stride, stride ) ) {
+              T[i] = std::nan( "" );
+              count++;
+            }
+          }
+        }
+      }
+      fail += count;
+    }, 4096 );
+
+  return fail.load();
+}
+
+
+// =======================================================================================
+/** @brief Parse.
+ *  @param[out] sec array of n epoch seconds.
+ *  @param[in]  str array of n pointers to timestamps (e.g. from CSVTable::field).
+ *  @param[in]  len array of n timestamp lengths.
+ *  @param[in]  n   number of timestamps.
+ *  @return number of timestamps that could not be parsed, their epochs are NaN.
+ */
+// ---------------------------------------------------------------------------------------
+int32_t AbsoluteDate::parse( real8_t* sec, const char* const* str, const size_t* len,
+                             const int32_t n ) {
+  // -------------------------------------------------------------------------------------
+  std::atomic<int32_t> fail( 0 );
+
+  ThreadPool::global()->parallel_for( 0, n, [&]( const int64_t i0, const int64_t i1 ) {
+      int32_t count = 0;
+      for ( int64_t i=i0; i<i1; i++ ) {
+        if ( parse( sec[i], str[i], len[i] ) ) {
+          sec[i] = std::nan( "" );
+          count++;
+        }
+      }
+      fail += count;
+    }, 4096 );
+
+  return fail.load();
+}
+
+
+// =======================================================================================
+/** @brief Format.
+ *  @param[out] buf destination of at least ISO_LENGTH characters.
+ *  @param[in]  sec epoch seconds.
+ *  @return number of characters written (ISO_LENGTH), no terminator is written.
+ */
+// ---------------------------------------------------------------------------------------
+size_t AbsoluteDate::format( char* buf, const real8_t sec ) {
+  // -------------------------------------------------------------------------------------
+  fixedFormat( buf, sec );
+  return static_cast<size_t>( ISO_LENGTH );
+}
+
+
+// =======================================================================================
+/** @brief Format.
+ *  @param[out] buf    buffer of n fixed width records.
+ *  @param[in]  stride distance in characters between records (at least ISO_LENGTH).
+ *  @param[in]  sec    array of n epoch seconds.
+ *  @param[in]  n      number of epochs.
+ *
+ *  Write each epoch as YYYY-MM-DDThh:mm:ss.sssZ at the start of its record. The rest
+ *  of each record is left untouched, so that separators may be placed in advance.
+ */
+// ---------------------------------------------------------------------------------------
+void AbsoluteDate::format( char* buf, const size_t stride, const real8_t* sec,
+                           const int32_t n ) {
+  // -------------------------------------------------------------------------------------
+  ThreadPool::global()->parallel_for( 0, n, [=]( const int64_t i0, const int64_t i1 ) {
+      for ( int64_t i=i0; i<i1; i++ ) {
+        fixedFormat( buf + static_cast<size_t>( i )*stride, sec[i] );
+      }
+    }, 4096 );
+}
+
 
 // =======================================================================================
 // **                              A B S O L U T E D A T E                              **
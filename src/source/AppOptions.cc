@@ -105,9 +105,9 @@ AppOptions::classInstance::classInstance( void )
 AppOptions::classInstance::~classInstance( void ) {
   // -------------------------------------------------------------------------------------
   if ( static_cast<ConfigDB*>(0) != config ) {
-    logger->debug( "call for a delete of the embedded config instance" );
+    TLOG_DEBUG( logger, "call for a delete of the embedded config instance" );
     delete config;
-    logger->debug( "a delete of the embedded config instance wasd tried" );
+    TLOG_DEBUG( logger, "a delete of the embedded config instance wasd tried" );
   }
   config = static_cast<ConfigDB*>(0);
 
@@ -199,7 +199,7 @@ AppOptions::classInstance* AppOptions::getInstance( void ) {
   // -------------------------------------------------------------------------------------
   if ( ( AppOptions::classInstance*)0 == AppOptions::instance ) {
     AppOptions::instance = new AppOptions::classInstance();
-    logger->debug( "A global instance of AppOptions was instantiated" );
+    TLOG_DEBUG( logger, "A global instance of AppOptions was instantiated" );
   }
   return AppOptions::instance;
 }
@@ -229,9 +229,9 @@ void AppOptions::free( void ) {
   // -------------------------------------------------------------------------------------
   if (static_cast<AppOptions::classInstance*>(0) != AppOptions::instance) {
     delete AppOptions::instance;
-    logger->debug( "A global instance of AppOptions was derezzed" );
+    TLOG_DEBUG( logger, "A global instance of AppOptions was derezzed" );
   } else {
-    logger->debug( "A global instance of AppOptions was never allocated" );
+    TLOG_DEBUG( logger, "A global instance of AppOptions was never allocated" );
   }
   AppOptions::instance = static_cast<AppOptions::classInstance*>(0);
 }
@@ -815,7 +815,7 @@ ConfigDB* AppOptions::getConfigDB( void ) {
       if ( 0 < I->env_keyname.length() ) {
         if ( esec->hasKey( I->env_keyname ) ) {
           std::string cfgfn = esec->get( I->env_keyname );
-          logger->debug( "Reading config from ENV: %s", cfgfn.c_str() );
+          TLOG_DEBUG( logger, "Reading config from ENV: %s", cfgfn.c_str() );
           I->config->readINI( cfgfn );
         }
       }
@@ -831,7 +831,7 @@ ConfigDB* AppOptions::getConfigDB( void ) {
       if ( 0 < I->opt_keyname.length() ) {
         if ( csec->hasKey( I->opt_keyname ) ) {
           std::string cfgfn = csec->get( I->opt_keyname );
-          logger->debug( "Reading config from CMDLINE: %s", cfgfn.c_str() );
+          TLOG_DEBUG( logger, "Reading config from CMDLINE: %s", cfgfn.c_str() );
           I->config->readINI( cfgfn );
         }
       }
@@ -35,6 +35,9 @@
 
 
 #include <CSVFile.hh>
+#include <ThreadPool.hh>
+#include <cstring>
+#include <vector>
 
 #define R_INIT_VAR(a) fields(a), num_fields(a), next_record(a)
 #define C_INIT_VAR(a) head(a), tail(a), index(a), num_fields(a), num_records(a), head_label(a)
@@ -72,62 +75,76 @@ CSVFile::Record::~Record( void ) {
 
 
 
+// =======================================================================================
+/** @brief Split a line.
+ *  @param[out] R  Record to receive the fields.
+ *  @param[in]  a  start of the line.
+ *  @param[in]  b  end of the line (line break excluded).
+ *
+ *  Missing trailing fields are left empty.
+ */
+// ---------------------------------------------------------------------------------------
+static void split_line( CSVFile::Record* R, const char* a, const char* b ) {
+  // -------------------------------------------------------------------------------------
+  const size_t n = R->size();
+  for ( size_t i=0; ( i<n ) && ( a<b ); i++ ) {
+    const char* c = static_cast<const char*>( memchr( a, ',', static_cast<size_t>( b - a ) ) );
+    if ( static_cast<const char*>(0) == c ) { c = b; }
+    R->at(i).assign( a, static_cast<size_t>( c - a ) );
+    a = c + 1;
+  }
+}
+
+
 // =======================================================================================
 /**
  * @brief Constructor.
  * @param fspc path to a CSV file.
  *
- * 
+ * The file is mapped and cut into lines; the records are then split into fields in
+ * parallel on the global ThreadPool.
  */
 // ---------------------------------------------------------------------------------------
 CSVFile::CSVFile( std::string fspc ) : C_INIT_VAR(0) {
   // -------------------------------------------------------------------------------------
-  
-  std::string   line, word;
-  
-  std::ifstream fin(fspc);
-  
-  std::getline(fin, line); 
-  std::stringstream s1(line);
-  std::stringstream s2(line);
-
-  // -------------------------------------------------------------------------------------
-
-  num_fields = 0;
-  while (std::getline(s1, word, ',')) { 
-    num_fields += 1;
-  } 
+  ParseTool::Buffer buf( fspc );
 
-  head_label = new Record( num_fields );
-  for ( size_t i=0; i<num_fields; i++ ) {
-    std::getline(s2, word, ',');
-    head_label->at(i) = word;
-  }
+  // ----- start and end of every line ---------------------------------------------------
+  std::vector<const char*> line;
+  std::vector<const char*> stop;
+  ParseTool::lines( line, stop, buf.begin(), buf.end() );
 
   // -------------------------------------------------------------------------------------
 
-  num_records = 0;
-  while( std::getline(fin, line) ) {
-    std::stringstream s3(line);
-    Record* rec = append();
-    for ( size_t i=0; i<num_fields; i++ ) {
-      std::getline(s3, word, ',');
-      rec->at(i) = word;
+  num_fields = 0;
+  if ( ( ! stop.empty() ) && ( line[0] < stop[0] ) ) {
+    num_fields = 1;
+    for ( const char* c = line[0]; c < stop[0]; ++c ) {
+      if ( ',' == *c ) { num_fields += 1; }
     }
-    num_records += 1;
   }
 
-  fin.close();
+  head_label = new Record( num_fields );
+  if ( ! stop.empty() ) {
+    split_line( head_label, line[0], stop[0] );
+  }
 
   // -------------------------------------------------------------------------------------
 
-  index = new Record*[num_records];
-  
-  Record* rec = head;
+  num_records = ( stop.empty() ) ? 0 : ( stop.size() - 1 );
+  index       = new Record*[num_records];
   for ( size_t i=0; i<num_records; i++ ) {
-    index[i] = rec;
-    rec = rec->next();
+    index[i] = append();
   }
+
+  Record** ip = index;
+  ThreadPool::global()->parallel_for( 0, static_cast<int64_t>( num_records ),
+                                      [ip, &line, &stop]( int64_t i0, int64_t i1 ) {
+    for ( int64_t i=i0; i<i1; i++ ) {
+      const size_t k = static_cast<size_t>( i + 1 );
+      split_line( ip[i], line[k], stop[k] );
+    }
+  }, 1024 );
 }
 
 
@@ -0,0 +1,300 @@
+// ====================================================================== BEGIN FILE =====
+// **                                  C S V T A B L E                                  **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Columnar CSV reader.
+ *  @file   CSVTable.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18.
+ *
+ *  Provides the methods for the columnar CSV reader.
+ */
+// =======================================================================================
+
+#include <CSVTable.hh>
+#include <ThreadPool.hh>
+#include <cstring>
+#include <limits>
+
+TLOGGER_REFERENCE( CSVTable, logger );
+
+size_t CSVTable::NOT_FOUND = 9999999;
+
+
+namespace {
+
+// =======================================================================================
+/** @brief Split a line.
+ *  @param[out] st  offsets of the fields.
+ *  @param[out] ln  lengths of the fields.
+ *  @param[in]  nf  number of fields to record.
+ *  @param[in]  b0  start of the file buffer.
+ *  @param[in]  a   start of the line.
+ *  @param[in]  b   end of the line (line break excluded).
+ *
+ *  Missing trailing fields are recorded as empty; extra fields are ignored.
+ */
+// ---------------------------------------------------------------------------------------
+void split_line( u_int64_t* st, u_int32_t* ln, const size_t nf,
+                 const char* b0, const char* a, const char* b ) {
+  // -------------------------------------------------------------------------------------
+  for ( size_t i=0; i<nf; i++ ) {
+    const char* c = b;
+    if ( a < b ) {
+      c = static_cast<const char*>( memchr( a, ',', static_cast<size_t>( b - a ) ) );
+      if ( static_cast<const char*>(0) == c ) { c = b; }
+    }
+    st[i] = static_cast<u_int64_t>( a - b0 );
+    ln[i] = static_cast<u_int32_t>( c - a );
+    a = ( c < b ) ? ( c + 1 ) : b;
+  }
+}
+
+
+// =======================================================================================
+/** @brief Trim a field.
+ *  @param[in,out] p start of the field, moved past leading separators.
+ *  @param[in,out] e end of the field, moved before trailing separators.
+ */
+// ---------------------------------------------------------------------------------------
+inline void trim( const char*& p, const char*& e ) {
+  // -------------------------------------------------------------------------------------
+  p = ParseTool::skip( p, e );
+  while ( ( e > p ) && ParseTool::isSeparator( e[-1] ) ) { --e; }
+}
+
+} // end namespace
+
+
+// =======================================================================================
+/** @brief Constructor.
+ *  @param[in] fspc path to a CSV file.
+ *
+ *  Map the file, find the line breaks and record the field offsets of each record in
+ *  parallel. A file that can not be opened gives an empty table for which bad() is true.
+ */
+// ---------------------------------------------------------------------------------------
+CSVTable::CSVTable( const std::string fspc )
+    : buf( new ParseTool::Buffer( fspc ) ), num_fields(0), num_records(0), labels(),
+      start(), length(), real_col(), int_col() {
+  // -------------------------------------------------------------------------------------
+  if ( buf->bad() ) {
+    logger->error( "CSVTable: cannot open %s for reading.", fspc.c_str() );
+    return;
+  }
+
+  const char* b0 = buf->begin();
+  const char* e  = buf->end();
+
+  // ----- start and end of every line ---------------------------------------------------
+  std::vector<const char*> line;
+  std::vector<const char*> stop;
+  const size_t nline = ParseTool::lines( line, stop, b0, e );
+  if ( 0 == nline ) { return; }
+
+  // ----- labels -------------------------------------------------------------------------
+  if ( line[0] < stop[0] ) {
+    num_fields = 1;
+    for ( const char* c = line[0]; c < stop[0]; ++c ) {
+      if ( ',' == *c ) { num_fields += 1; }
+    }
+  }
+  {
+    std::vector<u_int64_t> st( num_fields );
+    std::vector<u_int32_t> ln( num_fields );
+    split_line( st.data(), ln.data(), num_fields, b0, line[0], stop[0] );
+    for ( size_t i=0; i<num_fields; i++ ) {
+      labels.push_back( std::string( b0 + st[i], ln[i] ) );
+    }
+  }
+
+  // ----- records ------------------------------------------------------------------------
+  num_records = nline - 1;
+  start.resize(  num_records * num_fields );
+  length.resize( num_records * num_fields );
+  real_col.resize( num_fields );
+  int_col.resize(  num_fields );
+
+  const size_t nf = num_fields;
+  u_int64_t*   sp = start.data();
+  u_int32_t*   lp = length.data();
+  ThreadPool::global()->parallel_for( 0, static_cast<int64_t>( num_records ),
+                                      [=, &line, &stop]( int64_t i0, int64_t i1 ) {
+    for ( int64_t i=i0; i<i1; i++ ) {
+      const size_t r = static_cast<size_t>( i );
+      split_line( sp + r*nf, lp + r*nf, nf, b0, line[r+1], stop[r+1] );
+    }
+  }, 4096 );
+}
+
+
+// =======================================================================================
+/** @brief Destructor.
+ */
+// ---------------------------------------------------------------------------------------
+CSVTable::~CSVTable( void ) {
+  // -------------------------------------------------------------------------------------
+  delete buf;
+  buf = static_cast<ParseTool::Buffer*>(0);
+}
+
+
+// =======================================================================================
+/** @brief Find.
+ *  @param[in] label field label.
+ *  @return index of the field, or NOT_FOUND.
+ */
+// ---------------------------------------------------------------------------------------
+size_t CSVTable::find( const std::string label ) const {
+  // -------------------------------------------------------------------------------------
+  for ( size_t i=0; i<num_fields; i++ ) {
+    if ( 0 == label.compare( labels[i] ) ) {
+      return i;
+    }
+  }
+  return CSVTable::NOT_FOUND;
+}
+
+
+// =======================================================================================
+/** @brief Get Real8.
+ *  @param[in] recn record index.
+ *  @param[in] fldn field index.
+ *  @return value of the field, or NaN if it is not a number.
+ *
+ *  Surrounding white space is ignored.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t CSVTable::getReal8( const size_t recn, const size_t fldn ) const {
+  // -------------------------------------------------------------------------------------
+  size_t      n = 0;
+  const char* p = field( recn, fldn, n );
+  const char* e = p + n;
+  trim( p, e );
+
+  real8_t     x = D_ZERO;
+  const char* r = ParseTool::real8( p, e, x );
+  if ( ( p < e ) && ( e == r ) ) { return x; }
+  return std::numeric_limits<real8_t>::quiet_NaN();
+}
+
+
+// =======================================================================================
+/** @brief Get Int64.
+ *  @param[in] recn record index.
+ *  @param[in] fldn field index.
+ *  @return value of the field, or zero if it is not an integer.
+ *
+ *  Surrounding white space is ignored.
+ */
+// ---------------------------------------------------------------------------------------
+int64_t CSVTable::getInt64( const size_t recn, const size_t fldn ) const {
+  // -------------------------------------------------------------------------------------
+  size_t      n = 0;
+  const char* p = field( recn, fldn, n );
+  const char* e = p + n;
+  trim( p, e );
+
+  int64_t     x = 0;
+  const char* r = ParseTool::int64( p, e, x );
+  if ( ( p < e ) && ( e == r ) ) { return x; }
+  return 0;
+}
+
+
+// =======================================================================================
+/** @brief Real8 column.
+ *  @param[in] fldn field index.
+ *  @return converted column of size(0) values, or null if fldn is out of range.
+ *
+ *  The column is converted in parallel on the first request and cached until release().
+ *  Fields that are not numbers become NaN.
+ */
+// ---------------------------------------------------------------------------------------
+const real8_t* CSVTable::real8Column( const size_t fldn ) {
+  // -------------------------------------------------------------------------------------
+  if ( fldn >= num_fields ) { return static_cast<const real8_t*>(0); }
+
+  std::vector<real8_t>& col = real_col[fldn];
+  if ( col.size() != num_records ) {
+    col.resize( num_records );
+    real8_t* dst = col.data();
+    ThreadPool::global()->parallel_for( 0, static_cast<int64_t>( num_records ),
+                                        [this, dst, fldn]( int64_t i0, int64_t i1 ) {
+      for ( int64_t i=i0; i<i1; i++ ) {
+        dst[i] = getReal8( static_cast<size_t>( i ), fldn );
+      }
+    }, 8192 );
+  }
+  return col.data();
+}
+
+
+// =======================================================================================
+/** @brief Int64 column.
+ *  @param[in] fldn field index.
+ *  @return converted column of size(0) values, or null if fldn is out of range.
+ *
+ *  The column is converted in parallel on the first request and cached until release().
+ *  Fields that are not integers become zero.
+ */
+// ---------------------------------------------------------------------------------------
+const int64_t* CSVTable::int64Column( const size_t fldn ) {
+  // -------------------------------------------------------------------------------------
+  if ( fldn >= num_fields ) { return static_cast<const int64_t*>(0); }
+
+  std::vector<int64_t>& col = int_col[fldn];
+  if ( col.size() != num_records ) {
+    col.resize( num_records );
+    int64_t* dst = col.data();
+    ThreadPool::global()->parallel_for( 0, static_cast<int64_t>( num_records ),
+                                        [this, dst, fldn]( int64_t i0, int64_t i1 ) {
+      for ( int64_t i=i0; i<i1; i++ ) {
+        dst[i] = getInt64( static_cast<size_t>( i ), fldn );
+      }
+    }, 8192 );
+  }
+  return col.data();
+}
+
+
+// =======================================================================================
+/** @brief Release.
+ *
+ *  Free every converted column.
+ */
+// ---------------------------------------------------------------------------------------
+void CSVTable::release( void ) {
+  // -------------------------------------------------------------------------------------
+  for ( size_t i=0; i<num_fields; i++ ) {
+    std::vector<real8_t>().swap( real_col[i] );
+    std::vector<int64_t>().swap( int_col[i] );
+  }
+}
+
+
+// =======================================================================================
+// **                                  C S V T A B L E                                  **
+// ======================================================================== END FILE =====
@@ -685,12 +685,12 @@ ConfigDB::ConfigDB( const std::string fspc ) : file_comments(0), sections(0), se
 ConfigDB::~ConfigDB( void ) {
   // -------------------------------------------------------------------------------------
   if ( static_cast<Comments*>(0) == file_comments ) {
-    logger->debug( "ConfigDB::~ConfigDB - free file_comments" );
+    TLOG_DEBUG( logger, "ConfigDB::~ConfigDB - free file_comments" );
     delete file_comments;
   }
 
   if ( 0 == sections ) {
-    logger->debug( "ConfigDB::~ConfigDB - free sections" );
+    TLOG_DEBUG( logger, "ConfigDB::~ConfigDB - free sections" );
     delete sections;
   }
 }
@@ -0,0 +1,727 @@
+// ====================================================================== BEGIN FILE =====
+// **                                    D O P R I 5                                    **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Dormand-Prince.
+ *  @file   DOPRI5.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides the abstract methods for an adaptive Dormand-Prince 5(4) numerical
+ *  integrator.
+ *
+ *  Coefficients, dense output and step size control follow E. Hairer, S.P. Norsett and
+ *  G. Wanner, Solving Ordinary Differential Equations I, 2nd ed., Springer 1993.
+ */
+// =======================================================================================
+
+
+#include <DOPRI5.hh>
+#include <ThreadPool.hh>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+
+namespace {
+
+// ----- nodes and coefficients ----------------------------------------------------------
+
+const real8_t C2  = 1.0/5.0;
+const real8_t C3  = 3.0/10.0;
+const real8_t C4  = 4.0/5.0;
+const real8_t C5  = 8.0/9.0;
+
+const real8_t A21 = 1.0/5.0;
+const real8_t A31 = 3.0/40.0,        A32 = 9.0/40.0;
+const real8_t A41 = 44.0/45.0,       A42 = -56.0/15.0,      A43 = 32.0/9.0;
+const real8_t A51 = 19372.0/6561.0,  A52 = -25360.0/2187.0, A53 = 64448.0/6561.0,
+              A54 = -212.0/729.0;
+const real8_t A61 = 9017.0/3168.0,   A62 = -355.0/33.0,     A63 = 46732.0/5247.0,
+              A64 = 49.0/176.0,      A65 = -5103.0/18656.0;
+const real8_t A71 = 35.0/384.0,      A73 = 500.0/1113.0,    A74 = 125.0/192.0,
+              A75 = -2187.0/6784.0,  A76 = 11.0/84.0;
+
+const real8_t E1  = 71.0/57600.0,    E3  = -71.0/16695.0,   E4  = 71.0/1920.0,
+              E5  = -17253.0/339200.0, E6 = 22.0/525.0,     E7  = -1.0/40.0;
+
+const real8_t D1  = -12715105075.0/11282082432.0;
+const real8_t D3  =  87487479700.0/32700410799.0;
+const real8_t D4  = -10690763975.0/1880347072.0;
+const real8_t D5  =  701980252875.0/199316789632.0;
+const real8_t D6  = -1453857185.0/822651844.0;
+const real8_t D7  =  69997945.0/29380423.0;
+
+// ----- step size control ---------------------------------------------------------------
+
+const real8_t SAFE  = 0.9;
+const real8_t FACC1 = 5.0;    ///< 1/(smallest step ratio 0.2)
+const real8_t FACC2 = 0.1;    ///< 1/(largest  step ratio 10)
+const real8_t BETA  = 0.04;
+const real8_t EXPO1 = 0.2 - BETA*0.75;
+
+
+// =======================================================================================
+/** @brief Stages.
+ *  @param[out]    Y  state at the end of the step.
+ *  @param[in,out] K  seven stage derivatives. K[0] holds f(t,Q) on entry.
+ *  @param[in]     W  work vector.
+ *  @param[in]     Q  state at the start of the step.
+ *  @param[in]     L  number of elements.
+ *  @param[in]     t  time at the start of the step.
+ *  @param[in]     h  step size.
+ *  @param[in]     f  derivative, called as f( Kd, W, t ).
+ *
+ *  The stage combinations act element by element, so the same code serves one state
+ *  vector and a SoA block of them.
+ */
+// ---------------------------------------------------------------------------------------
+template<class FN>
+void stages( real8_t* Y, real8_t** K, real8_t* W, const real8_t* Q,
+             const size_t L, const real8_t t, const real8_t h, FN f ) {
+  // -------------------------------------------------------------------------------------
+  const real8_t* k1 = K[0];
+  real8_t* k2 = K[1];
+  real8_t* k3 = K[2];
+  real8_t* k4 = K[3];
+  real8_t* k5 = K[4];
+  real8_t* k6 = K[5];
+  real8_t* k7 = K[6];
+
+  for ( size_t j=0; j<L; j++ ) {
+    W[j] = Q[j] + h*A21*k1[j];
+  }
+  f( k2, W, t + C2*h );
+
+  for ( size_t j=0; j<L; j++ ) {
+    W[j] = Q[j] + h*( A31*k1[j] + A32*k2[j] );
+  }
+  f( k3, W, t + C3*h );
+
+  for ( size_t j=0; j<L; j++ ) {
+    W[j] = Q[j] + h*( A41*k1[j] + A42*k2[j] + A43*k3[j] );
+  }
+  f( k4, W, t + C4*h );
+
+  for ( size_t j=0; j<L; j++ ) {
+    W[j] = Q[j] + h*( A51*k1[j] + A52*k2[j] + A53*k3[j] + A54*k4[j] );
+  }
+  f( k5, W, t + C5*h );
+
+  for ( size_t j=0; j<L; j++ ) {
+    W[j] = Q[j] + h*( A61*k1[j] + A62*k2[j] + A63*k3[j] + A64*k4[j] + A65*k5[j] );
+  }
+  f( k6, W, t + h );
+
+  for ( size_t j=0; j<L; j++ ) {
+    Y[j] = Q[j] + h*( A71*k1[j] + A73*k3[j] + A74*k4[j] + A75*k5[j] + A76*k6[j] );
+  }
+  f( k7, Y, t + h );
+}
+
+
+// =======================================================================================
+/** @brief Scaled error.
+ *  @param[in] K    seven stage derivatives.
+ *  @param[in] Q    state at the start of the step.
+ *  @param[in] Y    state at the end of the step.
+ *  @param[in] j    element index.
+ *  @param[in] h    step size.
+ *  @param[in] rtol relative tolerance.
+ *  @param[in] atol absolute tolerance.
+ *  @return square of the local error estimate divided by its tolerance.
+ */
+// ---------------------------------------------------------------------------------------
+inline real8_t error2( real8_t** K, const real8_t* Q, const real8_t* Y, const size_t j,
+                       const real8_t h, const real8_t rtol, const real8_t atol ) {
+  // -------------------------------------------------------------------------------------
+  const real8_t e  = h*( E1*K[0][j] + E3*K[2][j] + E4*K[3][j] +
+                         E5*K[4][j] + E6*K[5][j] + E7*K[6][j] );
+  const real8_t aq = std::fabs( Q[j] );
+  const real8_t ay = std::fabs( Y[j] );
+  const real8_t sk = atol + rtol*( ( aq > ay ) ? aq : ay );
+  return ( e*e ) / ( sk*sk );
+}
+
+
+// =======================================================================================
+/** @brief Step size factor.
+ *  @param[in]  err    scaled error norm of the step.
+ *  @param[in]  facold scaled error norm of the last accepted step.
+ *  @param[out] fac11  err^EXPO1, used again after a rejection.
+ *  @return divisor of the current step size for an accepted step.
+ */
+// ---------------------------------------------------------------------------------------
+inline real8_t factor( const real8_t err, const real8_t facold, real8_t& fac11 ) {
+  // -------------------------------------------------------------------------------------
+  fac11 = std::pow( err, EXPO1 );
+  real8_t fac = fac11 / std::pow( facold, BETA ) / SAFE;
+  fac = ( fac < FACC1 ) ? fac : FACC1;
+  return ( fac > FACC2 ) ? fac : FACC2;
+}
+
+
+// =======================================================================================
+/** @brief Initial step.
+ *  @param[in] K    K[0] holds f(t,Q). K[1] and W are used as work space.
+ *  @param[in] W    work vector.
+ *  @param[in] Q    initial states, nm members of nd elements, element (j,m) at j*nm+m.
+ *  @param[in] nd   number of equations.
+ *  @param[in] nm   number of members.
+ *  @param[in] t    initial time.
+ *  @param[in] hbig largest allowed magnitude, signed in the direction of integration.
+ *  @param[in] rtol relative tolerance.
+ *  @param[in] atol absolute tolerance.
+ *  @param[in] f    derivative, called as f( Kd, W, t ).
+ *  @return initial step size, the smallest over the members.
+ */
+// ---------------------------------------------------------------------------------------
+template<class FN>
+real8_t initial( real8_t** K, real8_t* W, const real8_t* Q,
+                 const size_t nd, const size_t nm, const real8_t t, const real8_t hbig,
+                 const real8_t rtol, const real8_t atol, FN f ) {
+  // -------------------------------------------------------------------------------------
+  const real8_t dir = ( hbig < D_ZERO ) ? -D_ONE : D_ONE;
+  const real8_t big = std::fabs( hbig );
+  const size_t  L   = nd*nm;
+
+  real8_t h = big;
+  for ( size_t m=0; m<nm; m++ ) {
+    real8_t dnf = D_ZERO;
+    real8_t dny = D_ZERO;
+    for ( size_t j=0; j<nd; j++ ) {
+      const size_t  k  = j*nm + m;
+      const real8_t sk = atol + rtol*std::fabs( Q[k] );
+      dnf += ( K[0][k]/sk )*( K[0][k]/sk );
+      dny += ( Q[k]/sk )*( Q[k]/sk );
+    }
+    const real8_t hm = ( ( dnf <= 1.0e-10 ) || ( dny <= 1.0e-10 ) ) ?
+        1.0e-6 : 1.0e-2*std::sqrt( dny/dnf );
+    h = ( hm < h ) ? hm : h;
+  }
+
+  for ( size_t k=0; k<L; k++ ) {
+    W[k] = Q[k] + dir*h*K[0][k];
+  }
+  f( K[1], W, t + dir*h );
+
+  real8_t h1 = 1.0e2*h;
+  for ( size_t m=0; m<nm; m++ ) {
+    real8_t dnf = D_ZERO;
+    real8_t d2  = D_ZERO;
+    for ( size_t j=0; j<nd; j++ ) {
+      const size_t  k  = j*nm + m;
+      const real8_t sk = atol + rtol*std::fabs( Q[k] );
+      const real8_t dd = ( K[1][k] - K[0][k] ) / sk;
+      dnf += ( K[0][k]/sk )*( K[0][k]/sk );
+      d2  += dd*dd;
+    }
+    const real8_t der2  = std::sqrt( d2/static_cast<real8_t>(nd) ) / h;
+    const real8_t der1  = std::sqrt( dnf/static_cast<real8_t>(nd) );
+    const real8_t der12 = ( der2 > der1 ) ? der2 : der1;
+    const real8_t hm    = ( der12 <= 1.0e-15 ) ?
+        ( ( 1.0e-6 > h*1.0e-3 ) ? 1.0e-6 : h*1.0e-3 ) : std::pow( 1.0e-2/der12, 0.2 );
+    h1 = ( hm < h1 ) ? hm : h1;
+  }
+
+  h = ( h1 < big ) ? h1 : big;
+  return dir*h;
+}
+
+} // end namespace
+
+
+// =======================================================================================
+/** @brief Constructor.
+ *  @param[in] n number of coupled first-order differential equations.
+ *
+ *  Allocate work vectors for integration. The tolerances default to 1e-6 relative and
+ *  1e-9 absolute.
+ */
+// ---------------------------------------------------------------------------------------
+DOPRI5::DOPRI5( int32_t n ) : RK4(n), E(0), F(0), G(0), Y(0), R(0),
+                              rtol(1.0e-6), atol(1.0e-9), hmax(D_ZERO), hinit(D_ZERO),
+                              max_step(100000), t_old(D_ZERO), h_old(D_ZERO),
+                              n_eval(0), n_accept(0), n_reject(0) {
+  // -------------------------------------------------------------------------------------
+  E = new real8_t[dim];
+  F = new real8_t[dim];
+  G = new real8_t[dim];
+  Y = new real8_t[dim];
+  R = new real8_t[5*dim];
+}
+
+
+// =======================================================================================
+/** @brief Destructor.
+ *
+ *  Free work vectors for integration.
+ */
+// ---------------------------------------------------------------------------------------
+DOPRI5::~DOPRI5( void ) {
+  // -------------------------------------------------------------------------------------
+  delete[] E;
+  delete[] F;
+  delete[] G;
+  delete[] Y;
+  delete[] R;
+}
+
+
+// =======================================================================================
+/** @brief Tolerance.
+ *  @param[in] rel relative error tolerance.
+ *  @param[in] abs absolute error tolerance.
+ */
+// ---------------------------------------------------------------------------------------
+void DOPRI5::tolerance( const real8_t rel, const real8_t abs ) {
+  // -------------------------------------------------------------------------------------
+  rtol = rel;
+  atol = abs;
+}
+
+
+// =======================================================================================
+/** @brief Limits.
+ *  @param[in] h0   initial step size, or zero to estimate it.
+ *  @param[in] hmx  largest step size, or zero for no limit.
+ *  @param[in] nmax largest number of steps per call.
+ */
+// ---------------------------------------------------------------------------------------
+void DOPRI5::limits( const real8_t h0, const real8_t hmx, const int32_t nmax ) {
+  // -------------------------------------------------------------------------------------
+  hinit    = std::fabs( h0 );
+  hmax     = std::fabs( hmx );
+  max_step = nmax;
+}
+
+
+// =======================================================================================
+/** @brief Initial Step.
+ *  @param[in] Q     current state vector. A holds its derivative.
+ *  @param[in] t     current time.
+ *  @param[in] h_end signed distance to the final time.
+ *  @param[in] P     parameter vector.
+ *  @return initial step size, signed in the direction of integration.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t DOPRI5::initial_step( real8_t* Q, real8_t t, real8_t h_end, real8_t* P ) {
+  // -------------------------------------------------------------------------------------
+  real8_t big = std::fabs( h_end );
+  if ( ( hmax > D_ZERO ) && ( hmax < big ) ) { big = hmax; }
+  const real8_t dir = ( h_end < D_ZERO ) ? -D_ONE : D_ONE;
+
+  if ( hinit > D_ZERO ) {
+    return dir*( ( hinit < big ) ? hinit : big );
+  }
+
+  real8_t* K[7] = { A, B, C, D, E, F, G };
+  n_eval += 1;
+  return initial( K, W, Q, static_cast<size_t>(dim), 1, t, dir*big, rtol, atol,
+                  [this, P]( real8_t* Kd, real8_t* X, real8_t tt ) {
+                    difeq( Kd, X, tt, P ); } );
+}
+
+
+// =======================================================================================
+/** @brief Step.
+ *  @param[in] Q current state vector. A holds its derivative.
+ *  @param[in] t current time.
+ *  @param[in] h step size.
+ *  @param[in] P parameter vector.
+ *  @return scaled error norm. The step is acceptable when it is not above one.
+ *
+ *  Y receives the state at t+h and G its derivative.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t DOPRI5::step( real8_t* Q, real8_t t, real8_t h, real8_t* P ) {
+  // -------------------------------------------------------------------------------------
+  real8_t* K[7] = { A, B, C, D, E, F, G };
+  const size_t L = static_cast<size_t>(dim);
+
+  stages( Y, K, W, Q, L, t, h, [this, P]( real8_t* Kd, real8_t* X, real8_t tt ) {
+      difeq( Kd, X, tt, P ); } );
+  n_eval += 6;
+
+  real8_t sum = D_ZERO;
+  for ( size_t j=0; j<L; j++ ) {
+    sum += error2( K, Q, Y, j, h, rtol, atol );
+  }
+  return std::sqrt( sum / static_cast<real8_t>(dim) );
+}
+
+
+// =======================================================================================
+/** @brief Dense Output.
+ *  @param[out] Qt state vector at time t.
+ *  @param[in]  t  time within the last accepted step.
+ */
+// ---------------------------------------------------------------------------------------
+void DOPRI5::dense( real8_t* Qt, const real8_t t ) const {
+  // -------------------------------------------------------------------------------------
+  const real8_t s  = ( t - t_old ) / h_old;
+  const real8_t s1 = D_ONE - s;
+  const real8_t* R0 = R;
+  const real8_t* R1 = R +   dim;
+  const real8_t* R2 = R + 2*dim;
+  const real8_t* R3 = R + 3*dim;
+  const real8_t* R4 = R + 4*dim;
+  for ( int32_t j=0; j<dim; j++ ) {
+    Qt[j] = R0[j] + s*( R1[j] + s1*( R2[j] + s*( R3[j] + s1*R4[j] ) ) );
+  }
+}
+
+
+// =======================================================================================
+/** @brief Adaptive Dormand-Prince.
+ *  @param[in,out] Q  real vector containing the state.
+ *  @param[in]     t0 initial time.
+ *  @param[in]     t1 final time.
+ *  @param         P  vector containing fixed parameters.
+ *  @return time reached, t1 unless check() or event() stopped the integration.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t DOPRI5::integrate( real8_t* Q, real8_t t0, real8_t t1, real8_t* P ) {
+  // -------------------------------------------------------------------------------------
+  return integrate( Q, t0, t1, P, static_cast<const real8_t*>(0), 0,
+                    static_cast<real8_t*>(0) );
+}
+
+
+// =======================================================================================
+/** @brief Adaptive Dormand-Prince with dense output.
+ *  @param[in,out] Q    real vector containing the state.
+ *  @param[in]     t0   initial time.
+ *  @param[in]     t1   final time.
+ *  @param         P    vector containing fixed parameters.
+ *  @param[in]     tout output times, ordered in the direction of integration.
+ *  @param[in]     nout number of output times.
+ *  @param[out]    Qout state at each output time, row k at Qout + k*dim.
+ *  @return time reached, t1 unless check() or event() stopped the integration, or the
+ *          step size or step count limits were exceeded.
+ *
+ *  The output states are interpolated on the dense output of each accepted step, so
+ *  they do not shorten the steps. Rows for output times that were not reached are not
+ *  written. When event() changes sign over a step, the root is located on the dense
+ *  output with the Illinois method and Q is left at the event.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t DOPRI5::integrate( real8_t* Q, real8_t t0, real8_t t1, real8_t* P,
+                           const real8_t* tout, const int32_t nout, real8_t* Qout ) {
+  // -------------------------------------------------------------------------------------
+  n_eval   = 0;
+  n_accept = 0;
+  n_reject = 0;
+
+  int32_t kout = 0;
+  while ( ( kout < nout ) && !( std::fabs( tout[kout] - t0 ) > D_ZERO ) ) {
+    for ( int32_t j=0; j<dim; j++ ) { Qout[kout*dim + j] = Q[j]; }
+    kout++;
+  }
+
+  if ( 0 != check( Q, t0, P ) ) { return t0; }
+  if ( !( std::fabs( t1 - t0 ) > D_ZERO ) ) { return t0; }
+
+  const real8_t dir = ( t1 < t0 ) ? -D_ONE : D_ONE;
+  const real8_t eps = 4.0*std::numeric_limits<real8_t>::epsilon();
+
+  difeq( A, Q, t0, P );
+  n_eval += 1;
+
+  real8_t g_old  = event( Q, t0, P );
+  real8_t t      = t0;
+  real8_t h      = initial_step( Q, t0, t1 - t0, P );
+  real8_t facold = 1.0e-4;
+  bool    reject = false;
+
+  for ( int32_t ns=0; ns<max_step; ns++ ) {
+    bool last = false;
+    if ( std::fabs( h ) >= std::fabs( t1 - t ) ) {
+      h    = t1 - t;
+      last = true;
+    }
+
+    if ( std::fabs( h ) <= eps*std::fabs( t ) ) {
+      return t;
+    }
+
+    real8_t fac11 = D_ZERO;
+    const real8_t err  = step( Q, t, h, P );
+    const real8_t fac  = factor( err, facold, fac11 );
+    real8_t       hnew = h / fac;
+
+    if ( err > D_ONE ) { // ----- reject ---------------------------------------------------
+      hnew   = h / ( ( fac11/SAFE < FACC1 ) ? ( fac11/SAFE ) : FACC1 );
+      reject = true;
+      n_reject += 1;
+      h = hnew;
+      continue;
+    }
+
+    // ----- accept -----------------------------------------------------------------------
+    facold    = ( err > 1.0e-4 ) ? err : 1.0e-4;
+    n_accept += 1;
+
+    real8_t* R0 = R;
+    real8_t* R1 = R +   dim;
+    real8_t* R2 = R + 2*dim;
+    real8_t* R3 = R + 3*dim;
+    real8_t* R4 = R + 4*dim;
+    for ( int32_t j=0; j<dim; j++ ) {
+      const real8_t dy = Y[j] - Q[j];
+      const real8_t bs = h*A[j] - dy;
+      R0[j] = Q[j];
+      R1[j] = dy;
+      R2[j] = bs;
+      R3[j] = dy - h*G[j] - bs;
+      R4[j] = h*( D1*A[j] + D3*C[j] + D4*D[j] + D5*E[j] + D6*F[j] + D7*G[j] );
+    }
+    t_old = t;
+    h_old = h;
+
+    const real8_t t_new = last ? t1 : ( t + h );
+    real8_t       t_end = t_new;
+    const real8_t g_new = event( Y, t_new, P );
+    const bool    fired = ( ( g_old < D_ZERO ) != ( g_new < D_ZERO ) );
+
+    if ( fired ) { // ----- Illinois on the dense output ----------------------------------
+      real8_t ta = t;
+      real8_t ga = g_old;
+      real8_t tb = t_new;
+      real8_t gb = g_new;
+      int32_t side = 0;
+      for ( int32_t it=0; it<100; it++ ) {
+        if ( std::fabs( tb - ta ) <= eps*( std::fabs( t ) + std::fabs( h ) ) ) { break; }
+        const real8_t tc = ( tb*ga - ta*gb ) / ( ga - gb );
+        dense( W, tc );
+        const real8_t gc = event( W, tc, P );
+        if ( ( gc < D_ZERO ) == ( gb < D_ZERO ) ) {
+          tb = tc; gb = gc;
+          if ( -1 == side ) { ga *= D_HALF; }
+          side = -1;
+        } else {
+          ta = tc; ga = gc;
+          if ( +1 == side ) { gb *= D_HALF; }
+          side = +1;
+        }
+        if ( !( std::fabs( gc ) > D_ZERO ) ) { tb = tc; break; }
+      }
+      t_end = tb;
+    }
+
+    while ( ( kout < nout ) && ( dir*( tout[kout] - t_end ) <= D_ZERO ) ) {
+      if ( dir*( tout[kout] - t ) >= D_ZERO ) {
+        dense( Qout + kout*dim, tout[kout] );
+      }
+      kout++;
+    }
+
+    if ( fired ) {
+      dense( Q, t_end );
+      return t_end;
+    }
+
+    for ( int32_t j=0; j<dim; j++ ) { Q[j] = Y[j]; }
+    real8_t* swap = A;  A = G;  G = swap;
+    t     = t_new;
+    g_old = g_new;
+
+    if ( 0 != check( Q, t, P ) ) { return t; }
+    if ( last ) { return t; }
+
+    if ( reject && ( std::fabs( hnew ) > std::fabs( h ) ) ) { hnew = h; }
+    reject = false;
+    if ( ( hmax > D_ZERO ) && ( std::fabs( hnew ) > hmax ) ) { hnew = dir*hmax; }
+    h = hnew;
+  }
+
+  return t;
+}
+
+
+// =======================================================================================
+/** @brief Block derivative.
+ *  @param[out] Qd first time derivatives, SoA.
+ *  @param[in]  Q  states of n members, element j of member m at Q[j*n+m].
+ *  @param[in]  n  number of members.
+ *  @param[in]  t  current time.
+ *  @param[in]  P  parameter vector.
+ *
+ *  Gather each member, call difeq and scatter the result. Override with a vectorised
+ *  version when the equations allow it.
+ */
+// ---------------------------------------------------------------------------------------
+void DOPRI5::difeqBlock( real8_t* Qd, real8_t* Q, int32_t n, real8_t t, real8_t* P ) {
+  // -------------------------------------------------------------------------------------
+  std::vector<real8_t> buf( 2*static_cast<size_t>( dim ) );
+  real8_t* q = buf.data();
+  real8_t* d = q + dim;
+  for ( int32_t m=0; m<n; m++ ) {
+    for ( int32_t j=0; j<dim; j++ ) { q[j] = Q[j*n + m]; }
+    difeq( d, q, t, P );
+    for ( int32_t j=0; j<dim; j++ ) { Qd[j*n + m] = d[j]; }
+  }
+}
+
+
+// =======================================================================================
+/** @brief Ensemble.
+ *  @param[in,out] Q  states of n members, element j of member m at Q[j*n+m].
+ *  @param[in]     n  number of members.
+ *  @param[in]     t0 initial time.
+ *  @param[in]     t1 final time.
+ *  @param         P  vector containing fixed parameters, shared by every member.
+ *  @param[out]    T  optional, time reached by each member (n elements).
+ *  @return time reached by the member that got least far, t1 unless a block ran out of
+ *          steps (max_step) or its step size underflowed.
+ *
+ *  Integrate every member from t0 to t1. Members are split into blocks that run in
+ *  parallel. Each block takes adaptive steps controlled by its worst member, so the
+ *  stage arithmetic runs over contiguous SoA arrays. A block that stops early leaves
+ *  its members at the time it reached.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t DOPRI5::ensemble( real8_t* Q, const int32_t n, real8_t t0, real8_t t1, real8_t* P,
+                          real8_t* T ) {
+  // -------------------------------------------------------------------------------------
+  if ( 1 > n ) { return t1; }
+
+  if ( !( std::fabs( t1 - t0 ) > D_ZERO ) ) {
+    if ( static_cast<real8_t*>(0) != T ) {
+      for ( int32_t m=0; m<n; m++ ) { T[m] = t1; }
+    }
+    return t1;
+  }
+
+  const int32_t BLOCK = 64;
+
+  std::vector<real8_t> reach( static_cast<size_t>( n ), t0 );
+  real8_t* reached = reach.data();
+
+  ThreadPool::global()->parallel_for( 0, n, [this, Q, reached, n, t0, t1, P]
+                                      ( int64_t i0, int64_t i1 ) {
+    const size_t  nd  = static_cast<size_t>( dim );
+    const real8_t dir = ( t1 < t0 ) ? -D_ONE : D_ONE;
+    const real8_t eps = 4.0*std::numeric_limits<real8_t>::epsilon();
+
+    for ( int64_t m0=i0; m0<i1; m0+=BLOCK ) {
+      const int32_t nb = static_cast<int32_t>( ( i1-m0 < BLOCK ) ? ( i1-m0 ) : BLOCK );
+      const size_t  L  = nd * static_cast<size_t>( nb );
+
+      std::vector<real8_t> buf( 10*L );
+      real8_t* q  = buf.data();
+      real8_t* y  = q + L;
+      real8_t* w  = y + L;
+      real8_t* K[7];
+      for ( int32_t s=0; s<7; s++ ) { K[s] = w + static_cast<size_t>(s+1)*L; }
+
+      for ( size_t j=0; j<nd; j++ ) {
+        for ( int32_t m=0; m<nb; m++ ) {
+          q[ j*static_cast<size_t>(nb) + static_cast<size_t>(m) ] =
+              Q[ j*static_cast<size_t>(n) + static_cast<size_t>(m0+m) ];
+        }
+      }
+
+      auto f = [this, nb, P]( real8_t* Kd, real8_t* X, real8_t tt ) {
+        difeqBlock( Kd, X, nb, tt, P );
+      };
+
+      f( K[0], q, t0 );
+
+      real8_t big = std::fabs( t1 - t0 );
+      if ( ( hmax > D_ZERO ) && ( hmax < big ) ) { big = hmax; }
+      real8_t h = ( hinit > D_ZERO ) ? dir*( ( hinit < big ) ? hinit : big )
+          : initial( K, w, q, nd, static_cast<size_t>(nb), t0, dir*big, rtol, atol, f );
+
+      real8_t t      = t0;
+      real8_t facold = 1.0e-4;
+      bool    reject = false;
+
+      for ( int32_t ns=0; ns<max_step; ns++ ) {
+        bool last = false;
+        if ( std::fabs( h ) >= std::fabs( t1 - t ) ) {
+          h    = t1 - t;
+          last = true;
+        }
+        if ( std::fabs( h ) <= eps*std::fabs( t ) ) { break; }
+
+        stages( y, K, w, q, L, t, h, f );
+
+        real8_t err = D_ZERO;
+        for ( int32_t m=0; m<nb; m++ ) {
+          real8_t sum = D_ZERO;
+          for ( size_t j=0; j<nd; j++ ) {
+            sum += error2( K, q, y, j*static_cast<size_t>(nb) + static_cast<size_t>(m),
+                           h, rtol, atol );
+          }
+          err = ( sum > err ) ? sum : err;
+        }
+        err = std::sqrt( err / static_cast<real8_t>(dim) );
+
+        real8_t fac11 = D_ZERO;
+        const real8_t fac  = factor( err, facold, fac11 );
+        real8_t       hnew = h / fac;
+
+        if ( err > D_ONE ) {
+          h = h / ( ( fac11/SAFE < FACC1 ) ? ( fac11/SAFE ) : FACC1 );
+          reject = true;
+          continue;
+        }
+
+        facold = ( err > 1.0e-4 ) ? err : 1.0e-4;
+        for ( size_t k=0; k<L; k++ ) { q[k] = y[k]; }
+        real8_t* swap = K[0];  K[0] = K[6];  K[6] = swap;
+        t = last ? t1 : ( t + h );
+        if ( last ) { break; }
+
+        if ( reject && ( std::fabs( hnew ) > std::fabs( h ) ) ) { hnew = h; }
+        reject = false;
+        if ( ( hmax > D_ZERO ) && ( std::fabs( hnew ) > hmax ) ) { hnew = dir*hmax; }
+        h = hnew;
+      }
+
+      for ( size_t j=0; j<nd; j++ ) {
+        for ( int32_t m=0; m<nb; m++ ) {
+          Q[ j*static_cast<size_t>(n) + static_cast<size_t>(m0+m) ] =
+              q[ j*static_cast<size_t>(nb) + static_cast<size_t>(m) ];
+        }
+      }
+      for ( int32_t m=0; m<nb; m++ ) { reached[ m0+m ] = t; }
+    }
+  }, BLOCK );
+
+  const real8_t dir  = ( t1 < t0 ) ? -D_ONE : D_ONE;
+  real8_t       tmin = t1;
+  for ( int32_t m=0; m<n; m++ ) {
+    if ( dir*( reached[m] - tmin ) < D_ZERO ) { tmin = reached[m]; }
+    if ( static_cast<real8_t*>(0) != T ) { T[m] = reached[m]; }
+  }
+  return tmin;
+}
+
+
+// =======================================================================================
+// **                                    D O P R I 5                                    **
+// ======================================================================== END FILE =====
@@ -36,6 +36,8 @@
 
 #include <Exemplar.hh>
 #include <FileTool.hh>
+#include <ParseTool.hh>
+#include <vector>
 
 #define INIT_VAR2(_a) data(_a), n_buf(_a), n_samp(_a), n_vars(_a)
 
@@ -473,42 +475,96 @@ void Exemplar::copy( Exemplar& src, exemplar_data_e wd ) {
 
 
 // =======================================================================================
+/** @brief Read Pair.
+ *  @param[in]  p    start of the text.
+ *  @param[in]  e    end of the text.
+ *  @param[out] idat reference to an input  data object.
+ *  @param[in]  ns   number of samples.
+ *  @param[in]  ni   number of input variables.
+ *  @param[out] odat reference to an output data object.
+ *  @param[in]  no   number of output variables.
+ *  @return true if an error occurs.
+ *
+ *  Each sample holds ni input values followed by no output values.
+ */
 // ---------------------------------------------------------------------------------------
-bool Exemplar::read_pair( std::ifstream& inf,
+bool Exemplar::read_pair( const char* p, const char* e,
                           Data& idat, const int32_t ns, const int32_t ni,
                           Data& odat, const int32_t no ) {
   // -------------------------------------------------------------------------------------
-  real8_t x;
+  const int64_t nv = static_cast<int64_t>( ni + no );
+  std::vector<real8_t> buf( static_cast<size_t>( ns * nv ) );
+
+  const int64_t n = ParseTool::values( p, e, buf.data(), ns, nv, nv, 1 );
+  if ( n != ns*nv ) {
+    logger->error( "Exemplar: expected %ld values, parsed %ld.", ns*nv, n );
+    return true;
+  }
+
   idat.resize( ns, ni );
   odat.resize( ns, no );
+  const real8_t* src = buf.data();
   for ( int32_t i=0; i<ns; i++ ) {
-    for ( int32_t j=0; j<ni; j++ ) {
-      inf >> x; idat.set( i,j, x );
-    }
-    for ( int32_t j=0; j<no; j++ ) {
-      inf >> x; odat.set( i,j, x );
-    }
+    real8_t* di = idat.get( i );
+    real8_t* d0 = odat.get( i );
+    for ( int32_t j=0; j<ni; j++ ) { di[j] = *src++; }
+    for ( int32_t j=0; j<no; j++ ) { d0[j] = *src++; }
   }
   return false;
 }
 
 
 // =======================================================================================
+/** @brief Read Single.
+ *  @param[in]  p    start of the text.
+ *  @param[in]  e    end of the text.
+ *  @param[out] idat reference to an input  data object.
+ *  @param[in]  ns   number of samples.
+ *  @param[in]  ni   number of input variables.
+ *  @return true if an error occurs.
+ */
 // ---------------------------------------------------------------------------------------
-bool Exemplar::read_single( std::ifstream& inf,
+bool Exemplar::read_single( const char* p, const char* e,
                             Data& idat, const int32_t ns, const int32_t ni ) {
   // -------------------------------------------------------------------------------------
-  real8_t x;
   idat.resize( ns, ni );
-  for ( int32_t i=0; i<ns; i++ ) {
-    for ( int32_t j=0; j<ni; j++ ) {
-      inf >> x; idat.set( i,j, x );
-    }
+
+  const int64_t n = ParseTool::values( p, e, idat.get(), ns, ni, ni, 1 );
+  if ( n != static_cast<int64_t>( ns ) * ni ) {
+    logger->error( "Exemplar: expected %ld values, parsed %ld.",
+                   static_cast<int64_t>( ns ) * ni, n );
+    return true;
   }
   return false;
 }
 
 
+// =======================================================================================
+/** @brief Read Data.
+ *  @param[in] df     full path to a data file.
+ *  @param[in] offset number of bytes preceding the data (e.g. a Meta line).
+ *  @param[in] meta   sizes of the datasets.
+ *  @return true if error occurs.
+ */
+// ---------------------------------------------------------------------------------------
+bool Exemplar::read_data( const std::string df, const size_t offset, const Meta& meta ) {
+  // -------------------------------------------------------------------------------------
+  ParseTool::Buffer buf( df, offset );
+
+  if ( buf.bad() ) {
+    logger->error( "Exemplar::read:  Cannot open %s for reading.", df.c_str() );
+    return true;
+  }
+
+  return ( 0 < meta.n_output ) ?
+      Exemplar::read_pair(   buf.begin(), buf.end(),
+                             input,  meta.n_sample, meta.n_input,
+                             output, meta.n_output ) :
+      Exemplar::read_single( buf.begin(), buf.end(),
+                             input,  meta.n_sample, meta.n_input );
+}
+
+
 // =======================================================================================
 /** @brief Write Pair.
  *  @param[in] outf reference to an output filer stream.
@@ -591,19 +647,16 @@ bool Exemplar::read( std::string mfdf ) {
     return true;
   }
 
-  bool rv = true;
   Meta meta;
-  if ( ! meta.read( inf ) ) {
-    rv = ( 0 < meta.n_output ) ?
-        Exemplar::read_pair(   inf,
-                               input,  meta.n_sample, meta.n_input,
-                               output, meta.n_output ) :
-        Exemplar::read_single( inf,
-                               input,  meta.n_sample, meta.n_input );
+  if ( meta.read( inf ) ) {
+    inf.close();
+    return true;
   }
 
+  const std::streamoff offset = inf.tellg();
   inf.close();
-  return rv;
+
+  return read_data( mfdf, static_cast<size_t>( ( 0 < offset ) ? offset : 0 ), meta );
 }
 
 
@@ -623,23 +676,23 @@ bool Exemplar::read( std::string mf, std::string df ) {
     return true;
   }
  
-  int istat;
-  std::ifstream inf = FileTool::openRead( df, &istat );
+  return read_data( df, 0, meta );
+}
 
-  if ( 0 != istat ) {
-    logger->error( "Exemplar::read:  Cannot open %s for reading.", df );
-    return true;
-  }
 
-  bool rv = ( 0 < meta.n_output ) ?
-      Exemplar::read_pair(   inf,
-                             input,  meta.n_sample, meta.n_input,
-                             output, meta.n_output ) :
-      Exemplar::read_single( inf,
-                             input,  meta.n_sample, meta.n_input );
-  
-  inf.close();
-  return rv;
+// =======================================================================================
+/** @brief Read.
+ *  @param[in] df full path to an Data file.
+ *  @param[in] ns number of samples.
+ *  @param[in] ni number of input variables.
+ *  @param[in] no number of output variables.
+ *  @return true if error occurs.
+ */
+// ---------------------------------------------------------------------------------------
+bool Exemplar::read( std::string df, const int32_t ns, const int32_t ni, const int32_t no ) {
+  // -------------------------------------------------------------------------------------
+  destroy();
+  return read_data( df, 0, Meta( ns, ni, no ) );
 }
 
 
@@ -0,0 +1,729 @@
+// ====================================================================== BEGIN FILE =====
+// **                                      H 5 I O                                      **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  HDF5 input and output.
+ *  @file   H5IO.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18.
+ *
+ *  Provides the functions for HDF5 storage of Table, Matrix and Exemplar.
+ *
+ *  Rows are moved in blocks of one chunk. Row major sources are written directly; column
+ *  major sources (Table and Matrix) are transposed one block at a time, so the extra
+ *  memory is bounded by the chunk size rather than the dataset size.
+ */
+// =======================================================================================
+
+#include <H5IO.hh>
+#include <FileTool.hh>
+#include <hdf5.h>
+#include <vector>
+
+
+namespace {
+
+TLOGGER_INSTANCE( logger );
+
+const size_t H5IO_MAX_CHUNK = 1 << 24;  ///< largest chunk in elements (128 MiB)
+
+
+// =======================================================================================
+/** @brief HDF5 identifier.
+ *
+ *  Closes the identifier when it goes out of scope.
+ */
+// ---------------------------------------------------------------------------------------
+class Handle {
+  // -------------------------------------------------------------------------------------
+ protected:
+  hid_t  id;                 ///< HDF5 identifier, negative if invalid
+  herr_t (*closer)(hid_t);   ///< matching close function
+
+ private:
+  Handle( const Handle& );
+  Handle& operator=( const Handle& );
+
+ public:
+  Handle( hid_t i, herr_t (*c)(hid_t) ) : id(i), closer(c) {}
+  ~Handle( void ) { if ( 0 <= id ) { closer( id ); } }
+
+  operator hid_t ( void ) const { return id; }
+  bool     bad   ( void ) const { return ( 0 > id ); }
+};
+
+
+// =======================================================================================
+/** @brief Join a group and a dataset name.
+ *  @param[in] group group path, empty or "/" for the root.
+ *  @param[in] name  dataset name.
+ *  @return path of the dataset.
+ */
+// ---------------------------------------------------------------------------------------
+std::string join( const std::string& group, const char* name ) {
+  // -------------------------------------------------------------------------------------
+  if ( group.empty() || ( "/" == group ) ) { return std::string( name ); }
+  if ( '/' == group[group.size()-1] )      { return group + name; }
+  return group + "/" + name;
+}
+
+
+// =======================================================================================
+/** @brief Open a file.
+ *  @param[in] fspc     file specification.
+ *  @param[in] writable open for update, creating the file if it is not an HDF5 file.
+ *  @return file identifier, negative on failure.
+ */
+// ---------------------------------------------------------------------------------------
+hid_t open_file( const std::string& fspc, const bool writable ) {
+  // -------------------------------------------------------------------------------------
+  hid_t fid = -1;
+  H5E_BEGIN_TRY {
+    if ( ! writable ) {
+      fid = H5Fopen( fspc.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+    } else if ( FileTool::fileExists( fspc ) && ( 0 < H5Fis_hdf5( fspc.c_str() ) ) ) {
+      fid = H5Fopen( fspc.c_str(), H5F_ACC_RDWR, H5P_DEFAULT );
+    } else {
+      fid = H5Fcreate( fspc.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT );
+    }
+  } H5E_END_TRY;
+
+  if ( 0 > fid ) {
+    logger->error( "H5IO: cannot open %s for %s.", fspc.c_str(),
+                   writable ? "writing" : "reading" );
+  }
+  return fid;
+}
+
+
+// =======================================================================================
+/** @brief Test for a link.
+ *  @param[in] loc  file or group identifier.
+ *  @param[in] path object path.
+ *  @return true if the path names an object.
+ */
+// ---------------------------------------------------------------------------------------
+bool exists( hid_t loc, const std::string& path ) {
+  // -------------------------------------------------------------------------------------
+  htri_t rv = 0;
+  H5E_BEGIN_TRY {
+    rv = H5Lexists( loc, path.c_str(), H5P_DEFAULT );
+  } H5E_END_TRY;
+  return ( 0 < rv );
+}
+
+
+// =======================================================================================
+/** @brief Open a dataset.
+ *  @param[in]  fid  file identifier.
+ *  @param[in]  path dataset path.
+ *  @param[out] dims current (rows, columns).
+ *  @return dataset identifier, negative on failure.
+ */
+// ---------------------------------------------------------------------------------------
+hid_t open_dataset( hid_t fid, const std::string& path, hsize_t dims[2] ) {
+  // -------------------------------------------------------------------------------------
+  hid_t did = -1;
+  if ( exists( fid, path ) ) {
+    H5E_BEGIN_TRY {
+      did = H5Dopen2( fid, path.c_str(), H5P_DEFAULT );
+    } H5E_END_TRY;
+  }
+  if ( 0 > did ) {
+    logger->error( "H5IO: no dataset %s.", path.c_str() );
+    return -1;
+  }
+
+  Handle space( H5Dget_space( did ), H5Sclose );
+  if ( 2 != H5Sget_simple_extent_ndims( space ) ) {
+    logger->error( "H5IO: dataset %s is not two dimensional.", path.c_str() );
+    H5Dclose( did );
+    return -1;
+  }
+  H5Sget_simple_extent_dims( space, dims, static_cast<hsize_t*>(0) );
+  return did;
+}
+
+
+// =======================================================================================
+/** @brief Create a dataset.
+ *  @param[in] fid  file identifier.
+ *  @param[in] path dataset path, an existing dataset is replaced.
+ *  @param[in] nr   number of rows.
+ *  @param[in] nc   number of columns.
+ *  @param[in] opt  creation options.
+ *  @return dataset identifier, negative on failure.
+ */
+// ---------------------------------------------------------------------------------------
+hid_t create_dataset( hid_t fid, const std::string& path, const int32_t nr, const int32_t nc,
+                      const H5IO::Options& opt ) {
+  // -------------------------------------------------------------------------------------
+  if ( ( 0 > nr ) || ( 1 > nc ) ) {
+    logger->error( "H5IO: cannot store a %d x %d dataset.", nr, nc );
+    return -1;
+  }
+
+  if ( exists( fid, path ) ) {
+    H5Ldelete( fid, path.c_str(), H5P_DEFAULT );
+  }
+
+  size_t crow = static_cast<size_t>( ( 0 < opt.chunk_rows ) ? opt.chunk_rows : 1 );
+  if ( crow * static_cast<size_t>( nc ) > H5IO_MAX_CHUNK ) {
+    crow = H5IO_MAX_CHUNK / static_cast<size_t>( nc );
+    if ( 0 == crow ) { crow = 1; }
+  }
+
+  hsize_t dims[2]  = { static_cast<hsize_t>( nr ), static_cast<hsize_t>( nc ) };
+  hsize_t maxd[2]  = { H5S_UNLIMITED,              static_cast<hsize_t>( nc ) };
+  hsize_t chunk[2] = { static_cast<hsize_t>( crow ), static_cast<hsize_t>( nc ) };
+
+  Handle space( H5Screate_simple( 2, dims, maxd ), H5Sclose );
+  Handle lcpl( H5Pcreate( H5P_LINK_CREATE ),    H5Pclose );
+  Handle dcpl( H5Pcreate( H5P_DATASET_CREATE ), H5Pclose );
+
+  H5Pset_create_intermediate_group( lcpl, 1 );
+  H5Pset_chunk( dcpl, 2, chunk );
+  if ( 0 < opt.deflate ) {
+    if ( 0 < H5Zfilter_avail( H5Z_FILTER_DEFLATE ) ) {
+      if ( opt.shuffle ) { H5Pset_shuffle( dcpl ); }
+      H5Pset_deflate( dcpl, static_cast<unsigned>( ( 9 < opt.deflate ) ? 9 : opt.deflate ) );
+    } else {
+      logger->warn( "H5IO: deflate is not available, %s is stored uncompressed.",
+                    path.c_str() );
+    }
+  }
+
+  hid_t did = H5Dcreate2( fid, path.c_str(), H5T_NATIVE_DOUBLE, space,
+                          lcpl, dcpl, H5P_DEFAULT );
+  if ( 0 > did ) {
+    logger->error( "H5IO: cannot create dataset %s.", path.c_str() );
+  }
+  return did;
+}
+
+
+// =======================================================================================
+/** @brief Rows per transfer block.
+ *  @param[in] did dataset identifier.
+ *  @return chunk rows of the dataset.
+ */
+// ---------------------------------------------------------------------------------------
+size_t block_rows( hid_t did ) {
+  // -------------------------------------------------------------------------------------
+  hsize_t chunk[2] = { 1024, 1 };
+  Handle dcpl( H5Dget_create_plist( did ), H5Pclose );
+  if ( H5D_CHUNKED == H5Pget_layout( dcpl ) ) {
+    H5Pget_chunk( dcpl, 2, chunk );
+  }
+  return static_cast<size_t>( chunk[0] );
+}
+
+
+// =======================================================================================
+/** @brief Write rows.
+ *  @param[in] did  dataset identifier.
+ *  @param[in] row0 first dataset row to write.
+ *  @param[in] base address of element (0,0) of the source.
+ *  @param[in] nr   number of rows.
+ *  @param[in] nc   number of columns.
+ *  @param[in] rs   element stride between rows of the source.
+ *  @param[in] cs   element stride between columns of the source.
+ *  @return true if an error occured.
+ */
+// ---------------------------------------------------------------------------------------
+bool put_rows( hid_t did, const size_t row0, const real8_t* base,
+               const size_t nr, const size_t nc, const size_t rs, const size_t cs ) {
+  // -------------------------------------------------------------------------------------
+  const bool   direct = ( ( 1 == cs ) && ( nc == rs ) );
+  const size_t block  = direct ? nr : block_rows( did );
+
+  Handle fspace( H5Dget_space( did ), H5Sclose );
+  std::vector<real8_t> buf;
+
+  for ( size_t r0=0; r0<nr; r0+=block ) {
+    const size_t   n   = ( nr - r0 < block ) ? ( nr - r0 ) : block;
+    const real8_t* src = base + r0*rs;
+    if ( ! direct ) {
+      buf.resize( n*nc );
+      for ( size_t j=0; j<nc; j++ ) {
+        const real8_t* s = base + r0*rs + j*cs;
+        for ( size_t i=0; i<n; i++ ) { buf[i*nc + j] = s[i*rs]; }
+      }
+      src = buf.data();
+    }
+
+    hsize_t start[2] = { static_cast<hsize_t>( row0 + r0 ), 0 };
+    hsize_t count[2] = { static_cast<hsize_t>( n ), static_cast<hsize_t>( nc ) };
+    Handle  mspace( H5Screate_simple( 2, count, static_cast<hsize_t*>(0) ), H5Sclose );
+    H5Sselect_hyperslab( fspace, H5S_SELECT_SET, start, static_cast<hsize_t*>(0),
+                         count, static_cast<hsize_t*>(0) );
+    if ( 0 > H5Dwrite( did, H5T_NATIVE_DOUBLE, mspace, fspace, H5P_DEFAULT, src ) ) {
+      logger->error( "H5IO: write failed." );
+      return true;
+    }
+  }
+  return false;
+}
+
+
+// =======================================================================================
+/** @brief Read rows.
+ *  @param[in] did  dataset identifier.
+ *  @param[in] row0 first dataset row to read.
+ *  @param[in] base address of element (0,0) of the destination.
+ *  @param[in] nr   number of rows.
+ *  @param[in] nc   number of columns.
+ *  @param[in] rs   element stride between rows of the destination.
+ *  @param[in] cs   element stride between columns of the destination.
+ *  @return true if an error occured.
+ */
+// ---------------------------------------------------------------------------------------
+bool get_rows( hid_t did, const size_t row0, real8_t* base,
+               const size_t nr, const size_t nc, const size_t rs, const size_t cs ) {
+  // -------------------------------------------------------------------------------------
+  const bool   direct = ( ( 1 == cs ) && ( nc == rs ) );
+  const size_t block  = direct ? nr : block_rows( did );
+
+  Handle fspace( H5Dget_space( did ), H5Sclose );
+  std::vector<real8_t> buf;
+
+  for ( size_t r0=0; r0<nr; r0+=block ) {
+    const size_t n   = ( nr - r0 < block ) ? ( nr - r0 ) : block;
+    real8_t*     dst = base + r0*rs;
+    if ( ! direct ) {
+      buf.resize( n*nc );
+      dst = buf.data();
+    }
+
+    hsize_t start[2] = { static_cast<hsize_t>( row0 + r0 ), 0 };
+    hsize_t count[2] = { static_cast<hsize_t>( n ), static_cast<hsize_t>( nc ) };
+    Handle  mspace( H5Screate_simple( 2, count, static_cast<hsize_t*>(0) ), H5Sclose );
+    H5Sselect_hyperslab( fspace, H5S_SELECT_SET, start, static_cast<hsize_t*>(0),
+                         count, static_cast<hsize_t*>(0) );
+    if ( 0 > H5Dread( did, H5T_NATIVE_DOUBLE, mspace, fspace, H5P_DEFAULT, dst ) ) {
+      logger->error( "H5IO: read failed." );
+      return true;
+    }
+
+    if ( ! direct ) {
+      for ( size_t j=0; j<nc; j++ ) {
+        real8_t* d = base + r0*rs + j*cs;
+        for ( size_t i=0; i<n; i++ ) { d[i*rs] = buf[i*nc + j]; }
+      }
+    }
+  }
+  return false;
+}
+
+
+// =======================================================================================
+/** @brief Resolve a row range.
+ *  @param[in,out] count requested rows, negative for the rest of the dataset.
+ *  @param[in]     first first requested row.
+ *  @param[in]     nrow  rows in the dataset.
+ *  @return true if the range does not fit the dataset.
+ */
+// ---------------------------------------------------------------------------------------
+bool range( int32_t& count, const int32_t first, const hsize_t nrow ) {
+  // -------------------------------------------------------------------------------------
+  const int64_t n = static_cast<int64_t>( nrow );
+  if ( ( 0 > first ) || ( first > n ) ) {
+    logger->error( "H5IO: first row %d outside of [0,%ld].", first, n );
+    return true;
+  }
+  if ( 0 > count ) {
+    count = static_cast<int32_t>( n - first );
+  }
+  if ( first + static_cast<int64_t>( count ) > n ) {
+    logger->error( "H5IO: rows [%d,%d) exceed %ld.", first, first+count, n );
+    return true;
+  }
+  return false;
+}
+
+
+// =======================================================================================
+/** @brief Write an integer attribute.
+ *  @param[in] loc   object identifier.
+ *  @param[in] name  attribute name, an existing attribute is replaced.
+ *  @param[in] value attribute value.
+ */
+// ---------------------------------------------------------------------------------------
+void put_attr( hid_t loc, const char* name, const int32_t value ) {
+  // -------------------------------------------------------------------------------------
+  if ( 0 < H5Aexists( loc, name ) ) { H5Adelete( loc, name ); }
+  Handle space( H5Screate( H5S_SCALAR ), H5Sclose );
+  Handle attr( H5Acreate2( loc, name, H5T_NATIVE_INT32, space, H5P_DEFAULT, H5P_DEFAULT ),
+               H5Aclose );
+  H5Awrite( attr, H5T_NATIVE_INT32, &value );
+}
+
+
+// =======================================================================================
+/** @brief Read an integer attribute.
+ *  @param[in]  loc   object identifier.
+ *  @param[in]  name  attribute name.
+ *  @param[out] value attribute value.
+ *  @return true if an error occured.
+ */
+// ---------------------------------------------------------------------------------------
+bool get_attr( hid_t loc, const char* name, int32_t& value ) {
+  // -------------------------------------------------------------------------------------
+  if ( 0 >= H5Aexists( loc, name ) ) {
+    logger->error( "H5IO: missing attribute %s.", name );
+    return true;
+  }
+  Handle attr( H5Aopen( loc, name, H5P_DEFAULT ), H5Aclose );
+  return ( 0 > H5Aread( attr, H5T_NATIVE_INT32, &value ) );
+}
+
+} // end namespace
+
+
+namespace H5IO {
+
+
+// =======================================================================================
+/** @brief Shape.
+ *  @param[out] nrow number of rows in the dataset.
+ *  @param[out] ncol number of columns in the dataset.
+ *  @param[in]  fspc file specification.
+ *  @param[in]  dset dataset path.
+ *  @return true if an error occured.
+ *
+ *  Query the size of a dataset without reading it, e.g. to plan a streamed read.
+ */
+// ---------------------------------------------------------------------------------------
+bool shape( int32_t& nrow, int32_t& ncol, const std::string fspc, const std::string dset ) {
+  // -------------------------------------------------------------------------------------
+  Handle fid( open_file( fspc, false ), H5Fclose );
+  if ( fid.bad() ) { return true; }
+
+  hsize_t dims[2];
+  Handle did( open_dataset( fid, dset, dims ), H5Dclose );
+  if ( did.bad() ) { return true; }
+
+  nrow = static_cast<int32_t>( dims[0] );
+  ncol = static_cast<int32_t>( dims[1] );
+  return false;
+}
+
+
+// =======================================================================================
+/** @brief Write a Table.
+ *  @param[in] fspc file specification.
+ *  @param[in] dset dataset path.
+ *  @param[in] tab  source Table.
+ *  @param[in] opt  creation options.
+ *  @return true if an error occured.
+ */
+// ---------------------------------------------------------------------------------------
+bool write( const std::string fspc, const std::string dset, const Table& tab,
+            const Options& opt ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t ns = tab.size(0);
+  const int32_t nv = tab.size(1);
+
+  Handle fid( open_file( fspc, true ), H5Fclose );
+  if ( fid.bad() ) { return true; }
+
+  Handle did( create_dataset( fid, dset, ns, nv, opt ), H5Dclose );
+  if ( did.bad() ) { return true; }
+
+  return put_rows( did, 0, tab.col(0), static_cast<size_t>( ns ), static_cast<size_t>( nv ),
+                   1, static_cast<size_t>( ns ) );
+}
+
+
+// =======================================================================================
+/** @brief Append a Table.
+ *  @param[in] fspc file specification.
+ *  @param[in] dset dataset path.
+ *  @param[in] tab  source Table.
+ *  @param[in] opt  creation options, used if the dataset does not exist yet.
+ *  @return true if an error occured.
+ *
+ *  Add the samples of tab to the end of the dataset, creating it if needed.
+ */
+// ---------------------------------------------------------------------------------------
+bool append( const std::string fspc, const std::string dset, const Table& tab,
+             const Options& opt ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t ns = tab.size(0);
+  const int32_t nv = tab.size(1);
+
+  hsize_t dims[2] = { 0, 0 };
+  {
+    Handle fid( open_file( fspc, true ), H5Fclose );
+    if ( fid.bad() ) { return true; }
+    if ( exists( fid, dset ) ) {
+      Handle did( open_dataset( fid, dset, dims ), H5Dclose );
+      if ( did.bad() ) { return true; }
+      if ( static_cast<hsize_t>( nv ) != dims[1] ) {
+        logger->error( "H5IO: cannot append %d columns to %s with %lu.",
+                       nv, dset.c_str(), static_cast<unsigned long>( dims[1] ) );
+        return true;
+      }
+      hsize_t grow[2] = { dims[0] + static_cast<hsize_t>( ns ), dims[1] };
+      if ( 0 > H5Dset_extent( did, grow ) ) {
+        logger->error( "H5IO: cannot extend %s.", dset.c_str() );
+        return true;
+      }
+      return put_rows( did, static_cast<size_t>( dims[0] ), tab.col(0),
+                       static_cast<size_t>( ns ), static_cast<size_t>( nv ),
+                       1, static_cast<size_t>( ns ) );
+    }
+  }
+  return write( fspc, dset, tab, opt );
+}
+
+
+// =======================================================================================
+/** @brief Read a Table.
+ *  @param[out] tab   destination Table, resized to count samples.
+ *  @param[in]  fspc  file specification.
+ *  @param[in]  dset  dataset path.
+ *  @param[in]  first first row to read.       (default: 0)
+ *  @param[in]  count number of rows to read.  (default: -1 the rest of the dataset)
+ *  @return true if an error occured.
+ */
+// ---------------------------------------------------------------------------------------
+bool read( Table& tab, const std::string fspc, const std::string dset,
+           const int32_t first, const int32_t count ) {
+  // -------------------------------------------------------------------------------------
+  Handle fid( open_file( fspc, false ), H5Fclose );
+  if ( fid.bad() ) { return true; }
+
+  hsize_t dims[2];
+  Handle did( open_dataset( fid, dset, dims ), H5Dclose );
+  if ( did.bad() ) { return true; }
+
+  int32_t n = count;
+  if ( range( n, first, dims[0] ) ) { return true; }
+
+  const int32_t nv = static_cast<int32_t>( dims[1] );
+  tab.resize( n, nv );
+
+  return get_rows( did, static_cast<size_t>( first ), tab.col(0),
+                   static_cast<size_t>( n ), static_cast<size_t>( nv ),
+                   1, static_cast<size_t>( n ) );
+}
+
+
+// =======================================================================================
+/** @brief Write a Matrix.
+ *  @param[in] fspc file specification.
+ *  @param[in] dset dataset path.
+ *  @param[in] mat  source Matrix.
+ *  @param[in] opt  creation options.
+ *  @return true if an error occured.
+ */
+// ---------------------------------------------------------------------------------------
+bool write( const std::string fspc, const std::string dset, Matrix& mat,
+            const Options& opt ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t nr = mat.size(0);
+  const int32_t nc = mat.size(1);
+
+  Handle fid( open_file( fspc, true ), H5Fclose );
+  if ( fid.bad() ) { return true; }
+
+  Handle did( create_dataset( fid, dset, nr, nc, opt ), H5Dclose );
+  if ( did.bad() ) { return true; }
+
+  return put_rows( did, 0, mat.A(), static_cast<size_t>( nr ), static_cast<size_t>( nc ),
+                   1, static_cast<size_t>( nr ) );
+}
+
+
+// =======================================================================================
+/** @brief Read a Matrix.
+ *  @param[out] mat   destination Matrix, resized to count rows.
+ *  @param[in]  fspc  file specification.
+ *  @param[in]  dset  dataset path.
+ *  @param[in]  first first row to read.       (default: 0)
+ *  @param[in]  count number of rows to read.  (default: -1 the rest of the dataset)
+ *  @return true if an error occured.
+ */
+// ---------------------------------------------------------------------------------------
+bool read( Matrix& mat, const std::string fspc, const std::string dset,
+           const int32_t first, const int32_t count ) {
+  // -------------------------------------------------------------------------------------
+  Handle fid( open_file( fspc, false ), H5Fclose );
+  if ( fid.bad() ) { return true; }
+
+  hsize_t dims[2];
+  Handle did( open_dataset( fid, dset, dims ), H5Dclose );
+  if ( did.bad() ) { return true; }
+
+  int32_t n = count;
+  if ( range( n, first, dims[0] ) ) { return true; }
+
+  const int32_t nc = static_cast<int32_t>( dims[1] );
+  mat.resize( n, nc );
+
+  return get_rows( did, static_cast<size_t>( first ), mat.A(),
+                   static_cast<size_t>( n ), static_cast<size_t>( nc ),
+                   1, static_cast<size_t>( n ) );
+}
+
+
+// =======================================================================================
+/** @brief Write an Exemplar.
+ *  @param[in] fspc  file specification.
+ *  @param[in] group group path for the input and output datasets and the Meta.
+ *  @param[in] ex    source Exemplar.
+ *  @param[in] opt   creation options.
+ *  @return true if an error occured.
+ */
+// ---------------------------------------------------------------------------------------
+bool write( const std::string fspc, const std::string group, Exemplar& ex,
+            const Options& opt ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t ns = ex.nSample();
+  const int32_t ni = ex.nInput();
+  const int32_t no = ex.hasOutput() ? ex.nOutput() : 0;
+
+  Handle fid( open_file( fspc, true ), H5Fclose );
+  if ( fid.bad() ) { return true; }
+
+  {
+    Handle did( create_dataset( fid, join( group, "input" ), ns, ni, opt ), H5Dclose );
+    if ( did.bad() ) { return true; }
+    if ( put_rows( did, 0, ex.getIn()->get(), static_cast<size_t>( ns ),
+                   static_cast<size_t>( ni ), static_cast<size_t>( ni ), 1 ) ) {
+      return true;
+    }
+  }
+
+  const std::string opath = join( group, "output" );
+  if ( 0 < no ) {
+    Handle did( create_dataset( fid, opath, ns, no, opt ), H5Dclose );
+    if ( did.bad() ) { return true; }
+    if ( put_rows( did, 0, ex.getOut()->get(), static_cast<size_t>( ns ),
+                   static_cast<size_t>( no ), static_cast<size_t>( no ), 1 ) ) {
+      return true;
+    }
+  } else if ( exists( fid, opath ) ) {
+    H5Ldelete( fid, opath.c_str(), H5P_DEFAULT );
+  }
+
+  const std::string gpath = group.empty() ? std::string( "/" ) : group;
+  Handle gid( H5Oopen( fid, gpath.c_str(), H5P_DEFAULT ), H5Oclose );
+  if ( gid.bad() ) { return true; }
+  put_attr( gid, "n_sample", ns );
+  put_attr( gid, "n_input",  ni );
+  put_attr( gid, "n_output", no );
+
+  return false;
+}
+
+
+// =======================================================================================
+/** @brief Read Exemplar Meta.
+ *  @param[out] meta  sizes stored with the Exemplar.
+ *  @param[in]  fspc  file specification.
+ *  @param[in]  group group path written by write.
+ *  @return true if an error occured.
+ */
+// ---------------------------------------------------------------------------------------
+bool read_meta( Exemplar::Meta& meta, const std::string fspc, const std::string group ) {
+  // -------------------------------------------------------------------------------------
+  Handle fid( open_file( fspc, false ), H5Fclose );
+  if ( fid.bad() ) { return true; }
+
+  const std::string gpath = group.empty() ? std::string( "/" ) : group;
+  hid_t g = -1;
+  H5E_BEGIN_TRY {
+    g = H5Oopen( fid, gpath.c_str(), H5P_DEFAULT );
+  } H5E_END_TRY;
+  Handle gid( g, H5Oclose );
+  if ( gid.bad() ) {
+    logger->error( "H5IO: no group %s in %s.", gpath.c_str(), fspc.c_str() );
+    return true;
+  }
+
+  return ( get_attr( gid, "n_sample", meta.n_sample ) ||
+           get_attr( gid, "n_input",  meta.n_input  ) ||
+           get_attr( gid, "n_output", meta.n_output ) );
+}
+
+
+// =======================================================================================
+/** @brief Read an Exemplar.
+ *  @param[out] ex    destination Exemplar, resized to count samples.
+ *  @param[in]  fspc  file specification.
+ *  @param[in]  group group path written by write.
+ *  @param[in]  first first sample to read.       (default: 0)
+ *  @param[in]  count number of samples to read.  (default: -1 the rest of the data)
+ *  @return true if an error occured.
+ */
+// ---------------------------------------------------------------------------------------
+bool read( Exemplar& ex, const std::string fspc, const std::string group,
+           const int32_t first, const int32_t count ) {
+  // -------------------------------------------------------------------------------------
+  Exemplar::Meta meta;
+  if ( read_meta( meta, fspc, group ) ) { return true; }
+
+  Handle fid( open_file( fspc, false ), H5Fclose );
+  if ( fid.bad() ) { return true; }
+
+  int32_t n = count;
+  if ( range( n, first, static_cast<hsize_t>( meta.n_sample ) ) ) { return true; }
+
+  ex.resize( n, meta.n_input, meta.n_output );
+
+  {
+    hsize_t dims[2];
+    Handle did( open_dataset( fid, join( group, "input" ), dims ), H5Dclose );
+    if ( did.bad() ) { return true; }
+    if ( get_rows( did, static_cast<size_t>( first ), ex.getIn()->get(),
+                   static_cast<size_t>( n ), static_cast<size_t>( meta.n_input ),
+                   static_cast<size_t>( meta.n_input ), 1 ) ) {
+      return true;
+    }
+  }
+
+  if ( 0 < meta.n_output ) {
+    hsize_t dims[2];
+    Handle did( open_dataset( fid, join( group, "output" ), dims ), H5Dclose );
+    if ( did.bad() ) { return true; }
+    if ( get_rows( did, static_cast<size_t>( first ), ex.getOut()->get(),
+                   static_cast<size_t>( n ), static_cast<size_t>( meta.n_output ),
+                   static_cast<size_t>( meta.n_output ), 1 ) ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+}; // end namespace H5IO
+
+
+// =======================================================================================
+// **                                      H 5 I O                                      **
+// ======================================================================== END FILE =====
@@ -35,6 +35,10 @@
 
 #include <LinAlg.hh>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 TLOGGER_INSTANCE( logger );
 
 // =======================================================================================
@@ -513,6 +517,183 @@ void covariance( Matrix& cov, const Table& tab ) {
 }
 
 
+// =======================================================================================
+/** @brief Merge Partial Moments.
+ *  @param[in,out] na  number of samples in the accumulated set.
+ *  @param[in,out] mua mean of the accumulated set.
+ *  @param[in,out] M2a upper triangle of the co-moment matrix of the accumulated set.
+ *  @param[in]     nb  number of samples in the set being merged.
+ *  @param[in]     mub mean of the set being merged.
+ *  @param[in]     M2b upper triangle of the co-moment matrix of the set being merged.
+ *  @param[in]     nv  number of variables.
+ *
+ *  Chan, Golub & LeVeque pairwise update. The co-moment matrices are column-major
+ *  with a leading dimension of nv.
+ */
+// ---------------------------------------------------------------------------------------
+static void mergeComoment( real8_t& na, real8_t* mua, real8_t* M2a,
+                           const real8_t nb, const real8_t* mub, const real8_t* M2b,
+                           const int32_t nv ) {
+  // -------------------------------------------------------------------------------------
+  if ( D_ZERO < nb ) {
+    if ( D_ZERO < na ) {
+      const real8_t n     = na + nb;
+      const real8_t scale = ( na * nb ) / n;
+      const real8_t wb    = nb / n;
+      real8_t delta[nv];
+      for ( int32_t i=0; i<nv; i++ ) {
+        delta[i] = mub[i] - mua[i];
+      }
+      for ( int32_t j=0; j<nv; j++ ) {
+        const real8_t dj = scale * delta[j];
+        real8_t* ca = M2a + j*nv;
+        const real8_t* cb = M2b + j*nv;
+        for ( int32_t i=0; i<=j; i++ ) {
+          ca[i] += ( cb[i] + delta[i]*dj );
+        }
+      }
+      for ( int32_t i=0; i<nv; i++ ) {
+        mua[i] += ( wb * delta[i] );
+      }
+      na = n;
+    } else {
+      for ( int32_t i=0; i<nv; i++ ) {
+        mua[i] = mub[i];
+      }
+      for ( int32_t i=0; i<nv*nv; i++ ) {
+        M2a[i] = M2b[i];
+      }
+      na = nb;
+    }
+  }
+}
+
+
+// =======================================================================================
+/** @brief Streaming Covariance.
+ *  @param[out] cov   reference to the covariance Matrix.
+ *  @param[out] mu    pointer to an array to receive the column means of the table.
+ *  @param[in]  tab   reference to the Table containng the data.
+ *  @param[in]  block number of samples per block (default: 256).
+ *
+ *  Compute the column means and the covariance in a single pass over the column
+ *  buffers of the Table. The samples are processed in blocks: each block is centered
+ *  on its own mean and reduced with a rank-k update (DSYRK), the partial co-moments
+ *  are then combined with the pairwise update of Chan et. al. The blocks are divided
+ *  among the OpenMP threads in contiguous ranges, and the per-thread results are
+ *  merged in thread order, so that a given thread count always produces the same
+ *  result.
+ */
+// ---------------------------------------------------------------------------------------
+void streamCovariance( Matrix& cov, real8_t* mu, const Table& tab, const int32_t block ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t ns   = size( tab, 0 );
+  const int32_t nv   = size( tab, 1 );
+  const int32_t bs   = ( 0 < block ) ? ( block ) : ( 256 );
+  const int32_t nblk = ( ns + bs - 1 ) / bs;
+  const int32_t nv2  = nv*nv;
+
+  cov.resize( nv );
+  cov.set( D_ZERO );
+  zero( mu, nv );
+
+  if ( 2 > ns ) {
+    logger->error( "streamCovariance: need at least two samples, got %d", ns );
+    return;
+  }
+
+#ifdef _OPENMP
+  const int32_t nthr = Min( omp_get_max_threads(), nblk );
+#else
+  const int32_t nthr = 1;
+#endif
+
+  real8_t* part_n  = new real8_t[ nthr ];
+  real8_t* part_mu = new real8_t[ nthr*nv ];
+  real8_t* part_M2 = new real8_t[ nthr*nv2 ];
+
+  zero( part_n,  nthr );
+  zero( part_mu, nthr*nv );
+  zero( part_M2, nthr*nv2 );
+
+#pragma omp parallel num_threads( nthr )
+  {
+#ifdef _OPENMP
+    const int32_t tid = omp_get_thread_num();
+#else
+    const int32_t tid = 0;
+#endif
+    const int32_t b0 = ( tid       * nblk ) / nthr;
+    const int32_t b1 = ( (tid + 1) * nblk ) / nthr;
+
+    real8_t& tn   = part_n[ tid ];
+    real8_t* tmu  = part_mu + tid*nv;
+    real8_t* tM2  = part_M2 + tid*nv2;
+
+    real8_t* X    = new real8_t[ bs*nv ];
+    real8_t* bmu  = new real8_t[ nv ];
+    real8_t* bM2  = new real8_t[ nv2 ];
+
+    const real8_t one  = D_ONE;
+    const real8_t zip  = D_ZERO;
+
+    for ( int32_t b=b0; b<b1; b++ ) {
+      const int32_t r0 = b * bs;
+      const int32_t m  = Min( bs, ns - r0 );
+      const real8_t fm = static_cast<real8_t>( m );
+
+      // ----- center this block on its own mean -----------------------------------------
+      for ( int32_t v=0; v<nv; v++ ) {
+        const real8_t* src = tab.col( v ) + r0;
+        real8_t*       dst = X + v*m;
+        real8_t s = D_ZERO;
+        for ( int32_t k=0; k<m; k++ ) {
+          s += src[k];
+        }
+        s /= fm;
+        for ( int32_t k=0; k<m; k++ ) {
+          dst[k] = src[k] - s;
+        }
+        bmu[v] = s;
+      }
+
+      // ----- co-moment of the block: bM2 = X**T * X ------------------------------------
+      int32_t ldx = m;
+      int32_t k   = m;
+      int32_t n   = nv;
+      dsyrk_( "UPPER", "TRANS", &n, &k, &one, X, &ldx, &zip, bM2, &n );
+
+      mergeComoment( tn, tmu, tM2, fm, bmu, bM2, nv );
+    }
+
+    delete[] bM2;
+    delete[] bmu;
+    delete[] X;
+  }
+
+  // ----- merge the thread partials in a fixed order --------------------------------------
+  real8_t  tot_n  = D_ZERO;
+  real8_t* tot_M2 = cov.A();
+  for ( int32_t t=0; t<nthr; t++ ) {
+    mergeComoment( tot_n, mu, tot_M2, part_n[t], part_mu + t*nv, part_M2 + t*nv2, nv );
+  }
+
+  // ----- scale and mirror the upper triangle ---------------------------------------------
+  const real8_t fnm1 = static_cast<real8_t>( ns - 1 );
+  for ( int32_t j=0; j<nv; j++ ) {
+    for ( int32_t i=0; i<=j; i++ ) {
+      const real8_t c = cov(i,j) / fnm1;
+      cov(i,j) = c;
+      cov(j,i) = c;
+    }
+  }
+
+  delete[] part_M2;
+  delete[] part_mu;
+  delete[] part_n;
+}
+
+
 // =======================================================================================
 /** @brief Correlation.
  *  @param[out] cor reference to the correlation Matrix.
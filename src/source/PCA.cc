@@ -36,6 +36,7 @@
 
 #include <PCA.hh>
 #include <EigenSystem.hh>
+#include <Dice.hh>
 
 
 TLOGGER_REFERENCE( PCA, logger );
@@ -112,6 +113,7 @@ int PCA::fromSamples( Table& table ) {
   dgesdd_( JOBZ, &ns, &nv, data, &ns, S, U, &ONE, VT, &nv, WRKP, &LWORK, IWORK, &INFO );
   if ( 0 != INFO ) {
     logger->error( "unable to query lwork" );
+    delete[] IWORK;  delete[] VT;  delete[] S;  delete[] data;
     return 1;
   }
 
@@ -122,8 +124,12 @@ int PCA::fromSamples( Table& table ) {
 
   // ----- call SVD for eigen systems -----------------
   dgesdd_( JOBZ, &ns, &nv, data, &ns, S, U, &ONE, VT, &nv, WORK, &LWORK, IWORK, &INFO );
+  delete[] WORK;
+  delete[] IWORK;
+  delete[] data;
   if ( 0 != INFO ) {
     logger->error( "SVD failed to converge" );
+    delete[] VT;  delete[] S;
     return 2;
   }
 
@@ -137,6 +143,9 @@ int PCA::fromSamples( Table& table ) {
     variance(i) = S[i]*S[i] / fnsm1;
   }
 
+  delete[] VT;
+  delete[] S;
+
     // **** TODO: look at your Fortran code on Europa. You can compute the covariance from the SVD products.
   ::covariance( covariance, table, mu );
 
@@ -144,6 +153,198 @@ int PCA::fromSamples( Table& table ) {
 }
 
 
+// =======================================================================================
+/** @brief Orthonormalize.
+ *  @param[in,out] A column-major m x n matrix (lda=m), replaced by an orthonormal
+ *                   basis for its column space.
+ *  @param[in]     m number of rows.
+ *  @param[in]     n number of columns (n <= m).
+ *  @return 0==success. non-zero==error.
+ */
+// ---------------------------------------------------------------------------------------
+int PCA::orthonormalize( real8_t* A, const int32_t m, const int32_t n ) {
+  // -------------------------------------------------------------------------------------
+  int32_t  M       = m;
+  int32_t  N       = n;
+  int32_t  INFO    = 0;
+  int32_t  LWORK   = -1;
+  real8_t  WRKP[2] = {0.0, 0.0};
+  real8_t* TAU     = new real8_t[n];
+
+  // ----- query work space requirments ---------------
+  dgeqrf_( &M, &N, A, &M, TAU, WRKP, &LWORK, &INFO );
+  int32_t LWQR = static_cast<int32_t>(WRKP[0]);
+  LWORK = -1;
+  dorgqr_( &M, &N, &N, A, &M, TAU, WRKP, &LWORK, &INFO );
+  LWORK = Max( LWQR, static_cast<int32_t>(WRKP[0]) );
+
+  real8_t* WORK = new real8_t[LWORK];
+
+  dgeqrf_( &M, &N, A, &M, TAU, WORK, &LWORK, &INFO );
+  if ( 0 == INFO ) {
+    dorgqr_( &M, &N, &N, A, &M, TAU, WORK, &LWORK, &INFO );
+  }
+
+  delete[] WORK;
+  delete[] TAU;
+
+  return INFO;
+}
+
+
+// =======================================================================================
+/** @brief Compile Truncated.
+ *  @param[in] table      reference to table of samples.
+ *  @param[in] k          number of principal components to keep.
+ *  @param[in] oversample extra random directions used by the range finder (default: 10).
+ *  @param[in] power      number of power iterations (default: 2).
+ *  @return 0==success. non-zero==error.
+ *
+ *  Randomized SVD (Halko, Martinsson & Tropp, 2011). A Gaussian test matrix of
+ *  k+oversample columns is used to sample the range of the centered data, refined by a
+ *  few power iterations, and the SVD of the small projected matrix (DGESDD) yields the
+ *  top k principal axes. The rotation is k x nvar, so transform reduces the dimension.
+ *  The full covariance is not formed, and is left empty.
+ */
+// ---------------------------------------------------------------------------------------
+int PCA::fromSamples( Table& table, const int32_t k,
+                      const int32_t oversample, const int32_t power ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t ns = size( table, 0 );
+  const int32_t nv = size( table, 1 );
+
+  if ( ( 1 > k ) || ( nv < k ) ) {
+    logger->error( "k=%d must be between 1 and the number of variables %d", k, nv );
+    return 3;
+  }
+
+  int32_t l = k + ( ( 0 > oversample ) ? 0 : oversample );
+  if ( l > nv ) { l = nv; }
+  if ( l > ns ) { l = ns; }
+
+  if ( l < k ) {
+    logger->error( "%d samples can not resolve %d components", ns, k );
+    return 3;
+  }
+
+  // ----- set number of variables -------------------------------------------------------
+  num_var = nv;
+  if ( (real8_t*)0 == rwork ) {
+    rwork = new real8_t[num_var];
+  }
+
+  // ----- build mean vector -------------------------------------------------------------
+  real8_t tempv[nv];
+  table.mean( tempv, nv, 0 );
+  mu.resize(nv);
+  mu.load(tempv);
+
+  // ----- centered data (column-major, lda=ns) ------------------------------------------
+  real8_t* X = new real8_t[ (size_t)ns * (size_t)nv ];
+
+#pragma omp parallel for schedule(static)
+  for ( int32_t c=0; c<nv; c++ ) {
+    const real8_t  mean = tempv[c];
+    const real8_t* src  = table.col(c);
+    real8_t*       dst  = X + (size_t)c * (size_t)ns;
+    for ( int32_t r=0; r<ns; r++ ) {
+      dst[r] = src[r] - mean;
+    }
+  }
+
+  // ----- range finder: Y = X * Omega ---------------------------------------------------
+  Dice*    dd    = Dice::getInstance();
+  real8_t* Omega = new real8_t[ nv*l ];
+  for ( int32_t i=0; i<nv*l; i++ ) {
+    Omega[i] = dd->normal();
+  }
+
+  const real8_t one  = D_ONE;
+  const real8_t zip  = D_ZERO;
+  int32_t       NS   = ns;
+  int32_t       NV   = nv;
+  int32_t       L    = l;
+  int           rv   = 0;
+
+  real8_t* Y = new real8_t[ (size_t)ns * (size_t)l ];
+
+  dgemm_( "NO", "NO", &NS, &L, &NV, &one, X, &NS, Omega, &NV, &zip, Y, &NS );
+
+  if ( 0 != orthonormalize( Y, ns, l ) ) { rv = 4; }
+
+  // ----- power iterations: Y = orth( X * orth( X**T * Y ) ) ----------------------------
+  for ( int32_t q=0; ( q<power ) && ( 0 == rv ); q++ ) {
+    dgemm_( "TRANS", "NO", &NV, &L, &NS, &one, X, &NS, Y, &NS, &zip, Omega, &NV );
+    if ( 0 != orthonormalize( Omega, nv, l ) ) { rv = 4; break; }
+    dgemm_( "NO", "NO", &NS, &L, &NV, &one, X, &NS, Omega, &NV, &zip, Y, &NS );
+    if ( 0 != orthonormalize( Y, ns, l ) ) { rv = 4; break; }
+  }
+
+  if ( 0 != rv ) {
+    logger->error( "QR factorization failed" );
+    delete[] Y;  delete[] Omega;  delete[] X;
+    return rv;
+  }
+
+  // ----- project: B = Y**T * X  (l x nv) -----------------------------------------------
+  real8_t* B = new real8_t[ l*nv ];
+  dgemm_( "TRANS", "NO", &L, &NV, &NS, &one, Y, &NS, X, &NS, &zip, B, &L );
+
+  delete[] Y;
+  delete[] Omega;
+  delete[] X;
+
+  // ----- singular value decomposition of the small matrix ------------------------------
+  const char* JOBZ = "S";
+  real8_t* S       = new real8_t[l];
+  real8_t* U       = new real8_t[l*l];
+  real8_t* VT      = new real8_t[l*nv];
+  real8_t  WRKP[2] = {0.0, 0.0};
+  int32_t  LWORK   = -1;
+  int32_t* IWORK   = new int32_t[8*l];
+  int32_t  INFO    = 0;
+
+  dgesdd_( JOBZ, &L, &NV, B, &L, S, U, &L, VT, &L, WRKP, &LWORK, IWORK, &INFO );
+  if ( 0 == INFO ) {
+    LWORK = static_cast<int32_t>(WRKP[0]);
+    real8_t* WORK = new real8_t[LWORK];
+    dgesdd_( JOBZ, &L, &NV, B, &L, S, U, &L, VT, &L, WORK, &LWORK, IWORK, &INFO );
+    delete[] WORK;
+  }
+
+  delete[] IWORK;
+  delete[] U;
+  delete[] B;
+
+  if ( 0 != INFO ) {
+    logger->error( "SVD failed to converge" );
+    delete[] VT;  delete[] S;
+    return 2;
+  }
+
+  // ----- keep the top k axes -----------------------------------------------------------
+  rotation.resize( k, nv );
+  for ( int32_t j=0; j<nv; j++ ) {
+    for ( int32_t i=0; i<k; i++ ) {
+      rotation(i,j) = VT[ i + j*l ];
+    }
+  }
+
+  const real8_t fnsm1 = static_cast<real8_t>(ns-1);
+  variance.resize( k );
+  for ( int32_t i=0; i<k; i++ ) {
+    variance(i) = S[i]*S[i] / fnsm1;
+  }
+
+  covariance.resize( 0 );
+
+  delete[] VT;
+  delete[] S;
+
+  return 0;
+}
+
+
 // =======================================================================================
 /** @brief Compile.
  *  @param[in] cov  reference to an inpt covariance.
@@ -220,14 +421,18 @@ int PCA::transform( Vector& out, Vector& in ) {
 
 // =======================================================================================
 /** @brief Transform.
- *  @param[out] out  reference to an output Table.
- *  @param[in]  in   reference to an input Table.
+ *  @param[out] out   reference to an output Table.
+ *  @param[in]  in    reference to an input Table.
+ *  @param[in]  block number of samples per block (default: 1024).
  *  @return 0==success. non-zer==error.
  *
- *  Mean shift the input Vector and apply the rotation transform.
+ *  Mean shift the input Vector and apply the rotation transform. The samples are
+ *  processed in blocks of rows: each block is centered into a work buffer and rotated
+ *  with a single DGEMM, written directly into the output columns. Blocks are divided
+ *  among the OpenMP threads.
  */
 // ---------------------------------------------------------------------------------------
-int PCA::transform( Table& out, Table& in ) {
+int PCA::transform( Table& out, Table& in, const int32_t block ) {
   // -------------------------------------------------------------------------------------
   const int32_t nSamp = size( in, 0 );
   const int32_t nOut  = size( rotation, 0 );
@@ -237,20 +442,43 @@ int PCA::transform( Table& out, Table& in ) {
   }
   out.resize( nSamp, nOut );
 
-  for ( int32_t k=0; k<nSamp; k++ ) {
-    for ( int32_t j=0; j<nIn; j++ ) {
-      rwork[j] = in.get(k,j) - mu.get(j);
-    }
+  const int32_t bs   = ( 0 < block ) ? ( block ) : ( 1024 );
+  const int32_t nblk = ( nSamp + bs - 1 ) / bs;
+
+  real8_t* R   = rotation.A();
+  int32_t  ldr = nOut;
+  int32_t  ldo = nSamp;
+  real8_t* O   = out.col(0);
+
+#pragma omp parallel
+  {
+    real8_t* W = new real8_t[ bs*nIn ];
+    const real8_t one = D_ONE;
+    const real8_t zip = D_ZERO;
+
+#pragma omp for schedule(static)
+    for ( int32_t b=0; b<nblk; b++ ) {
+      const int32_t r0 = b * bs;
+      int32_t       m  = Min( bs, nSamp - r0 );
+      int32_t       no = nOut;
+      int32_t       ni = nIn;
 
-    for ( int32_t i=0; i<nOut; i++ ) {
-      real8_t sum = D_ZERO;
       for ( int32_t j=0; j<nIn; j++ ) {
-        sum += ( rotation.get(i,j) * rwork[j] );
+        const real8_t  mean = mu.get(j);
+        const real8_t* src  = in.col(j) + r0;
+        real8_t*       dst  = W + j*m;
+        for ( int32_t k=0; k<m; k++ ) {
+          dst[k] = src[k] - mean;
+        }
       }
-      out(k,i) = sum;
+
+      // ----- out(r0:r0+m, :) = W * rotation**T ---------------------------------------
+      dgemm_( "NO", "TRANS", &m, &no, &ni, &one, W, &m, R, &ldr, &zip, O + r0, &ldo );
     }
+
+    delete[] W;
   }
-  
+
   return 0;
 }
 
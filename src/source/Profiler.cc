@@ -0,0 +1,244 @@
+// ====================================================================== BEGIN FILE =====
+// **                                  P R O F I L E R                                  **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Scoped profiling zones.
+ *  @file   Profiler.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18.
+ *
+ *  Provides the methods for lightweight, thread aware, wall clock profiling.
+ */
+// =======================================================================================
+
+#include <Profiler.hh>
+#include <mutex>
+#include <atomic>
+#include <cstring>
+#include <cstdio>
+
+
+// =======================================================================================
+/** @brief Per thread zone table.
+ */
+// ---------------------------------------------------------------------------------------
+struct __ProfileTable {
+  int32_t        ordinal;                   ///< registration order of the thread
+  Profiler::stat zone[PROFILE_MAX_ZONES];   ///< statistics by zone id
+};
+
+
+static std::mutex            __pf_mtx;                         ///< guards registration
+static const char*           __pf_name[PROFILE_MAX_ZONES];     ///< zone names
+static std::atomic<int32_t>  __pf_nzone(0);                    ///< registered zones
+static __ProfileTable*       __pf_table[PROFILE_MAX_THREADS];  ///< thread tables
+static std::atomic<int32_t>  __pf_nthread(0);                  ///< registered threads
+static thread_local __ProfileTable* __pf_local = static_cast<__ProfileTable*>(0);
+
+
+// =======================================================================================
+/** @brief Clear one statistic.
+ */
+// ---------------------------------------------------------------------------------------
+static void __pf_clear( Profiler::stat& S ) {
+  // -------------------------------------------------------------------------------------
+  S.count    = 0;
+  S.total_ns = 0;
+  S.min_ns   = ~static_cast<u_int64_t>(0);
+  S.max_ns   = 0;
+}
+
+
+// =======================================================================================
+/** @brief Register a zone.
+ *  @param name zone name (must outlive the program, normally a literal).
+ *  @return zone id, or -1 if the table is full.
+ *
+ *  Names are compared by value, so one name used at several call sites shares a zone.
+ */
+// ---------------------------------------------------------------------------------------
+int32_t Profiler::zone( const char* name ) {
+  // -------------------------------------------------------------------------------------
+  std::lock_guard<std::mutex> lk( __pf_mtx );
+  const int32_t n = __pf_nzone.load();
+  for ( int32_t i=0; i<n; i++ ) {
+    if ( 0 == strcmp( __pf_name[i], name ) ) { return i; }
+  }
+  if ( PROFILE_MAX_ZONES <= n ) { return -1; }
+  __pf_name[n] = name;
+  __pf_nzone.store( n+1 );
+  return n;
+}
+
+
+// =======================================================================================
+/** @brief Record a duration.
+ *  @param id zone id.
+ *  @param ns duration in nanoseconds.
+ *
+ *  Accumulate into the calling thread's table. The table is created on first use.
+ */
+// ---------------------------------------------------------------------------------------
+void Profiler::record( int32_t id, u_int64_t ns ) {
+  // -------------------------------------------------------------------------------------
+  if ( 0 > id ) { return; }
+
+  if ( static_cast<__ProfileTable*>(0) == __pf_local ) {
+    std::lock_guard<std::mutex> lk( __pf_mtx );
+    const int32_t n = __pf_nthread.load();
+    if ( PROFILE_MAX_THREADS <= n ) { return; }
+    __ProfileTable* T = new __ProfileTable;
+    T->ordinal = n;
+    for ( int32_t i=0; i<PROFILE_MAX_ZONES; i++ ) { __pf_clear( T->zone[i] ); }
+    __pf_table[n] = T;
+    __pf_nthread.store( n+1 );
+    __pf_local = T;
+  }
+
+  stat& S = __pf_local->zone[id];
+  S.count    += 1;
+  S.total_ns += ns;
+  if ( ns < S.min_ns ) { S.min_ns = ns; }
+  if ( ns > S.max_ns ) { S.max_ns = ns; }
+}
+
+
+// =======================================================================================
+/** @brief Number of zones.
+ *  @return number of registered zone names.
+ */
+// ---------------------------------------------------------------------------------------
+int32_t Profiler::zones( void ) {
+  // -------------------------------------------------------------------------------------
+  return __pf_nzone.load();
+}
+
+
+// =======================================================================================
+/** @brief Zone name.
+ *  @param id zone id.
+ *  @return registered name (or null for an invalid id).
+ */
+// ---------------------------------------------------------------------------------------
+const char* Profiler::name( int32_t id ) {
+  // -------------------------------------------------------------------------------------
+  if ( ( 0 > id ) || ( id >= __pf_nzone.load() ) ) { return static_cast<const char*>(0); }
+  return __pf_name[id];
+}
+
+
+// =======================================================================================
+/** @brief Zone total.
+ *  @param id zone id.
+ *  @return statistics of the zone merged over all threads.
+ *
+ *  Read while the zone is not being recorded to get a consistent result.
+ */
+// ---------------------------------------------------------------------------------------
+Profiler::stat Profiler::total( int32_t id ) {
+  // -------------------------------------------------------------------------------------
+  stat S;
+  __pf_clear( S );
+  if ( ( 0 > id ) || ( id >= __pf_nzone.load() ) ) { return S; }
+
+  const int32_t nt = __pf_nthread.load();
+  for ( int32_t t=0; t<nt; t++ ) {
+    const stat& Z = __pf_table[t]->zone[id];
+    if ( 0 < Z.count ) {
+      S.count    += Z.count;
+      S.total_ns += Z.total_ns;
+      if ( Z.min_ns < S.min_ns ) { S.min_ns = Z.min_ns; }
+      if ( Z.max_ns > S.max_ns ) { S.max_ns = Z.max_ns; }
+    }
+  }
+  return S;
+}
+
+
+// =======================================================================================
+/** @brief Report.
+ *  @param os output stream.
+ *
+ *  For every zone write the merged statistics followed by one line per thread that
+ *  entered it. Times are in microseconds except the total, in milliseconds.
+ */
+// ---------------------------------------------------------------------------------------
+void Profiler::report( std::ostream& os ) {
+  // -------------------------------------------------------------------------------------
+  char buffer[256];
+  const int32_t nz = __pf_nzone.load();
+  const int32_t nt = __pf_nthread.load();
+
+  snprintf( buffer, 256, "%-32s %8s %12s %12s %12s %12s\n",
+            "zone / thread", "calls", "total(ms)", "min(us)", "mean(us)", "max(us)" );
+  os << buffer;
+
+  for ( int32_t z=0; z<nz; z++ ) {
+    const stat A = total( z );
+    if ( 0 == A.count ) { continue; }
+    snprintf( buffer, 256, "%-32.32s %8llu %12.3f %12.3f %12.3f %12.3f\n",
+              __pf_name[z], static_cast<unsigned long long>( A.count ),
+              1.0e-6 * static_cast<real8_t>( A.total_ns ),
+              1.0e-3 * static_cast<real8_t>( A.min_ns ),
+              1.0e-3 * static_cast<real8_t>( A.total_ns ) / static_cast<real8_t>( A.count ),
+              1.0e-3 * static_cast<real8_t>( A.max_ns ) );
+    os << buffer;
+
+    for ( int32_t t=0; t<nt; t++ ) {
+      const stat& S = __pf_table[t]->zone[z];
+      if ( 0 == S.count ) { continue; }
+      snprintf( buffer, 256, "    thread %-21d %8llu %12.3f %12.3f %12.3f %12.3f\n",
+                __pf_table[t]->ordinal, static_cast<unsigned long long>( S.count ),
+                1.0e-6 * static_cast<real8_t>( S.total_ns ),
+                1.0e-3 * static_cast<real8_t>( S.min_ns ),
+                1.0e-3 * static_cast<real8_t>( S.total_ns ) / static_cast<real8_t>( S.count ),
+                1.0e-3 * static_cast<real8_t>( S.max_ns ) );
+      os << buffer;
+    }
+  }
+}
+
+
+// =======================================================================================
+/** @brief Reset.
+ *
+ *  Clear every statistic. Zone and thread registrations are kept.
+ */
+// ---------------------------------------------------------------------------------------
+void Profiler::reset( void ) {
+  // -------------------------------------------------------------------------------------
+  std::lock_guard<std::mutex> lk( __pf_mtx );
+  const int32_t nt = __pf_nthread.load();
+  for ( int32_t t=0; t<nt; t++ ) {
+    for ( int32_t z=0; z<PROFILE_MAX_ZONES; z++ ) {
+      __pf_clear( __pf_table[t]->zone[z] );
+    }
+  }
+}
+
+
+// =======================================================================================
+// **                                  P R O F I L E R                                  **
+// ======================================================================== END FILE =====
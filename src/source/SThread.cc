@@ -70,7 +70,7 @@ SThread::~SThread( void ) {
 // ---------------------------------------------------------------------------------------
 int SThread::start( void ) {
   // -------------------------------------------------------------------------------------
-  if ( 0 != theThread ) {
+  if ( 0 == theThread ) {
     SThread::numberOfActiveThreads++;
     theThread = new std::thread( [&] { this->run(); } );
     if ( detach_after_start ) {
@@ -103,21 +103,20 @@ void SThread::join( void ) {
  * @param mutex reference to a locked mutex.
  * @param ms    milliseconds to wait for a signal.
  *
- * @return true if thread finishes, false if timeout is reached.
+ * @return true if the timeout was reached, false if the condition was signaled.
  */
 // ---------------------------------------------------------------------------------------
 bool SThreadCond::wait( SMutex& mutex, u_int32_t ms ){
   // -------------------------------------------------------------------------------------
-  std::unique_lock<std::mutex> lk(mutex.mtx);
+  std::unique_lock<std::mutex> lk( mutex.mtx, std::adopt_lock );
 
-  std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
-  now += std::chrono::milliseconds(ms);
+  std::chrono::steady_clock::time_point until =
+      std::chrono::steady_clock::now() + std::chrono::milliseconds(ms);
 
-  if(cond.wait_until(lk, now ) ==  std::cv_status::timeout) {
-      return true;
-  }
+  const bool timeout = ( std::cv_status::timeout == cond.wait_until( lk, until ) );
 
-  return false;
+  lk.release();
+  return timeout;
 }
 
 
@@ -38,6 +38,13 @@
 #include <LinAlg.hh>
 #include <array_print.hh>
 #include <FileTool.hh>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 TLOGGER_REFERENCE( Statistics, logger );
@@ -342,6 +349,892 @@ bool Statistics::single::extra( const real8_t* data, const int32_t num_samples )
 
 
 
+// =======================================================================================
+/** @brief Constructor.
+ */
+// ---------------------------------------------------------------------------------------
+Statistics::moments::moments( void ) :
+    n_samp(0),      m_mean(D_ZERO), m_M2(D_ZERO),  m_M3(D_ZERO),  m_M4(D_ZERO),
+    m_minv(D_ZERO), m_maxv(D_ZERO), m_minidx(0),   m_maxidx(0) {
+  // -------------------------------------------------------------------------------------
+}
+
+
+// =======================================================================================
+/** @brief Destructor.
+ */
+// ---------------------------------------------------------------------------------------
+Statistics::moments::~moments( void ) {
+  // -------------------------------------------------------------------------------------
+}
+
+
+// =======================================================================================
+/** @brief Reset.
+ *
+ *  Clear the accumulator and start over.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::moments::reset( void ) {
+  // -------------------------------------------------------------------------------------
+  n_samp   = 0;
+  m_mean   = D_ZERO;
+  m_M2     = D_ZERO;
+  m_M3     = D_ZERO;
+  m_M4     = D_ZERO;
+  m_minv   = D_ZERO;
+  m_maxv   = D_ZERO;
+  m_minidx = 0;
+  m_maxidx = 0;
+}
+
+
+// =======================================================================================
+/** @brief Variance.
+ *  @return sample variance (n-1), the same as Statistics::single.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t Statistics::moments::var( void ) const {
+  // -------------------------------------------------------------------------------------
+  if ( 2 > n_samp ) {
+    return D_ZERO;
+  }
+  return m_M2 / (real8_t)( n_samp - 1 );
+}
+
+
+// =======================================================================================
+/** @brief Standard Deviation.
+ *  @return sample standard deviation.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t Statistics::moments::sigma( void ) const {
+  // -------------------------------------------------------------------------------------
+  return sqrt( var() );
+}
+
+
+// =======================================================================================
+/** @brief Skew.
+ *  @return sample skew, normalized the same as Statistics::single::extra.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t Statistics::moments::skew( void ) const {
+  // -------------------------------------------------------------------------------------
+  const real8_t s = sigma();
+  if ( isZero( s ) ) {
+    return D_ZERO;
+  }
+  return m_M3 / ( (real8_t)n_samp * s*s*s );
+}
+
+
+// =======================================================================================
+/** @brief Kurtosis.
+ *  @return sample excess kurtosis, normalized the same as Statistics::single::extra.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t Statistics::moments::kurt( void ) const {
+  // -------------------------------------------------------------------------------------
+  const real8_t v = var();
+  if ( isZero( v ) ) {
+    return D_ZERO;
+  }
+  return m_M4 / ( (real8_t)n_samp * v*v ) - 3.0e0;
+}
+
+
+// =======================================================================================
+/** @brief Report
+ *  @param[in] os   reference to an output stream.
+ *  @param[in] sfmt edit sescriptor for fields.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::moments::report( std::ostream& os, const std::string sfmt ) {
+  // -------------------------------------------------------------------------------------
+  const char* fmt = sfmt.c_str();
+  os << "Num:      " << c_fmt( "%ld", count()  ) << "\n"
+     << "MinValue: " << c_fmt( fmt,   minv()   ) << "\n"
+     << "MaxValue: " << c_fmt( fmt,   maxv()   ) << "\n"
+     << "MinIndex: " << c_fmt( "%ld", minidx() ) << "\n"
+     << "MaxIndex: " << c_fmt( "%ld", maxidx() ) << "\n"
+     << "Mean:     " << c_fmt( fmt,   mean()   ) << "\n"
+     << "Var:      " << c_fmt( fmt,   var()    ) << "\n"
+     << "Std Dev:  " << c_fmt( fmt,   sigma()  ) << "\n"
+     << "Skew:     " << c_fmt( fmt,   skew()   ) << "\n"
+     << "Kurt:     " << c_fmt( fmt,   kurt()   ) << "\n"
+     << "\n";
+}
+
+
+// =======================================================================================
+/** @brief Merge.
+ *  @param[in] that reference to another accumulator.
+ *
+ *  Combine the moments of another accumulator into this one (Chan et. al. and Pebay).
+ *  The samples in that are treated as following the samples in this, so its min/max
+ *  indices are offset by the count of this accumulator. Merging the partial results
+ *  of consecutive ranges, in order, gives the same indices as a serial pass.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::moments::merge( const moments& that ) {
+  // -------------------------------------------------------------------------------------
+  if ( 0 == that.n_samp ) {
+    return;
+  }
+
+  if ( 0 == n_samp ) {
+    n_samp   = that.n_samp;
+    m_mean   = that.m_mean;
+    m_M2     = that.m_M2;
+    m_M3     = that.m_M3;
+    m_M4     = that.m_M4;
+    m_minv   = that.m_minv;
+    m_maxv   = that.m_maxv;
+    m_minidx = that.m_minidx;
+    m_maxidx = that.m_maxidx;
+    return;
+  }
+
+  if ( that.m_minv < m_minv ) { m_minv = that.m_minv;  m_minidx = that.m_minidx + n_samp; }
+  if ( that.m_maxv > m_maxv ) { m_maxv = that.m_maxv;  m_maxidx = that.m_maxidx + n_samp; }
+
+  const real8_t na  = (real8_t) n_samp;
+  const real8_t nb  = (real8_t) that.n_samp;
+  const real8_t n   = na + nb;
+  const real8_t d   = that.m_mean - m_mean;
+  const real8_t d2  = d*d;
+  const real8_t nab = na*nb;
+
+  const real8_t M2 = m_M2 + that.m_M2 + d2*nab/n;
+
+  const real8_t M3 = m_M3 + that.m_M3
+      + d*d2*nab*(na - nb)/(n*n)
+      + 3.0*d*(na*that.m_M2 - nb*m_M2)/n;
+
+  const real8_t M4 = m_M4 + that.m_M4
+      + d2*d2*nab*(na*na - nab + nb*nb)/(n*n*n)
+      + 6.0*d2*(na*na*that.m_M2 + nb*nb*m_M2)/(n*n)
+      + 4.0*d*(na*that.m_M3 - nb*m_M3)/n;
+
+  m_mean += ( d*nb/n );
+  m_M2    = M2;
+  m_M3    = M3;
+  m_M4    = M4;
+  n_samp += that.n_samp;
+}
+
+
+// =======================================================================================
+/** @brief Batch Update.
+ *  @param[in] a pointer to an array of sample values.
+ *  @param[in] n number of ellements in the sample array.
+ *
+ *  The array is divided into contiguous ranges, one per OpenMP thread. Each thread
+ *  accumulates its range and the partial results are merged, in order, into this
+ *  accumulator. Small arrays are accumulated serially.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::moments::batch( const real8_t* a, const int64_t n ) {
+  // -------------------------------------------------------------------------------------
+  static const int64_t PARALLEL_MIN = 65536;
+
+#ifdef _OPENMP
+  const int32_t nthr = ( PARALLEL_MIN > n ) ? ( 1 ) : ( omp_get_max_threads() );
+#else
+  const int32_t nthr = 1;
+#endif
+
+  if ( 1 == nthr ) {
+    for ( int64_t i=0; i<n; i++ ) {
+      update( a[i] );
+    }
+    return;
+  }
+
+  moments* part = new moments[ nthr ];
+
+#pragma omp parallel num_threads( nthr )
+  {
+#ifdef _OPENMP
+    const int32_t tid = omp_get_thread_num();
+#else
+    const int32_t tid = 0;
+#endif
+    const int64_t i0 = ( (int64_t)tid       * n ) / nthr;
+    const int64_t i1 = ( (int64_t)(tid + 1) * n ) / nthr;
+    moments& P = part[ tid ];
+    for ( int64_t i=i0; i<i1; i++ ) {
+      P.update( a[i] );
+    }
+  }
+
+  for ( int32_t t=0; t<nthr; t++ ) {
+    merge( part[t] );
+  }
+
+  delete[] part;
+}
+
+
+// =======================================================================================
+/** @brief Batch Update.
+ *  @param[in] tab  reference to a Table.
+ *  @param[in] vidx index of the variable (column) to accumulate.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::moments::batch( const Table& tab, const int32_t vidx ) {
+  // -------------------------------------------------------------------------------------
+  batch( tab.col( vidx ), (int64_t) tab.size(0) );
+}
+
+
+// =======================================================================================
+/** @brief Constructor.
+ *  @param[in] k accuracy parameter (default: 200).
+ *  @param[in] s seed for the compaction coin (default: 0, use the built in seed).
+ */
+// ---------------------------------------------------------------------------------------
+Statistics::quantile::quantile( const int32_t k, const u_int64_t s ) :
+    k_param(k), n_samp(0), n_kept(0), n_max(0), m_minv(D_ZERO), m_maxv(D_ZERO),
+    seed(s), compactor() {
+  // -------------------------------------------------------------------------------------
+  if ( 8 > k_param ) {
+    logger->warn( LOCATION, "k=%d is too small, using 8", k_param );
+    k_param = 8;
+  }
+  if ( 0 == seed ) {
+    seed = 0x2545f4914f6cdd1dUL;
+  }
+  grow();
+}
+
+
+// =======================================================================================
+/** @brief Destructor.
+ */
+// ---------------------------------------------------------------------------------------
+Statistics::quantile::~quantile( void ) {
+  // -------------------------------------------------------------------------------------
+}
+
+
+// =======================================================================================
+/** @brief Capacity.
+ *  @param[in] h compactor level.
+ *  @return maximum number of items held at this level before it is compacted.
+ *
+ *  Capacity decays geometrically (by 2/3) below the top level.
+ */
+// ---------------------------------------------------------------------------------------
+int32_t Statistics::quantile::capacity( const int32_t h ) const {
+  // -------------------------------------------------------------------------------------
+  const int32_t depth = static_cast<int32_t>( compactor.size() ) - h - 1;
+  const int32_t cap   = static_cast<int32_t>
+      ( ceil( static_cast<real8_t>(k_param) * pow( 2.0/3.0, depth ) ) );
+  return ( 2 > cap ) ? ( 2 ) : ( cap );
+}
+
+
+// =======================================================================================
+/** @brief Grow.
+ *
+ *  Add a new top level compactor and recompute the total capacity.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::quantile::grow( void ) {
+  // -------------------------------------------------------------------------------------
+  compactor.push_back( std::vector<real8_t>() );
+  const int32_t H = static_cast<int32_t>( compactor.size() );
+  n_max = 0;
+  for ( int32_t h=0; h<H; h++ ) {
+    n_max += capacity( h );
+  }
+}
+
+
+// =======================================================================================
+/** @brief Coin.
+ *  @return a pseudo random bit (xorshift64).
+ */
+// ---------------------------------------------------------------------------------------
+bool Statistics::quantile::coin( void ) {
+  // -------------------------------------------------------------------------------------
+  seed ^= ( seed << 13 );
+  seed ^= ( seed >>  7 );
+  seed ^= ( seed << 17 );
+  return ( 0 != ( seed & 0x100 ) );
+}
+
+
+// =======================================================================================
+/** @brief Compress.
+ *
+ *  Compact the lowest full level. The level is sorted, and one item from each
+ *  adjacent pair (chosen by a single coin flip) is promoted to the next level. An odd
+ *  item out stays behind.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::quantile::compress( void ) {
+  // -------------------------------------------------------------------------------------
+  for ( int32_t h=0; h<static_cast<int32_t>( compactor.size() ); h++ ) {
+    if ( static_cast<int32_t>( compactor[h].size() ) >= capacity( h ) ) {
+      if ( h+1 >= static_cast<int32_t>( compactor.size() ) ) {
+        grow();
+      }
+
+      std::vector<real8_t>& src = compactor[h];
+      std::vector<real8_t>& dst = compactor[h+1];
+
+      std::sort( src.begin(), src.end() );
+
+      const size_t odd = src.size() % 2;
+      const size_t off = odd + ( coin() ? 1 : 0 );
+      for ( size_t i=off; i<src.size(); i+=2 ) {
+        dst.push_back( src[i] );
+      }
+      src.resize( odd );
+
+      n_kept = 0;
+      for ( size_t j=0; j<compactor.size(); j++ ) {
+        n_kept += static_cast<int32_t>( compactor[j].size() );
+      }
+      return;
+    }
+  }
+}
+
+
+// =======================================================================================
+/** @brief Reset.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::quantile::reset( void ) {
+  // -------------------------------------------------------------------------------------
+  compactor.clear();
+  n_samp = 0;
+  n_kept = 0;
+  m_minv = D_ZERO;
+  m_maxv = D_ZERO;
+  grow();
+}
+
+
+// =======================================================================================
+/** @brief Rank Error.
+ *  @return normalized rank error that holds with 99% confidence.
+ *
+ *  Empirical fit for KLL sketches with geometric capacity decay (Apache DataSketches).
+ */
+// ---------------------------------------------------------------------------------------
+real8_t Statistics::quantile::rank_error( void ) const {
+  // -------------------------------------------------------------------------------------
+  return 2.296 / pow( static_cast<real8_t>( k_param ), 0.9723 );
+}
+
+
+// =======================================================================================
+/** @brief Update.
+ *  @param[in] x sample value.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::quantile::update( const real8_t x ) {
+  // -------------------------------------------------------------------------------------
+  if ( 0 == n_samp ) {
+    m_minv = x;
+    m_maxv = x;
+  } else {
+    if ( x < m_minv ) { m_minv = x; }
+    if ( x > m_maxv ) { m_maxv = x; }
+  }
+
+  compactor[0].push_back( x );
+  n_samp += 1;
+  n_kept += 1;
+
+  if ( n_kept >= n_max ) {
+    compress();
+  }
+}
+
+
+// =======================================================================================
+/** @brief Merge.
+ *  @param[in] that reference to another sketch.
+ *  @return true if an error occured.
+ */
+// ---------------------------------------------------------------------------------------
+bool Statistics::quantile::merge( const quantile& that ) {
+  // -------------------------------------------------------------------------------------
+  if ( that.k_param != k_param ) {
+    logger->error( LOCATION, "can not merge sketches with k=%d and k=%d",
+                   k_param, that.k_param );
+    return true;
+  }
+
+  if ( 0 == that.n_samp ) {
+    return false;
+  }
+
+  if ( 0 == n_samp ) {
+    m_minv = that.m_minv;
+    m_maxv = that.m_maxv;
+  } else {
+    if ( that.m_minv < m_minv ) { m_minv = that.m_minv; }
+    if ( that.m_maxv > m_maxv ) { m_maxv = that.m_maxv; }
+  }
+
+  while ( compactor.size() < that.compactor.size() ) {
+    grow();
+  }
+
+  for ( size_t h=0; h<that.compactor.size(); h++ ) {
+    compactor[h].insert( compactor[h].end(),
+                         that.compactor[h].begin(), that.compactor[h].end() );
+    n_kept += static_cast<int32_t>( that.compactor[h].size() );
+  }
+  n_samp += that.n_samp;
+
+  while ( n_kept >= n_max ) {
+    compress();
+  }
+
+  return false;
+}
+
+
+// =======================================================================================
+/** @brief Batch Update.
+ *  @param[in] a pointer to an array of sample values.
+ *  @param[in] n number of ellements in the sample array.
+ *
+ *  Each OpenMP thread sketches a contiguous range of the array, the sketches are
+ *  then merged into this one in order.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::quantile::batch( const real8_t* a, const int64_t n ) {
+  // -------------------------------------------------------------------------------------
+  static const int64_t PARALLEL_MIN = 65536;
+
+#ifdef _OPENMP
+  const int32_t nthr = ( PARALLEL_MIN > n ) ? ( 1 ) : ( omp_get_max_threads() );
+#else
+  const int32_t nthr = 1;
+#endif
+
+  if ( 1 == nthr ) {
+    for ( int64_t i=0; i<n; i++ ) {
+      update( a[i] );
+    }
+    return;
+  }
+
+  std::vector<quantile> part;
+  for ( int32_t t=0; t<nthr; t++ ) {
+    part.push_back( quantile( k_param, seed + 0x9e3779b97f4a7c15UL * (u_int64_t)(t+1) ) );
+  }
+
+#pragma omp parallel num_threads( nthr )
+  {
+#ifdef _OPENMP
+    const int32_t tid = omp_get_thread_num();
+#else
+    const int32_t tid = 0;
+#endif
+    const int64_t i0 = ( (int64_t)tid       * n ) / nthr;
+    const int64_t i1 = ( (int64_t)(tid + 1) * n ) / nthr;
+    quantile& P = part[ static_cast<size_t>( tid ) ];
+    for ( int64_t i=i0; i<i1; i++ ) {
+      P.update( a[i] );
+    }
+  }
+
+  for ( int32_t t=0; t<nthr; t++ ) {
+    merge( part[ static_cast<size_t>( t ) ] );
+  }
+}
+
+
+// =======================================================================================
+/** @brief Batch Update.
+ *  @param[in] tab  reference to a Table.
+ *  @param[in] vidx index of the variable (column) to sketch.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::quantile::batch( const Table& tab, const int32_t vidx ) {
+  // -------------------------------------------------------------------------------------
+  batch( tab.col( vidx ), (int64_t) tab.size(0) );
+}
+
+
+// =======================================================================================
+/** @brief Weighted Items.
+ *  @param[out] val retained items in ascending order.
+ *  @param[out] wgt weight of each item.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::quantile::weighted( std::vector<real8_t>& val,
+                                     std::vector<int64_t>& wgt ) const {
+  // -------------------------------------------------------------------------------------
+  std::vector< std::pair<real8_t,int64_t> > items;
+  items.reserve( static_cast<size_t>( n_kept ) );
+  int64_t w = 1;
+  for ( size_t h=0; h<compactor.size(); h++ ) {
+    for ( size_t i=0; i<compactor[h].size(); i++ ) {
+      items.push_back( std::make_pair( compactor[h][i], w ) );
+    }
+    w *= 2;
+  }
+  std::sort( items.begin(), items.end() );
+
+  val.resize( items.size() );
+  wgt.resize( items.size() );
+  for ( size_t i=0; i<items.size(); i++ ) {
+    val[i] = items[i].first;
+    wgt[i] = items[i].second;
+  }
+}
+
+
+// =======================================================================================
+/** @brief Rank.
+ *  @param[in] x value.
+ *  @return estimated fraction of the samples that are less than or equal to x.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t Statistics::quantile::rank( const real8_t x ) const {
+  // -------------------------------------------------------------------------------------
+  if ( 0 == n_samp ) {
+    return D_ZERO;
+  }
+  int64_t w = 1;
+  int64_t r = 0;
+  for ( size_t h=0; h<compactor.size(); h++ ) {
+    for ( size_t i=0; i<compactor[h].size(); i++ ) {
+      if ( compactor[h][i] <= x ) {
+        r += w;
+      }
+    }
+    w *= 2;
+  }
+  return static_cast<real8_t>( r ) / static_cast<real8_t>( n_samp );
+}
+
+
+// =======================================================================================
+/** @brief Quantile.
+ *  @param[in] q normalized rank [0,1].
+ *  @return estimated value at rank q.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t Statistics::quantile::get( const real8_t q ) const {
+  // -------------------------------------------------------------------------------------
+  real8_t v;
+  get( &v, &q, 1 );
+  return v;
+}
+
+
+// =======================================================================================
+/** @brief Quantiles.
+ *  @param[out] v pointer to an array to receive the estimated values.
+ *  @param[in]  q pointer to an array of normalized ranks [0,1].
+ *  @param[in]  n number of ranks.
+ *
+ *  Sort the retained items once for any number of queries.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::quantile::get( real8_t* v, const real8_t* q, const int32_t n ) const {
+  // -------------------------------------------------------------------------------------
+  std::vector<real8_t> val;
+  std::vector<int64_t> wgt;
+  weighted( val, wgt );
+
+  const real8_t fn = static_cast<real8_t>( n_samp );
+
+  for ( int32_t j=0; j<n; j++ ) {
+    if ( ( 0 == n_samp ) || ( D_ZERO >= q[j] ) ) {
+      v[j] = m_minv;
+    } else if ( D_ONE <= q[j] ) {
+      v[j] = m_maxv;
+    } else {
+      const real8_t target = q[j] * fn;
+      int64_t cum = 0;
+      v[j] = m_maxv;
+      for ( size_t i=0; i<val.size(); i++ ) {
+        cum += wgt[i];
+        if ( static_cast<real8_t>( cum ) >= target ) {
+          v[j] = val[i];
+          break;
+        }
+      }
+    }
+  }
+}
+
+
+// =======================================================================================
+/** @brief Constructor.
+ *  @param[in] p precision, the number of hash bits used to index registers (4..18).
+ */
+// ---------------------------------------------------------------------------------------
+Statistics::distinct::distinct( const int32_t p ) : prec(p), nreg(0), reg(0) {
+  // -------------------------------------------------------------------------------------
+  if ( 4 > prec ) {
+    logger->warn( LOCATION, "precision %d is too small, using 4", prec );
+    prec = 4;
+  }
+  if ( 18 < prec ) {
+    logger->warn( LOCATION, "precision %d is too large, using 18", prec );
+    prec = 18;
+  }
+  nreg = 1 << prec;
+  reg  = new u_int8_t[ nreg ];
+  reset();
+}
+
+
+// =======================================================================================
+/** @brief Copy Constructor.
+ *  @param[in] that reference to another counter.
+ */
+// ---------------------------------------------------------------------------------------
+Statistics::distinct::distinct( const distinct& that ) :
+    prec(that.prec), nreg(that.nreg), reg(0) {
+  // -------------------------------------------------------------------------------------
+  reg = new u_int8_t[ nreg ];
+  memcpy( reg, that.reg, static_cast<size_t>( nreg ) );
+}
+
+
+// =======================================================================================
+/** @brief Destructor.
+ */
+// ---------------------------------------------------------------------------------------
+Statistics::distinct::~distinct( void ) {
+  // -------------------------------------------------------------------------------------
+  delete[] reg;
+  reg = static_cast<u_int8_t*>(0);
+}
+
+
+// =======================================================================================
+/** @brief Assignment.
+ *  @param[in] that reference to another counter.
+ */
+// ---------------------------------------------------------------------------------------
+Statistics::distinct& Statistics::distinct::operator=( const distinct& that ) {
+  // -------------------------------------------------------------------------------------
+  if ( this != &that ) {
+    if ( nreg != that.nreg ) {
+      delete[] reg;
+      reg = new u_int8_t[ that.nreg ];
+    }
+    prec = that.prec;
+    nreg = that.nreg;
+    memcpy( reg, that.reg, static_cast<size_t>( nreg ) );
+  }
+  return *this;
+}
+
+
+// =======================================================================================
+/** @brief Reset.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::distinct::reset( void ) {
+  // -------------------------------------------------------------------------------------
+  memset( reg, 0, static_cast<size_t>( nreg ) );
+}
+
+
+// =======================================================================================
+/** @brief Relative Error.
+ *  @return relative standard error of the estimate.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t Statistics::distinct::rel_error( void ) const {
+  // -------------------------------------------------------------------------------------
+  return 1.04 / sqrt( static_cast<real8_t>( nreg ) );
+}
+
+
+// =======================================================================================
+/** @brief Hash.
+ *  @param[in] x 64 bit key.
+ *  @return well mixed 64 bit hash (SplitMix64 finalizer).
+ */
+// ---------------------------------------------------------------------------------------
+u_int64_t Statistics::distinct::hash( u_int64_t x ) {
+  // -------------------------------------------------------------------------------------
+  x += 0x9e3779b97f4a7c15UL;
+  x  = ( x ^ ( x >> 30 ) ) * 0xbf58476d1ce4e5b9UL;
+  x  = ( x ^ ( x >> 27 ) ) * 0x94d049bb133111ebUL;
+  return x ^ ( x >> 31 );
+}
+
+
+// =======================================================================================
+/** @brief Insert.
+ *  @param[in] h hashed value.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::distinct::insert( const u_int64_t h ) {
+  // -------------------------------------------------------------------------------------
+  const u_int64_t idx = h >> ( 64 - prec );
+  const u_int64_t w   = h << prec;
+  const int32_t   rho = ( 0 == w ) ?
+      ( 65 - prec ) : ( __builtin_clzll( static_cast<unsigned long long>( w ) ) + 1 );
+  if ( rho > static_cast<int32_t>( reg[idx] ) ) {
+    reg[idx] = static_cast<u_int8_t>( rho );
+  }
+}
+
+
+// =======================================================================================
+/** @brief Add.
+ *  @param[in] x value. (-0 is counted as 0)
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::distinct::add( const real8_t x ) {
+  // -------------------------------------------------------------------------------------
+  const real8_t y = x + D_ZERO;  // -0 + 0 = +0
+  u_int64_t b;
+  memcpy( &b, &y, sizeof(b) );
+  insert( hash( b ) );
+}
+
+
+// =======================================================================================
+/** @brief Add.
+ *  @param[in] x value.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::distinct::add( const int64_t x ) {
+  // -------------------------------------------------------------------------------------
+  insert( hash( static_cast<u_int64_t>( x ) ) );
+}
+
+
+// =======================================================================================
+/** @brief Add.
+ *  @param[in] str string value (FNV-1a, then mixed).
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::distinct::add( const std::string& str ) {
+  // -------------------------------------------------------------------------------------
+  u_int64_t h = 0xcbf29ce484222325UL;
+  for ( size_t i=0; i<str.size(); i++ ) {
+    h ^= static_cast<u_int64_t>( static_cast<unsigned char>( str[i] ) );
+    h *= 0x100000001b3UL;
+  }
+  insert( hash( h ) );
+}
+
+
+// =======================================================================================
+/** @brief Batch Add.
+ *  @param[in] a pointer to an array of values.
+ *  @param[in] n number of ellements in the array.
+ *
+ *  Register updates are a max, so per-thread counters merge exactly.
+ */
+// ---------------------------------------------------------------------------------------
+void Statistics::distinct::batch( const real8_t* a, const int64_t n ) {
+  // -------------------------------------------------------------------------------------
+  static const int64_t PARALLEL_MIN = 65536;
+
+#ifdef _OPENMP
+  const int32_t nthr = ( PARALLEL_MIN > n ) ? ( 1 ) : ( omp_get_max_threads() );
+#else
+  const int32_t nthr = 1;
+#endif
+
+  if ( 1 == nthr ) {
+    for ( int64_t i=0; i<n; i++ ) {
+      add( a[i] );
+    }
+    return;
+  }
+
+  std::vector<distinct> part( static_cast<size_t>( nthr ), distinct( prec ) );
+
+#pragma omp parallel num_threads( nthr )
+  {
+#ifdef _OPENMP
+    const int32_t tid = omp_get_thread_num();
+#else
+    const int32_t tid = 0;
+#endif
+    const int64_t i0 = ( (int64_t)tid       * n ) / nthr;
+    const int64_t i1 = ( (int64_t)(tid + 1) * n ) / nthr;
+    distinct& P = part[ static_cast<size_t>( tid ) ];
+    for ( int64_t i=i0; i<i1; i++ ) {
+      P.add( a[i] );
+    }
+  }
+
+  for ( int32_t t=0; t<nthr; t++ ) {
+    merge( part[ static_cast<size_t>( t ) ] );
+  }
+}
+
+
+// =======================================================================================
+/** @brief Merge.
+ *  @param[in] that reference to another counter.
+ *  @return true if an error occured.
+ */
+// ---------------------------------------------------------------------------------------
+bool Statistics::distinct::merge( const distinct& that ) {
+  // -------------------------------------------------------------------------------------
+  if ( that.prec != prec ) {
+    logger->error( LOCATION, "can not merge counters with precision %d and %d",
+                   prec, that.prec );
+    return true;
+  }
+  for ( int32_t i=0; i<nreg; i++ ) {
+    if ( that.reg[i] > reg[i] ) {
+      reg[i] = that.reg[i];
+    }
+  }
+  return false;
+}
+
+
+// =======================================================================================
+/** @brief Estimate.
+ *  @return estimated number of distinct values added.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t Statistics::distinct::estimate( void ) const {
+  // -------------------------------------------------------------------------------------
+  const real8_t m = static_cast<real8_t>( nreg );
+  real8_t alpha;
+  switch( nreg ) {
+    case 16: alpha = 0.673; break;
+    case 32: alpha = 0.697; break;
+    case 64: alpha = 0.709; break;
+    default: alpha = 0.7213 / ( D_ONE + 1.079 / m );
+  }
+
+  real8_t sum   = D_ZERO;
+  int32_t zeros = 0;
+  for ( int32_t i=0; i<nreg; i++ ) {
+    sum += ldexp( D_ONE, -static_cast<int>( reg[i] ) );
+    if ( 0 == reg[i] ) { zeros += 1; }
+  }
+
+  const real8_t E = alpha * m * m / sum;
+
+  if ( ( E <= 2.5 * m ) && ( 0 < zeros ) ) {
+    return m * log( m / static_cast<real8_t>( zeros ) );   // linear counting
+  }
+
+  return E;
+}
+
+
 // =======================================================================================
 /** @brief Constructor.
  *  @param[in] n number of columns in the sample set (dimensions)
@@ -754,29 +1647,38 @@ bool Statistics::multi::extra( Table& table ) {
 
 
 // =====================================================================================
+/** @brief Correlate.
+ *  @param[in] table input data.
+ *  @retrun true if an error occured.
+ *
+ *  Compute the covariance and correlation matrices. The means and co-moments are
+ *  accumulated in a single streaming pass over the table (@see streamCovariance),
+ *  so calling compile first is not required.
+ */
 // -------------------------------------------------------------------------------------
 bool Statistics::multi::correlate ( Table& table ) {
   // -----------------------------------------------------------------------------------
   t_level2b = false;
 
-  if ( ! t_level1 ) {
-    logger->warn( LOCATION, "this requires that you call compile first" );
-    if ( this->compile( table ) ) {
-      logger->warn( LOCATION, "   I tried to do it for you, but it failed" );
-      return true;
-    }
-    logger->warn( LOCATION, "   I did it for you" );
+  if ( size( table, 1 ) != t_nvar ) {
+    logger->error( LOCATION, "table has %d variables, expected %d",
+                   size( table, 1 ), t_nvar );
+    return true;
   }
 
-  real8_t temp_mu[ size( table, 1 ) ];
-  mean( temp_mu );
+  if ( 2 > size( table, 0 ) ) {
+    logger->error( LOCATION, "at least two samples are required" );
+    return true;
+  }
+
+  real8_t temp_mu[ t_nvar ];
 
   // ----- calculate the covariance matrix ---------------------------------------------
   if ( static_cast<Matrix*>(0) == covariance ) {
     covariance = new Matrix(t_nvar);
   }
 
-  ::covariance( *covariance, table, temp_mu );
+  streamCovariance( *covariance, temp_mu, table );
 
   // ----- calculate the correlation matrix --------------------------------------------
   if ( static_cast<Matrix*>(0) == correlation ) {
@@ -785,7 +1687,8 @@ bool Statistics::multi::correlate ( Table& table ) {
 
   ::correlate( *correlation, *covariance );
 
-  return (t_level2b = true);
+  t_level2b = true;
+  return false;
 }
 
 
@@ -827,14 +1730,16 @@ bool Statistics::multi::invert_covariance( void ) {
 
 
 
-#define INIT_HVAR(a) nbin(a), hbin(a), hctr(a), nsamp(a)
+#define INIT_HVAR(a) nbin(a), hbin(a), hctr(a), nsamp(a), \
+    sorted(false), uniform(false), origin(D_ZERO), scale(D_ZERO)
 
 // =======================================================================================
 /** @brief Initialize.
  *  @param[in] centers pointer to an array of bin centers..
  *  @param[in] n number of bins.
  *
- *  Create the histogram bins and thier labled centers.
+ *  Create the histogram bins and thier labled centers. The centers are checked for
+ *  ascending order and even spacing, these select the fast paths used by map.
  */
 // ---------------------------------------------------------------------------------------
 void Statistics::histogram::init( const real8_t* centers, const int32_t n ) {
@@ -847,6 +1752,36 @@ void Statistics::histogram::init( const real8_t* centers, const int32_t n ) {
     hbin[i] = 0;
   }
   nsamp     = 0;
+
+  // ----- ascending centers allow a binary search -------------------------------------
+  sorted = true;
+  for ( int32_t i=1; i<n; i++ ) {
+    if ( hctr[i] < hctr[i-1] ) {
+      sorted = false;
+      break;
+    }
+  }
+
+  // ----- evenly spaced centers allow an arithmetic index -----------------------------
+  // map refines the computed index against the stored centers, so spacing only needs
+  // to be close enough to land within one bin of the answer.
+  uniform = false;
+  if ( sorted && ( 1 < n ) ) {
+    const real8_t diff = ( hctr[n-1] - hctr[0] ) / static_cast<real8_t>(n-1);
+    if ( D_ZERO < diff ) {
+      uniform = true;
+      const real8_t tol = 1.0e-6 * diff;
+      for ( int32_t i=1; i<n; i++ ) {
+        const real8_t expect = hctr[0] + static_cast<real8_t>(i) * diff;
+        if ( tol < Abs( hctr[i] - expect ) ) {
+          uniform = false;
+          break;
+        }
+      }
+      origin = hctr[0];
+      scale  = D_ONE / diff;
+    }
+  }
 }
 
 
@@ -978,14 +1913,54 @@ void Statistics::histogram::add( const int32_t idx ) {
  *  @param[in] A pointer to an array of values to add.
  *  @param[in] n number of values to add.
  *
- *  Add an array of values to this histogram.
+ *  Add an array of values to this histogram. Large arrays are divided among the
+ *  OpenMP threads, each filling a private set of bins that are summed at the end.
  */
 // ---------------------------------------------------------------------------------------
 void Statistics::histogram::add( const real8_t* A, const int32_t n ) {
   // -------------------------------------------------------------------------------------
-  for ( int32_t i=0; i<n; i++ ) {
-    add( A[i] );
+  static const int32_t PARALLEL_MIN = 32768;
+
+#ifdef _OPENMP
+  const int32_t nthr = ( PARALLEL_MIN > n ) ? ( 1 ) : ( omp_get_max_threads() );
+#else
+  const int32_t nthr = 1;
+#endif
+
+  if ( 1 == nthr ) {
+    for ( int32_t i=0; i<n; i++ ) {
+      add( A[i] );
+    }
+    return;
+  }
+
+  int32_t* part = new int32_t[ nthr*nbin ];
+  zero( part, nthr*nbin );
+
+#pragma omp parallel num_threads( nthr )
+  {
+#ifdef _OPENMP
+    const int32_t tid = omp_get_thread_num();
+#else
+    const int32_t tid = 0;
+#endif
+    const int32_t i0  = static_cast<int32_t>( ( (int64_t)tid       * n ) / nthr );
+    const int32_t i1  = static_cast<int32_t>( ( (int64_t)(tid + 1) * n ) / nthr );
+    int32_t*      sub = part + tid*nbin;
+    for ( int32_t i=i0; i<i1; i++ ) {
+      sub[ map( A[i] ) ] += 1;
+    }
   }
+
+  for ( int32_t t=0; t<nthr; t++ ) {
+    const int32_t* sub = part + t*nbin;
+    for ( int32_t b=0; b<nbin; b++ ) {
+      hbin[b] += sub[b];
+    }
+  }
+  nsamp += n;
+
+  delete[] part;
 }
 
 
@@ -1003,15 +1978,68 @@ inline real8_t dist2( const real8_t a, const real8_t b ) {
 }
 
 
+// =======================================================================================
+/** @brief Refine.
+ *  @param[in] x   value to map.
+ *  @param[in] idx candidate bin index.
+ *  @return index of the nearest center.
+ *
+ *  Walk from a candidate bin to the nearest center in a sorted set of centers. Ties
+ *  resolve to the lower index, the same as a linear scan.
+ */
+// ---------------------------------------------------------------------------------------
+int32_t Statistics::histogram::refine( const real8_t x, int32_t idx ) const {
+  // -------------------------------------------------------------------------------------
+  while ( ( 0 < idx ) && ( dist2( x, hctr[idx-1] ) <= dist2( x, hctr[idx] ) ) ) {
+    idx -= 1;
+  }
+  while ( ( idx < nbin-1 ) && ( dist2( x, hctr[idx+1] ) < dist2( x, hctr[idx] ) ) ) {
+    idx += 1;
+  }
+  return idx;
+}
+
+
 // =======================================================================================
 /** @brief Map.
  *  @param[in] x value to map.
  *
- *  Locate the bin that this value belongs to.
+ *  Locate the bin that this value belongs to. Evenly spaced centers are indexed
+ *  arithmetically, other ascending centers are located by a binary search. Unordered
+ *  centers fall back to a linear scan.
  */
 // ---------------------------------------------------------------------------------------
 int32_t Statistics::histogram::map( const real8_t x ) const {
   // -------------------------------------------------------------------------------------
+  if ( std::isnan( x ) ) {
+    return 0;
+  }
+
+  if ( uniform ) {
+    const real8_t t = ( x - origin ) * scale;
+    if ( D_ZERO >= t ) {
+      return refine( x, 0 );
+    }
+    if ( static_cast<real8_t>(nbin-1) <= t ) {
+      return refine( x, nbin-1 );
+    }
+    return refine( x, static_cast<int32_t>( t + D_HALF ) );
+  }
+
+  if ( sorted ) {
+    int32_t lo = 0;
+    int32_t hi = nbin;
+    while ( lo < hi ) {
+      const int32_t mid = lo + ( hi - lo ) / 2;
+      if ( hctr[mid] < x ) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return refine( x, ( lo < nbin ) ? ( lo ) : ( nbin-1 ) );
+  }
+
   int32_t  idx   = 0;
   real8_t min_d = dist2( x, hctr[idx] );
   for ( int32_t i=1; i<nbin; i++ ) {
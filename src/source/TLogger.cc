@@ -37,6 +37,18 @@
 
 #include <TLogger.hh>
 #include <time.h>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+
+#define TLOGGER_RECORD_SIZE   TLogger::DEFERRED_BYTES   ///< bytes carried by one async record
+#define TLOGGER_MAX_RINGS     256   ///< maximum number of concurrent producer threads
+#define TLOGGER_IDLE_MS        20   ///< writer sleep when all rings are empty
+#define TLOGGER_TO_CONSOLE      1   ///< record destination: stderr
+#define TLOGGER_TO_FILE         2   ///< record destination: log file
 
 
 TLogger* TLogger::theInstance = static_cast<TLogger*>(0);
@@ -48,6 +60,8 @@ const int TLogger::WARN     = 3;
 const int TLogger::INFO     = 4;
 const int TLogger::DEBUG    = 5;
 
+const size_t TLogger::DEFERRED_BYTES;
+
 
 // =======================================================================================
 /** @brief Default Abort Handler.
@@ -74,6 +88,28 @@ static __DefaultAbortHandler __TDAH;
 TLogger::AbortHandler* TLogger::DEFAULT_ABORT_HANDLER = &__TDAH;
 
 
+
+// =======================================================================================
+/** @brief Format a time stamp.
+ *  @param buffer destination (at least 32 characters).
+ *  @param raw    time to format.
+ *  @return pointer to the buffer.
+ */
+// ---------------------------------------------------------------------------------------
+static char* __FormatStamp( char* buffer, time_t raw ) {
+  // -------------------------------------------------------------------------------------
+  struct tm temp;
+  gmtime_r( &raw, &temp );
+
+  sprintf( buffer,
+	   "%04d%02d.%02d %02d:%02d:%02d",
+	   temp.tm_year+1900, temp.tm_mon+1, temp.tm_mday,
+	   temp.tm_hour, temp.tm_min, temp.tm_sec );
+
+  return buffer;
+}
+
+
 // =======================================================================================
 /** @brief Timestamp.
  *  @param buffer pointer to a buffer to store the time stamp. ( Defaul: null ).
@@ -91,18 +127,400 @@ char* TLogger::TimeStamp( char* buffer ) {
     P = default_buffer;
   }
 
-  time_t             raw;
-  struct tm          temp;
+  return __FormatStamp( P, time( static_cast<time_t*>(0) ) );
+}
 
-  time( &raw );
-  gmtime_r( &raw, &temp );
 
-  sprintf( P,
-	   "%04d%02d.%02d %02d:%02d:%02d",
-	   temp.tm_year+1900, temp.tm_mon+1, temp.tm_mday,
-	   temp.tm_hour, temp.tm_min, temp.tm_sec );
+// =======================================================================================
+/** @brief Single producer / single consumer record ring.
+ *
+ *  One ring is owned by each thread that logs while the logger is asynchronous. The
+ *  owning thread is the only writer of head, the background writer (holding the drain
+ *  lock) is the only writer of tail, so neither side needs a lock.
+ */
+// ---------------------------------------------------------------------------------------
+class TLoggerRing {
+  // -------------------------------------------------------------------------------------
+ public:
+  struct record {
+    int32_t           dest;    ///< destination bit mask
+    char              code;    ///< severity character (deferred records)
+    time_t            when;    ///< time of the call   (deferred records)
+    TLogger::render_t fn;      ///< renderer, or null if text is already formatted
+    alignas(16) char  text[TLOGGER_RECORD_SIZE]; ///< formatted line or deferred payload
+  };
+
+  record*                slot;   ///< record storage
+  u_int64_t              cap;    ///< number of records (power of two)
+  std::atomic<u_int64_t> head;   ///< next record to be written by the producer
+  std::atomic<u_int64_t> tail;   ///< next record to be read by the consumer
+  std::atomic<bool>      owned;  ///< a live thread is using this ring
+
+  TLoggerRing( u_int64_t n ) : slot(0), cap(n), head(0), tail(0), owned(true) {
+    slot = new record[n];
+  }
+
+  ~TLoggerRing( void ) { delete[] slot; }
+
+ private:
+  TLoggerRing( const TLoggerRing& );
+  TLoggerRing& operator=( const TLoggerRing& );
+};
+
+
+// =======================================================================================
+/** @brief Asynchronous logging backend.
+ *
+ *  Callers format a record straight into a free slot of their own ring and publish it.
+ *  A background thread gathers the rings, writes the records in batches to a log file
+ *  that stays open, and flushes once per batch. A full ring drops the record and counts
+ *  it; the writer reports the count in the log.
+ */
+// ---------------------------------------------------------------------------------------
+class TLoggerAsync {
+  // -------------------------------------------------------------------------------------
+ public:
+  TLoggerAsync  ( u_int64_t ring_records, const char* fspc );
+  ~TLoggerAsync ( void );
+
+  TLoggerRing::record* acquire ( void );
+  void                 commit  ( void );
+  void                 flush   ( void );
+  void                 reopen  ( const char* fspc );
+
+  u_int64_t dropped( void ) const { return n_drop.load( std::memory_order_relaxed ); }
+
+  static std::atomic<u_int64_t> live;  ///< id of the backend currently accepting records
+
+ protected:
+  TLoggerRing*             ring[TLOGGER_MAX_RINGS]; ///< registered producer rings
+  std::atomic<int32_t>     n_ring;     ///< number of registered rings
+  u_int64_t                ring_cap;   ///< records per ring
+  u_int64_t                my_id;      ///< unique id of this backend
+  std::atomic<u_int64_t>   n_drop;     ///< records dropped because a ring was full
+  u_int64_t                n_report;   ///< dropped count already reported
+  FILE*                    fp;         ///< open log file (or null)
+  char                     line[TLOGGER_RECORD_SIZE*4]; ///< writer side render buffer
+  bool                     running;    ///< writer should keep going
+  std::mutex               reg_mtx;    ///< serialize ring registration
+  std::mutex               drain_mtx;  ///< only one consumer at a time
+  std::mutex               cv_mtx;     ///< guards running and the wake up
+  std::condition_variable  wake;       ///< wake the writer early
+  std::thread*             writer;     ///< background writer thread
+
+  TLoggerRing* local  ( void );
+  int32_t      drain  ( void );
+  const char*  render ( const TLoggerRing::record* rec );
+  void         loop   ( void );
+
+ private:
+  TLoggerAsync( const TLoggerAsync& );
+  TLoggerAsync& operator=( const TLoggerAsync& );
+};
+
+
+std::atomic<u_int64_t> TLoggerAsync::live(0);
+static std::atomic<u_int64_t> __TLoggerAsyncSerial(0);
+
+
+// =======================================================================================
+/** @brief Thread local ring handle.
+ *
+ *  Releases the ring back to the backend when the thread exits, so that short lived
+ *  threads do not exhaust the ring table.
+ */
+// ---------------------------------------------------------------------------------------
+struct __TLoggerLocal {
+  TLoggerRing* ring;
+  u_int64_t    id;
+  __TLoggerLocal( void ) : ring(0), id(0) {}
+  ~__TLoggerLocal( void ) {
+    if ( ( 0 != ring ) && ( id == TLoggerAsync::live.load() ) ) {
+      ring->owned.store( false );
+    }
+  }
+ private:
+  __TLoggerLocal( const __TLoggerLocal& );
+  __TLoggerLocal& operator=( const __TLoggerLocal& );
+};
+
+static thread_local __TLoggerLocal __tlocal;
+
+
+// =======================================================================================
+/** @brief Constructor.
+ *  @param ring_records number of records in each per thread ring.
+ *  @param fspc         full path to the log file (may be null).
+ *
+ *  Open the log file and start the background writer.
+ */
+// ---------------------------------------------------------------------------------------
+TLoggerAsync::TLoggerAsync( u_int64_t ring_records, const char* fspc )
+    : n_ring(0), ring_cap(0), my_id(0), n_drop(0), n_report(0), fp(0), line(), running(true),
+      reg_mtx(), drain_mtx(), cv_mtx(), wake(), writer(0) {
+  // -------------------------------------------------------------------------------------
+  ring_cap = 2;
+  while ( ring_cap < ring_records ) { ring_cap <<= 1; }
+
+  for ( int32_t i=0; i<TLOGGER_MAX_RINGS; i++ ) { ring[i] = static_cast<TLoggerRing*>(0); }
+
+  reopen( fspc );
+
+  my_id = ++__TLoggerAsyncSerial;
+  live.store( my_id );
+
+  writer = new std::thread( &TLoggerAsync::loop, this );
+}
+
+
+// =======================================================================================
+/** @brief Destructor.
+ *
+ *  Stop the writer, write whatever is left in the rings and close the log file.
+ */
+// ---------------------------------------------------------------------------------------
+TLoggerAsync::~TLoggerAsync( void ) {
+  // -------------------------------------------------------------------------------------
+  live.store( 0 );
+
+  {
+    std::lock_guard<std::mutex> lk( cv_mtx );
+    running = false;
+  }
+  wake.notify_one();
+  writer->join();
+  delete writer;
+
+  flush();
+
+  if ( static_cast<FILE*>(0) != fp ) { fclose( fp ); }
+
+  const int32_t n = n_ring.load();
+  for ( int32_t i=0; i<n; i++ ) { delete ring[i]; }
+}
+
+
+// =======================================================================================
+/** @brief Local ring.
+ *  @return the ring owned by the calling thread (or null if none is available).
+ *
+ *  The first call from each thread claims a released ring or registers a new one.
+ */
+// ---------------------------------------------------------------------------------------
+TLoggerRing* TLoggerAsync::local( void ) {
+  // -------------------------------------------------------------------------------------
+  if ( my_id == __tlocal.id ) { return __tlocal.ring; }
+
+  std::lock_guard<std::mutex> lk( reg_mtx );
+  TLoggerRing* R = static_cast<TLoggerRing*>(0);
+
+  const int32_t n = n_ring.load( std::memory_order_relaxed );
+  for ( int32_t i=0; i<n; i++ ) {
+    bool expect = false;
+    if ( ring[i]->owned.compare_exchange_strong( expect, true ) ) {
+      R = ring[i];
+      break;
+    }
+  }
+
+  if ( ( static_cast<TLoggerRing*>(0) == R ) && ( TLOGGER_MAX_RINGS > n ) ) {
+    R = new TLoggerRing( ring_cap );
+    ring[n] = R;
+    n_ring.store( n+1, std::memory_order_release );
+  }
+
+  __tlocal.ring = R;
+  __tlocal.id   = my_id;
+  return R;
+}
+
+
+// =======================================================================================
+/** @brief Acquire a record.
+ *  @return pointer to the next free record in the calling thread's ring, or null if the
+ *          ring is full (the record is counted as dropped).
+ *
+ *  The caller fills the record and publishes it with commit().
+ */
+// ---------------------------------------------------------------------------------------
+TLoggerRing::record* TLoggerAsync::acquire( void ) {
+  // -------------------------------------------------------------------------------------
+  TLoggerRing* R = local();
+  if ( static_cast<TLoggerRing*>(0) != R ) {
+    const u_int64_t h = R->head.load( std::memory_order_relaxed );
+    const u_int64_t t = R->tail.load( std::memory_order_acquire );
+    if ( ( h - t ) < R->cap ) {
+      return R->slot + ( h & ( R->cap - 1 ) );
+    }
+  }
+  n_drop.fetch_add( 1, std::memory_order_relaxed );
+  return static_cast<TLoggerRing::record*>(0);
+}
+
+
+// =======================================================================================
+/** @brief Commit a record.
+ *
+ *  Publish the record returned by the last acquire(). The writer is woken when the ring
+ *  reaches half capacity, otherwise it picks the record up on its next pass.
+ */
+// ---------------------------------------------------------------------------------------
+void TLoggerAsync::commit( void ) {
+  // -------------------------------------------------------------------------------------
+  TLoggerRing*    R = __tlocal.ring;
+  const u_int64_t h = R->head.load( std::memory_order_relaxed ) + 1;
+  R->head.store( h, std::memory_order_release );
+
+  if ( ( h - R->tail.load( std::memory_order_relaxed ) ) == ( R->cap >> 1 ) ) {
+    wake.notify_one();
+  }
+}
+
+
+// =======================================================================================
+/** @brief Drain.
+ *  @return number of records written.
+ *
+ *  Write every published record to its destinations. Must be called with drain_mtx held.
+ */
+// ---------------------------------------------------------------------------------------
+int32_t TLoggerAsync::drain( void ) {
+  // -------------------------------------------------------------------------------------
+  int32_t count   = 0;
+  bool    console = false;
+
+  const int32_t n = n_ring.load( std::memory_order_acquire );
+  for ( int32_t i=0; i<n; i++ ) {
+    TLoggerRing*    R = ring[i];
+    u_int64_t       t = R->tail.load( std::memory_order_relaxed );
+    const u_int64_t h = R->head.load( std::memory_order_acquire );
+    while ( t < h ) {
+      const TLoggerRing::record* rec  = R->slot + ( t & ( R->cap - 1 ) );
+      const char*                text = rec->text;
+      if ( static_cast<TLogger::render_t>(0) != rec->fn ) {
+        text = render( rec );
+      }
+      if ( 0 != ( rec->dest & TLOGGER_TO_CONSOLE ) ) {
+        fputs( text, stderr );
+        console = true;
+      }
+      if ( ( 0 != ( rec->dest & TLOGGER_TO_FILE ) ) && ( static_cast<FILE*>(0) != fp ) ) {
+        fputs( text, fp );
+      }
+      t++;
+      count++;
+    }
+    R->tail.store( t, std::memory_order_release );
+  }
+
+  const u_int64_t nd = n_drop.load( std::memory_order_relaxed );
+  if ( nd != n_report ) {
+    char stamp[96];
+    FILE* out = ( static_cast<FILE*>(0) != fp ) ? fp : stderr;
+    fprintf( out, "[%s] **W** %llu log records dropped (ring full)\n",
+             TLogger::TimeStamp( stamp ), static_cast<unsigned long long>( nd - n_report ) );
+    n_report = nd;
+    count++;
+  }
+
+  if ( 0 < count ) {
+    if ( console ) { fflush( stderr ); }
+    if ( static_cast<FILE*>(0) != fp ) { fflush( fp ); }
+  }
+
+  return count;
+}
+
+
+// =======================================================================================
+/** @brief Render.
+ *  @param rec deferred record.
+ *  @return pointer to the formatted, newline terminated, line.
+ *
+ *  Format a deferred record on the writer thread. Must be called with drain_mtx held.
+ */
+// ---------------------------------------------------------------------------------------
+const char* TLoggerAsync::render( const TLoggerRing::record* rec ) {
+  // -------------------------------------------------------------------------------------
+  const size_t n = sizeof(line);
+  char         stamp[96];
+  size_t       k = 0;
+
+  int32_t m = TLogger::vformat( line, n, "[%s] **%c** ",
+                                __FormatStamp( stamp, rec->when ), rec->code );
+  if ( 0 < m ) { k += static_cast<size_t>(m); }
+  if ( k > n-2 ) { k = n-2; }
+
+  m = rec->fn( line+k, n-k-1, rec->text );
+  if ( 0 < m ) { k += static_cast<size_t>(m); }
+  if ( k > n-2 ) { k = n-2; }
+
+  line[k]   = '\n';
+  line[k+1] = '\0';
+  return line;
+}
+
 
-  return P;
+// =======================================================================================
+/** @brief Writer loop.
+ *
+ *  Drain the rings until stopped, sleeping briefly whenever they are all empty.
+ */
+// ---------------------------------------------------------------------------------------
+void TLoggerAsync::loop( void ) {
+  // -------------------------------------------------------------------------------------
+  std::unique_lock<std::mutex> lk( cv_mtx );
+  while ( running ) {
+    lk.unlock();
+    int32_t n = 0;
+    {
+      std::lock_guard<std::mutex> dl( drain_mtx );
+      n = drain();
+    }
+    lk.lock();
+    if ( ( 0 == n ) && running ) {
+      wake.wait_for( lk, std::chrono::milliseconds( TLOGGER_IDLE_MS ) );
+    }
+  }
+}
+
+
+// =======================================================================================
+/** @brief Flush.
+ *
+ *  Write every record published so far, in the calling thread.
+ */
+// ---------------------------------------------------------------------------------------
+void TLoggerAsync::flush( void ) {
+  // -------------------------------------------------------------------------------------
+  std::lock_guard<std::mutex> dl( drain_mtx );
+  drain();
+}
+
+
+// =======================================================================================
+/** @brief Reopen.
+ *  @param fspc full path to the new log file (may be null).
+ *
+ *  Write out pending records, then switch the log file.
+ */
+// ---------------------------------------------------------------------------------------
+void TLoggerAsync::reopen( const char* fspc ) {
+  // -------------------------------------------------------------------------------------
+  std::lock_guard<std::mutex> dl( drain_mtx );
+  drain();
+
+  if ( static_cast<FILE*>(0) != fp ) { fclose( fp ); }
+  fp = static_cast<FILE*>(0);
+
+  if ( static_cast<const char*>(0) != fspc ) {
+    fp = fopen( fspc, "a" );
+    if ( static_cast<FILE*>(0) == fp ) {
+      char stamp[96];
+      fprintf( stderr, "[%s] **W** Failed to open log file: %s\n",
+               TLogger::TimeStamp( stamp ), fspc );
+    }
+  }
 }
 
 
@@ -113,7 +531,8 @@ char* TLogger::TimeStamp( char* buffer ) {
  */
 // ---------------------------------------------------------------------------------------
 TLogger::TLogger( void ) : console_level(0), write_level(0), logfile_name(0),
-			   abort_level(0), abort_handler(0), flag(false) {
+			   abort_level(0), abort_handler(0), flag(false),
+                           async(0) {
   // -------------------------------------------------------------------------------------
   console_level  = TLogger::INFO;
   write_level    = TLogger::WARN;
@@ -121,6 +540,7 @@ TLogger::TLogger( void ) : console_level(0), write_level(0), logfile_name(0),
   abort_level    = TLogger::CRITICAL;
   abort_handler  = TLogger::DEFAULT_ABORT_HANDLER;
   flag           = true;
+  async          = static_cast<TLoggerAsync*>(0);
 }
 
 // =======================================================================================
@@ -137,8 +557,13 @@ TLogger::~TLogger( void ) {
   abort_handler  = TLogger::DEFAULT_ABORT_HANDLER;
   flag           = false;
 
+  if ( static_cast<TLoggerAsync*>(0) != async ) {
+    delete async;
+  }
+  async = static_cast<TLoggerAsync*>(0);
+
   if ( static_cast<char*>(0) != logfile_name ) {
-    delete logfile_name;
+    delete[] logfile_name;
   }
   logfile_name = static_cast<char*>(0);
 }
@@ -201,6 +626,43 @@ void TLogger::off( void ) {
 }
 
 
+// =======================================================================================
+/** @brief Format a log line.
+ *  @param buffer destination buffer.
+ *  @param n      size of the destination buffer.
+ *  @param tstamp formatted time stamp.
+ *  @param code   single character severity code.
+ *  @param fmt    printf style format string.
+ *  @param list   variable parameters.
+ *  @param extra  extra text (may be null).
+ *
+ *  Format a complete, newline terminated, log line. The line is truncated to fit.
+ */
+// ---------------------------------------------------------------------------------------
+void TLogger::format_line( char* buffer, size_t n, const char* tstamp, char code,
+                           const char* fmt, va_list list, const char* extra ) {
+  // -------------------------------------------------------------------------------------
+  size_t k = 0;
+  int    m = snprintf( buffer, n, "[%s] **%c** ", tstamp, code );
+  if ( 0 < m ) { k += static_cast<size_t>(m); }
+  if ( k > n-1 ) { k = n-1; }
+
+  m = vsnprintf( buffer+k, n-k, fmt, list );
+  if ( 0 < m ) { k += static_cast<size_t>(m); }
+  if ( k > n-1 ) { k = n-1; }
+
+  if ( static_cast<const char*>(0) != extra ) {
+    m = snprintf( buffer+k, n-k, " ( %s )", extra );
+    if ( 0 < m ) { k += static_cast<size_t>(m); }
+    if ( k > n-1 ) { k = n-1; }
+  }
+
+  if ( k >= n-1 ) { k = n-2; }
+  buffer[k]   = '\n';
+  buffer[k+1] = '\0';
+}
+
+
 // =======================================================================================
 /** @brief Generate message.
  *  @param level message severity level.
@@ -213,34 +675,61 @@ void TLogger::message( int level, char* extra ) {
   // -------------------------------------------------------------------------------------
   if ( flag ) {
     static const char* stamp = "UCEWID";
-    static char        header[512];
+    char               tbuf[96];
+    char               header[TLOGGER_RECORD_SIZE];
+
+    const bool to_con  = ( level <= console_level );
+    const bool to_file = ( ( static_cast<char*>(0) != logfile_name ) && ( level <= write_level ) );
+
+    // ----- asynchronous: hand the record to the writer ---------------------------------
+
+    if ( ( static_cast<TLoggerAsync*>(0) != async ) && ( level > abort_level ) ) {
+      if ( to_con || to_file ) {
+        TLoggerRing::record* rec = async->acquire();
+        if ( static_cast<TLoggerRing::record*>(0) != rec ) {
+          if ( static_cast<char*>(0) == extra ) {
+            snprintf( rec->text, TLOGGER_RECORD_SIZE, "[%s] **%c**\n",
+                      TLogger::TimeStamp( tbuf ), stamp[level%6] );
+          } else {
+            snprintf( rec->text, TLOGGER_RECORD_SIZE, "[%s] **%c** ( %s )\n",
+                      TLogger::TimeStamp( tbuf ), stamp[level%6], extra );
+          }
+          rec->dest = ( to_con ? TLOGGER_TO_CONSOLE : 0 ) | ( to_file ? TLOGGER_TO_FILE : 0 );
+          rec->fn   = static_cast<TLogger::render_t>(0);
+          async->commit();
+        }
+      }
+      return;
+    }
+
+    if ( static_cast<TLoggerAsync*>(0) != async ) { async->flush(); }
 
     if ( static_cast<char*>(0) == extra ) {
-      sprintf( header, "[%s] **%c**", TLogger::TimeStamp(), stamp[level%6] );
+      snprintf( header, TLOGGER_RECORD_SIZE, "[%s] **%c**",
+                TLogger::TimeStamp( tbuf ), stamp[level%6] );
     } else {
-      sprintf( header, "[%s] **%c** ( %s )", TLogger::TimeStamp(), stamp[level%6], extra );
+      snprintf( header, TLOGGER_RECORD_SIZE, "[%s] **%c** ( %s )",
+                TLogger::TimeStamp( tbuf ), stamp[level%6], extra );
     }
 
     // ----- console display (stderr) ----------------------------------------------------
 
-    if (level <= console_level) {
+    if ( to_con ) {
       fprintf( stderr, "%s\n", header );
       fflush(stderr);
     }
 
     // ----- log to a file ---------------------------------------------------------------
 
-    if ( static_cast<char*>(0) != logfile_name ) {
-      if (level <= write_level) {
-	FILE* fp = fopen( logfile_name, "a" );
-	if (static_cast<FILE*>(0) == fp) {
-	  fprintf( stderr, "[%s]: **W** Failed to open log file: %s\n",
-		   header, logfile_name );
-	} else {
-	  fprintf( fp, "%s\n", header );
-	  fflush(fp);
-	  fclose(fp);
-	}
+    if ( to_file ) {
+      FILE* fp = fopen( logfile_name, "a" );
+      if (static_cast<FILE*>(0) == fp) {
+        fprintf( stderr, "[%s]: **W** Failed to open log file: %s\n",
+                 header, logfile_name );
+      } else {
+        fprintf( fp, "%s\n", header );
+        fflush(fp);
+        fclose(fp);
       }
     }
 
@@ -260,47 +749,61 @@ void TLogger::message( int level, char* extra ) {
  *  @param list variable parameters.
  *  @param extra extra text.
  *
- *  Generate a log message. Format the message using printf formating.
+ *  Generate a log message. Format the message using printf formating. In asynchronous
+ *  mode messages below the abort level are formatted into the calling thread's ring and
+ *  written by the background writer; an abort level message flushes the rings first and
+ *  is written synchronously before the abort handler is called.
  */
 // ---------------------------------------------------------------------------------------
 void TLogger::message( int level, const char* fmt, va_list list, char* extra ) {
   // -------------------------------------------------------------------------------------
   if ( flag ) {
     static const char* stamp = "UCEWID";
-    static char        header[512];
+    char               tbuf[96];
+    char               line[TLOGGER_RECORD_SIZE*4];
+
+    const bool to_con  = ( level <= console_level );
+    const bool to_file = ( ( static_cast<char*>(0) != logfile_name ) && ( level <= write_level ) );
+
+    // ----- asynchronous: hand the record to the writer ---------------------------------
+
+    if ( ( static_cast<TLoggerAsync*>(0) != async ) && ( level > abort_level ) ) {
+      if ( to_con || to_file ) {
+        TLoggerRing::record* rec = async->acquire();
+        if ( static_cast<TLoggerRing::record*>(0) != rec ) {
+          format_line( rec->text, TLOGGER_RECORD_SIZE, TLogger::TimeStamp( tbuf ),
+                       stamp[level%6], fmt, list, extra );
+          rec->dest = ( to_con ? TLOGGER_TO_CONSOLE : 0 ) | ( to_file ? TLOGGER_TO_FILE : 0 );
+          rec->fn   = static_cast<TLogger::render_t>(0);
+          async->commit();
+        }
+      }
+      return;
+    }
 
-    sprintf( header, "[%s] **%c**", TLogger::TimeStamp(), stamp[level%6] );
+    if ( static_cast<TLoggerAsync*>(0) != async ) { async->flush(); }
+
+    format_line( line, sizeof(line), TLogger::TimeStamp( tbuf ),
+                 stamp[level%6], fmt, list, extra );
 
     // ----- console display (stderr) ----------------------------------------------------
 
-    if (level <= console_level) {
-      fprintf( stderr, "%s ", header );
-      vfprintf( stderr, fmt, list );
-      if ( static_cast<char*>(0) != extra ) {
-        fprintf( stderr, " ( %s )", extra );
-      }
-      fprintf( stderr, "\n" );
+    if ( to_con ) {
+      fputs( line, stderr );
       fflush(stderr);
     }
 
     // ----- log to a file ---------------------------------------------------------------
 
-    if ( static_cast<char*>(0) != logfile_name ) {
-      if (level <= write_level) {
-	FILE* fp = fopen( logfile_name, "a" );
-	if (static_cast<FILE*>(0) == fp) {
-	  fprintf( stderr, "[%s]: **W** Failed to open log file: %s\n",
-		   header, logfile_name );
-	} else {
-	  fprintf( fp, "%s ", header );
-	  vfprintf( fp, fmt, list );
-          if ( static_cast<char*>(0) != extra ) {
-            fprintf( fp, " ( %s )", extra );
-          }        
-	  fprintf( fp, "\n" );
-	  fflush(fp);
-	  fclose(fp);
-	}
+    if ( to_file ) {
+      FILE* fp = fopen( logfile_name, "a" );
+      if (static_cast<FILE*>(0) == fp) {
+        fprintf( stderr, "[%s]: **W** Failed to open log file: %s\n",
+                 tbuf, logfile_name );
+      } else {
+        fputs( line, fp );
+        fflush(fp);
+        fclose(fp);
       }
     }
 
@@ -410,8 +913,8 @@ void TLogger::debug( const char* fmt, ... ) {
 // ---------------------------------------------------------------------------------------
 char* TLogger::format_location( int line, const char* file, const char* func ) {
   // -------------------------------------------------------------------------------------
-  static char buffer[1024];
-  sprintf( buffer, "%s %s:%d", func, file, line);
+  static thread_local char buffer[1024];
+  snprintf( buffer, sizeof(buffer), "%s %s:%d", func, file, line);
   return buffer;
 }
 
@@ -678,10 +1181,193 @@ void TLogger::setLogfile( const char* fspc, int new_level ) {
 
   copy( logfile_name, fspc );
 
+  if ( static_cast<TLoggerAsync*>(0) != async ) { async->reopen( logfile_name ); }
+
   if ( 0 < new_level ) { setWriteLevel( new_level ); }
 }
 
 
+// =======================================================================================
+/** @brief Set asynchronous mode.
+ *  @param enable       true to start the background writer, false to stop it.
+ *  @param ring_records number of records in each per thread ring (rounded up to a power
+ *                      of two).
+ *  @return true if an error occured.
+ *
+ *  In asynchronous mode each logging thread formats its messages into its own lock free
+ *  ring and a background thread writes them in batches to a log file that stays open.
+ *  When a ring is full the message is dropped and counted (see dropped()). Messages at or
+ *  above the abort level flush the rings and are written synchronously. Disabling the
+ *  mode writes everything still pending and closes the file. On error the current mode
+ *  is left unchanged. Changing the mode must not race with other threads that are
+ *  logging.
+ */
+// ---------------------------------------------------------------------------------------
+bool TLogger::setAsync( bool enable, int32_t ring_records ) {
+  // -------------------------------------------------------------------------------------
+  static bool exit_hook = false;
+
+  if ( enable && ( 2 > ring_records ) ) {
+    fprintf( stderr, "TLogger::setAsync: ring must hold at least 2 records, got %d\n",
+             ring_records );
+    return true;
+  }
+
+  if ( static_cast<TLoggerAsync*>(0) != async ) {
+    delete async;
+    async = static_cast<TLoggerAsync*>(0);
+  }
+
+  if ( enable ) {
+    async = new TLoggerAsync( static_cast<u_int64_t>( ring_records ), logfile_name );
+    if ( ! exit_hook ) {
+      atexit( TLogger::exitFlush );
+      exit_hook = true;
+    }
+  }
+
+  return false;
+}
+
+
+// =======================================================================================
+/** @brief Exit flush.
+ *
+ *  Registered with atexit the first time asynchronous mode is enabled, so that records
+ *  still in the rings are not lost when the program ends without delInstance. Nothing
+ *  is done, and no instance is created, if delInstance has already run.
+ */
+// ---------------------------------------------------------------------------------------
+void TLogger::exitFlush( void ) {
+  // -------------------------------------------------------------------------------------
+  if ( static_cast<TLogger*>(0) != TLogger::theInstance ) {
+    TLogger::theInstance->flush();
+  }
+}
+
+
+// =======================================================================================
+/** @brief Is asynchronous.
+ *  @return true if the background writer is running.
+ */
+// ---------------------------------------------------------------------------------------
+bool TLogger::isAsync( void ) const {
+  // -------------------------------------------------------------------------------------
+  return ( static_cast<TLoggerAsync*>(0) != async );
+}
+
+
+// =======================================================================================
+/** @brief Flush.
+ *
+ *  Write every message logged so far. Does nothing in synchronous mode.
+ */
+// ---------------------------------------------------------------------------------------
+void TLogger::flush( void ) {
+  // -------------------------------------------------------------------------------------
+  if ( static_cast<TLoggerAsync*>(0) != async ) { async->flush(); }
+}
+
+
+// =======================================================================================
+/** @brief Dropped.
+ *  @return number of messages dropped because a ring was full.
+ */
+// ---------------------------------------------------------------------------------------
+u_int64_t TLogger::dropped( void ) const {
+  // -------------------------------------------------------------------------------------
+  if ( static_cast<TLoggerAsync*>(0) != async ) { return async->dropped(); }
+  return 0;
+}
+
+
+// =======================================================================================
+/** @brief Format into a buffer.
+ *  @param buffer destination buffer.
+ *  @param n      size of the destination buffer.
+ *  @param fmt    printf style format string.
+ *  @param ...    variable parameters.
+ *  @return number of characters written (excluding the terminator), clipped to n-1.
+ */
+// ---------------------------------------------------------------------------------------
+int32_t TLogger::vformat( char* buffer, size_t n, const char* fmt, ... ) {
+  // -------------------------------------------------------------------------------------
+  va_list ap;
+  va_start( ap, fmt );
+  int m = vsnprintf( buffer, n, fmt, ap );
+  va_end( ap );
+  if ( 0 > m ) { buffer[0] = '\0'; return 0; }
+  if ( static_cast<size_t>(m) >= n ) { m = static_cast<int>(n) - 1; }
+  return static_cast<int32_t>( m );
+}
+
+
+// =======================================================================================
+/** @brief Log with location.
+ *  @param level message severity level.
+ *  @param line  source code line number      (__LINE__)
+ *  @param file  name of the source code file (__FILE__)
+ *  @param func  name of the calling function (__PRETTY_FUNCTION__)
+ *  @param fmt   printf style format string.
+ *  @param ...   variable parameters.
+ *
+ *  Immediate formatting path for deferred() when a binary record can not be used.
+ */
+// ---------------------------------------------------------------------------------------
+void TLogger::log( int level, int line, const char* file, const char* func,
+                   const char* fmt, ... ) {
+  // -------------------------------------------------------------------------------------
+  va_list  ap;
+  va_start(ap, fmt);
+  message(level, fmt, ap, format_location(line, file, func) );
+  va_end(ap);
+}
+
+
+// =======================================================================================
+/** @brief Begin a deferred record.
+ *  @param level message severity level.
+ *  @param fn    renderer for the payload.
+ *  @return pointer to the payload area (DEFERRED_BYTES long), or null if the message is
+ *          filtered or the ring is full.
+ *
+ *  The caller fills the payload and publishes it with defer_end().
+ */
+// ---------------------------------------------------------------------------------------
+void* TLogger::defer_begin( int level, render_t fn ) {
+  // -------------------------------------------------------------------------------------
+  static const char* stamp = "UCEWID";
+
+  const bool to_con  = ( level <= console_level );
+  const bool to_file = ( ( static_cast<char*>(0) != logfile_name ) && ( level <= write_level ) );
+
+  if ( flag && ( to_con || to_file ) ) {
+    TLoggerRing::record* rec = async->acquire();
+    if ( static_cast<TLoggerRing::record*>(0) != rec ) {
+      rec->dest = ( to_con ? TLOGGER_TO_CONSOLE : 0 ) | ( to_file ? TLOGGER_TO_FILE : 0 );
+      rec->code = stamp[level%6];
+      rec->when = time( static_cast<time_t*>(0) );
+      rec->fn   = fn;
+      return static_cast<void*>( rec->text );
+    }
+  }
+
+  return static_cast<void*>(0);
+}
+
+
+// =======================================================================================
+/** @brief End a deferred record.
+ *
+ *  Publish the record started by defer_begin().
+ */
+// ---------------------------------------------------------------------------------------
+void TLogger::defer_end( void ) {
+  // -------------------------------------------------------------------------------------
+  async->commit();
+}
+
+
 // =======================================================================================
 // **                                   T L O G G E R                                   **
 // ======================================================================== END FILE =====
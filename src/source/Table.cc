@@ -36,12 +36,108 @@
 
 #include <Table.hh>
 #include <FileTool.hh>
+#include <ParseTool.hh>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
-#define INIT_VAR(a) data(a), nsamp(a), nvar(a), nalloc(a)
+#define INIT_VAR(a) data(a), nsamp(a), nvar(a), nalloc(a), mbase(a), mbytes(a)
 
 TLOGGER_REFERENCE( Table, logger );
 
 
+namespace {
+
+const char      TABLE_MAGIC[8]   = { 'T', 'R', 'N', 'T', 'A', 'B', 'L', 'E' };
+const u_int32_t TABLE_ENDIAN     = 0x01020304;
+const u_int32_t TABLE_SWAPPED    = 0x04030201;
+const u_int32_t TABLE_VERSION    = 1;
+const u_int32_t TABLE_ALIGN      = 64;
+
+
+// =======================================================================================
+/** @brief Binary Table header.
+ *  @see Table.hh for the layout.
+ */
+// ---------------------------------------------------------------------------------------
+struct table_header {
+  char      magic[8];   ///< TABLE_MAGIC
+  u_int32_t endian;     ///< TABLE_ENDIAN in the producer's byte order
+  u_int32_t version;    ///< format version
+  u_int32_t elem_size;  ///< bytes per element
+  u_int32_t align;      ///< alignment of the data block
+  int64_t   nsamp;      ///< number of samples
+  int64_t   nvar;       ///< number of variables
+  u_int64_t offset;     ///< byte offset of the data block
+  u_int8_t  reserved[16];
+};
+
+static_assert( 64 == sizeof(table_header), "binary Table header must be 64 bytes" );
+
+
+// =======================================================================================
+/** @brief Byte swap.
+ *  @param[in,out] p pointer to an object of N bytes.
+ */
+// ---------------------------------------------------------------------------------------
+template<size_t N>
+inline void swap_bytes( void* p ) {
+  // -------------------------------------------------------------------------------------
+  u_int8_t* b = static_cast<u_int8_t*>( p );
+  for ( size_t i=0; i<N/2; i++ ) {
+    const u_int8_t t = b[i];  b[i] = b[N-1-i];  b[N-1-i] = t;
+  }
+}
+
+
+// =======================================================================================
+/** @brief Check header.
+ *  @param[in,out] H      header as read from the file.
+ *  @param[out]    swap   true if the file was written with the other byte order.
+ *  @param[in]     nbytes size of the file in bytes, or zero if unknown.
+ *  @return null on success, otherwise a description of the problem.
+ *
+ *  Converts the header fields to the native byte order.
+ */
+// ---------------------------------------------------------------------------------------
+const char* check_header( table_header& H, bool& swap, const u_int64_t nbytes ) {
+  // -------------------------------------------------------------------------------------
+  if ( 0 != memcmp( H.magic, TABLE_MAGIC, 8 ) ) { return "not a binary Table"; }
+
+  if ( TABLE_ENDIAN == H.endian ) {
+    swap = false;
+  } else if ( TABLE_SWAPPED == H.endian ) {
+    swap = true;
+    swap_bytes<4>( &H.version );
+    swap_bytes<4>( &H.elem_size );
+    swap_bytes<4>( &H.align );
+    swap_bytes<8>( &H.nsamp );
+    swap_bytes<8>( &H.nvar );
+    swap_bytes<8>( &H.offset );
+  } else {
+    return "unrecognized endian tag";
+  }
+
+  if ( TABLE_VERSION   != H.version   ) { return "unsupported version"; }
+  if ( sizeof(real8_t) != H.elem_size ) { return "unsupported element size"; }
+  if ( ( 0 > H.nsamp ) || ( 0 > H.nvar ) ) { return "negative shape"; }
+  if ( ( 0 < H.nvar ) && ( H.nsamp > ( 0x7FFFFFFF / H.nvar ) ) ) { return "too large"; }
+  if ( ( sizeof(table_header) > H.offset ) || ( 0 != ( H.offset % sizeof(real8_t) ) ) ) {
+    return "misaligned data block";
+  }
+  if ( 0 < nbytes ) {
+    const u_int64_t need = H.offset + static_cast<u_int64_t>( H.nsamp * H.nvar ) *
+        sizeof(real8_t);
+    if ( nbytes < need ) { return "truncated"; }
+  }
+  return static_cast<const char*>(0);
+}
+
+} // end namespace
+
+
 // =======================================================================================
 /** @brief Resize.
  *  @param[in] ns number of samples   (row).
@@ -53,7 +149,7 @@ TLOGGER_REFERENCE( Table, logger );
 void Table::resize( const int32_t ns, const int32_t nv ) {
   // -------------------------------------------------------------------------------------
   int32_t new_alloc = ns * nv;
-  if ( new_alloc > nalloc ) {
+  if ( ( new_alloc > nalloc ) || ( isMapped() && ( ( ns != nsamp ) || ( nv != nvar ) ) ) ) {
     destroy();
     data = new real8_t[ new_alloc ];
     nalloc = new_alloc;
@@ -66,14 +162,19 @@ void Table::resize( const int32_t ns, const int32_t nv ) {
 // =======================================================================================
 /** @brief Destroy.
  *
- *  Deallocatedata buffer.
+ *  Deallocatedata buffer, or release the file mapping.
  */
 // ---------------------------------------------------------------------------------------
 void Table::destroy( void ) {
   // -------------------------------------------------------------------------------------
-  if ( static_cast<real8_t*>(0) != data ) {
+  if ( isMapped() ) {
+    munmap( mbase, mbytes );
+  } else if ( static_cast<real8_t*>(0) != data ) {
     delete[] data;
   }
+  data   = static_cast<real8_t*>(0);
+  mbase  = static_cast<void*>(0);
+  mbytes = 0;
   nsamp  = 0;
   nvar   = 0;
   nalloc = 0;
@@ -262,24 +363,46 @@ bool Table::write_ascii( std::ostream& outf, const std::string sfmt ) {
 // =======================================================================================
 /** @brief Read ASCII.
  *  @param[in] fspc file specification for the source of this Table.
- *  @param[in] 
- *  @return 
+ *  @return true if an error ocurred.
+ *
+ *  The file is mapped and parsed in parallel with ParseTool; the layout is the one
+ *  written by write_ascii.
  */
 // ---------------------------------------------------------------------------------------
 bool Table::read_ascii( const std::string fspc ) {
   // -------------------------------------------------------------------------------------
-  int istat;
-  std::ifstream inf = FileTool::openRead( fspc, &istat );
+  ParseTool::Buffer buf( fspc );
 
-  if ( 0 != istat ) {
-    logger->error( "Cannot open %s for reading.", fspc );
+  if ( buf.bad() ) {
+    logger->error( "Cannot open %s for reading.", fspc.c_str() );
     return true;
   }
 
-  bool rv = read_ascii( inf );
-  
-  inf.close();
-  return rv;
+  int64_t     ns = 0;
+  int64_t     nv = 0;
+  const char* p  = ParseTool::int64( ParseTool::skip( buf.begin(), buf.end() ), buf.end(), ns );
+  if ( static_cast<const char*>(0) != p ) {
+    p = ParseTool::int64( ParseTool::skip( p, buf.end() ), buf.end(), nv );
+  }
+  if ( ( static_cast<const char*>(0) == p ) || ( 0 > ns ) || ( 0 > nv ) ) {
+    logger->error( "%s does not begin with a Table size.", fspc.c_str() );
+    return true;
+  }
+  if ( ( 0x7FFFFFFF < ns ) || ( 0x7FFFFFFF < nv ) ||
+       ( ( 0 < nv ) && ( ns > ( 0x7FFFFFFF / nv ) ) ) ) {
+    logger->error( "%s: a %ld x %ld Table is too large.", fspc.c_str(), ns, nv );
+    return true;
+  }
+
+  resize( static_cast<int32_t>( ns ), static_cast<int32_t>( nv ) );
+
+  const int64_t n = ParseTool::values( p, buf.end(), data, ns, nv, 1, ns );
+  if ( n != ns*nv ) {
+    logger->error( "%s: expected %ld values, parsed %ld.", fspc.c_str(), ns*nv, n );
+    return true;
+  }
+
+  return false;
 }
 
 
@@ -314,6 +437,195 @@ bool Table::write_ascii( const std::string fspc, const std::string sfmt ) {
 
 
 
+// =======================================================================================
+/** @brief Read Binary.
+ *  @param[in] inf reference to an input stream positioned at a binary Table header.
+ *  @return true if an error ocurred.
+ *
+ *  Copy a binary Table into this one. Files written with the other byte order are
+ *  converted.
+ */
+// ---------------------------------------------------------------------------------------
+bool Table::read_binary( std::istream& inf ) {
+  // -------------------------------------------------------------------------------------
+  table_header H;
+  bool         swap = false;
+
+  if ( ! inf.read( reinterpret_cast<char*>( &H ), sizeof(H) ) ) {
+    logger->error( "Binary Table header could not be read." );
+    return true;
+  }
+
+  const char* msg = check_header( H, swap, 0 );
+  if ( static_cast<const char*>(0) != msg ) {
+    logger->error( "Binary Table: %s.", msg );
+    return true;
+  }
+
+  inf.ignore( static_cast<std::streamsize>( H.offset - sizeof(H) ) );
+
+  resize( static_cast<int32_t>( H.nsamp ), static_cast<int32_t>( H.nvar ) );
+  const size_t n = static_cast<size_t>( nsamp ) * static_cast<size_t>( nvar );
+
+  if ( ! inf.read( reinterpret_cast<char*>( data ),
+                   static_cast<std::streamsize>( n * sizeof(real8_t) ) ) ) {
+    logger->error( "Binary Table: truncated." );
+    return true;
+  }
+
+  if ( swap ) {
+    for ( size_t i=0; i<n; i++ ) { swap_bytes<8>( data + i ); }
+  }
+
+  return false;
+}
+
+
+// =======================================================================================
+/** @brief Write Binary.
+ *  @param[in] outf reference to an output stream.
+ *  @return true if an error ocurred.
+ *
+ *  Write the header and the columns in native byte order. The data block starts
+ *  TABLE_ALIGN bytes into the file, so a mapping of the file has aligned columns.
+ */
+// ---------------------------------------------------------------------------------------
+bool Table::write_binary( std::ostream& outf ) const {
+  // -------------------------------------------------------------------------------------
+  table_header H;
+  memset( &H, 0, sizeof(H) );
+  memcpy( H.magic, TABLE_MAGIC, 8 );
+  H.endian    = TABLE_ENDIAN;
+  H.version   = TABLE_VERSION;
+  H.elem_size = sizeof(real8_t);
+  H.align     = TABLE_ALIGN;
+  H.nsamp     = nsamp;
+  H.nvar      = nvar;
+  H.offset    = TABLE_ALIGN;
+
+  outf.write( reinterpret_cast<const char*>( &H ), sizeof(H) );
+
+  const size_t n = static_cast<size_t>( nsamp ) * static_cast<size_t>( nvar );
+  outf.write( reinterpret_cast<const char*>( data ),
+              static_cast<std::streamsize>( n * sizeof(real8_t) ) );
+
+  if ( ! outf.good() ) {
+    logger->error( "Binary Table could not be written." );
+    return true;
+  }
+  return false;
+}
+
+
+// =======================================================================================
+/** @brief Read Binary.
+ *  @param[in] fspc file specification for the source of this Table.
+ *  @return true if an error ocurred.
+ */
+// ---------------------------------------------------------------------------------------
+bool Table::read_binary( const std::string fspc ) {
+  // -------------------------------------------------------------------------------------
+  std::ifstream inf( fspc.c_str(), std::ios::in | std::ios::binary );
+
+  if ( ! inf.good() ) {
+    logger->error( "Cannot open %s for reading.", fspc.c_str() );
+    return true;
+  }
+
+  bool rv = read_binary( inf );
+
+  inf.close();
+  return rv;
+}
+
+
+// =======================================================================================
+/** @brief Write Binary.
+ *  @param[in] fspc file specification for the destination of this Table.
+ *  @return true if an error ocurred.
+ */
+// ---------------------------------------------------------------------------------------
+bool Table::write_binary( const std::string fspc ) const {
+  // -------------------------------------------------------------------------------------
+  std::ofstream outf( fspc.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+
+  if ( ! outf.good() ) {
+    logger->error( "Cannot open %s for writing.", fspc.c_str() );
+    return true;
+  }
+
+  bool rv = write_binary( outf );
+
+  outf.close();
+  return rv;
+}
+
+
+// =======================================================================================
+/** @brief Map.
+ *  @param[in] fspc     file specification of a binary Table.
+ *  @param[in] writable if true, changes to this Table are written back to the file.
+ *  @return true if an error ocurred.
+ *
+ *  Make this Table a view of the file without copying it. Pages are loaded on demand.
+ *  A read only view is mapped copy-on-write, so modifying the Table is still legal but
+ *  never touches the file. Resizing to a different shape detaches the view.
+ *  Files written with the other byte order can not be mapped; use read_binary.
+ */
+// ---------------------------------------------------------------------------------------
+bool Table::map( const std::string fspc, const bool writable ) {
+  // -------------------------------------------------------------------------------------
+  const int fd = open( fspc.c_str(), writable ? O_RDWR : O_RDONLY );
+  if ( 0 > fd ) {
+    logger->error( "Cannot open %s for mapping.", fspc.c_str() );
+    return true;
+  }
+
+  struct stat st;
+  if ( ( 0 != fstat( fd, &st ) ) ||
+       ( static_cast<off_t>( sizeof(table_header) ) > st.st_size ) ) {
+    close( fd );
+    logger->error( "Binary Table %s: too short.", fspc.c_str() );
+    return true;
+  }
+
+  const size_t nbytes = static_cast<size_t>( st.st_size );
+  void* base = mmap( static_cast<void*>(0), nbytes, PROT_READ | PROT_WRITE,
+                     writable ? MAP_SHARED : MAP_PRIVATE, fd, 0 );
+  close( fd );
+
+  if ( MAP_FAILED == base ) {
+    logger->error( "Cannot map %s.", fspc.c_str() );
+    return true;
+  }
+
+  table_header H;
+  bool         swap = false;
+  memcpy( &H, base, sizeof(H) );
+
+  const char* msg = check_header( H, swap, nbytes );
+  if ( ( static_cast<const char*>(0) == msg ) && swap ) {
+    msg = "foreign byte order, use read_binary";
+  }
+  if ( static_cast<const char*>(0) != msg ) {
+    munmap( base, nbytes );
+    logger->error( "Binary Table %s: %s.", fspc.c_str(), msg );
+    return true;
+  }
+
+  destroy();
+  mbase  = base;
+  mbytes = nbytes;
+  data   = reinterpret_cast<real8_t*>( static_cast<char*>( base ) + H.offset );
+  nsamp  = static_cast<int32_t>( H.nsamp );
+  nvar   = static_cast<int32_t>( H.nvar );
+  nalloc = nsamp * nvar;
+
+  return false;
+}
+
+
+
 
 // =======================================================================================
 /** @brief Sum.
@@ -0,0 +1,265 @@
+// ====================================================================== BEGIN FILE =====
+// **                                T H R E A D P O O L                                **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Work stealing thread pool.
+ *  @file   ThreadPool.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18.
+ *
+ *  Provides the methods for a work stealing task scheduler built on SThread.
+ */
+// =======================================================================================
+
+#include <ThreadPool.hh>
+
+
+/** @brief Worker index of the calling thread within its pool (-1 outside any pool). */
+static thread_local int32_t     __tp_index = -1;
+/** @brief Pool that owns the calling thread (null outside any pool). */
+static thread_local ThreadPool* __tp_owner = static_cast<ThreadPool*>(0);
+
+
+// =======================================================================================
+/** @brief Constructor.
+ *  @param n number of workers (0 = hardware concurrency).
+ *
+ *  Create the workers and start them.
+ */
+// ---------------------------------------------------------------------------------------
+ThreadPool::ThreadPool( int32_t n ) : worker(), n_work(n), queued(0), deal(0),
+                                      stopping(false), idle_mtx(), idle_cv() {
+  // -------------------------------------------------------------------------------------
+  if ( 1 > n_work ) {
+    n_work = static_cast<int32_t>( std::thread::hardware_concurrency() );
+    if ( 1 > n_work ) { n_work = 1; }
+  }
+
+  worker.resize( static_cast<size_t>( n_work ) );
+  for ( int32_t i=0; i<n_work; i++ ) {
+    worker[static_cast<size_t>(i)] = new Worker( this, i );
+  }
+  for ( int32_t i=0; i<n_work; i++ ) {
+    worker[static_cast<size_t>(i)]->start();
+  }
+}
+
+
+// =======================================================================================
+/** @brief Destructor.
+ *
+ *  Let the workers finish every queued task, then join them.
+ */
+// ---------------------------------------------------------------------------------------
+ThreadPool::~ThreadPool( void ) {
+  // -------------------------------------------------------------------------------------
+  {
+    std::lock_guard<std::mutex> lk( idle_mtx );
+    stopping.store( true );
+  }
+  idle_cv.notify_all();
+
+  for ( int32_t i=0; i<n_work; i++ ) {
+    worker[static_cast<size_t>(i)]->join();
+    delete worker[static_cast<size_t>(i)];
+  }
+}
+
+
+// =======================================================================================
+/** @brief Global pool.
+ *  @return pointer to a process wide pool sized to the hardware concurrency.
+ *
+ *  Shared by library code so that independent parallel sections reuse one set of
+ *  workers.
+ */
+// ---------------------------------------------------------------------------------------
+ThreadPool* ThreadPool::global( void ) {
+  // -------------------------------------------------------------------------------------
+  static ThreadPool the_pool( 0 );
+  return &the_pool;
+}
+
+
+// =======================================================================================
+/** @brief Grain.
+ *  @param n     number of indices.
+ *  @param grain requested grain (0 = automatic).
+ *  @return the number of indices per task.
+ */
+// ---------------------------------------------------------------------------------------
+int64_t ThreadPool::grain_for( int64_t n, int64_t grain ) const {
+  // -------------------------------------------------------------------------------------
+  if ( 0 < grain ) { return grain; }
+  const int64_t target = 4 * static_cast<int64_t>( n_work );
+  const int64_t g      = ( n + target - 1 ) / target;
+  return ( 0 < g ) ? g : 1;
+}
+
+
+// =======================================================================================
+/** @brief Push a task.
+ *  @param task unit of work.
+ *
+ *  A worker pushes onto the back of its own deque, any other thread deals the task round
+ *  robin onto the worker deques. One sleeping worker is woken.
+ */
+// ---------------------------------------------------------------------------------------
+void ThreadPool::push( task_t task ) {
+  // -------------------------------------------------------------------------------------
+  int32_t target = __tp_index;
+  if ( this != __tp_owner ) {
+    target = static_cast<int32_t>( deal.fetch_add( 1 ) % static_cast<u_int32_t>( n_work ) );
+  }
+
+  Worker* W = worker[static_cast<size_t>(target)];
+  W->guard.lock();
+  W->tasks.push_back( task );
+  W->guard.unlock();
+
+  queued.fetch_add( 1 );
+
+  {
+    std::lock_guard<std::mutex> lk( idle_mtx );
+  }
+  idle_cv.notify_one();
+}
+
+
+// =======================================================================================
+/** @brief Take a task.
+ *  @param self index of the calling worker (-1 if the caller is not a worker).
+ *  @param task returned unit of work.
+ *  @return true if a task was found.
+ *
+ *  Pop from the back of our own deque, otherwise steal from the front of another.
+ */
+// ---------------------------------------------------------------------------------------
+bool ThreadPool::take( int32_t self, task_t& task ) {
+  // -------------------------------------------------------------------------------------
+  if ( 0 == queued.load() ) { return false; }
+
+  if ( 0 <= self ) {
+    Worker* W = worker[static_cast<size_t>(self)];
+    W->guard.lock();
+    if ( ! W->tasks.empty() ) {
+      task = W->tasks.back();
+      W->tasks.pop_back();
+      W->guard.unlock();
+      queued.fetch_sub( 1 );
+      return true;
+    }
+    W->guard.unlock();
+  }
+
+  const int32_t start = ( 0 <= self ) ? ( self + 1 ) : 0;
+  for ( int32_t k=0; k<n_work; k++ ) {
+    const int32_t v = ( start + k ) % n_work;
+    if ( v == self ) { continue; }
+    Worker* V = worker[static_cast<size_t>(v)];
+    if ( V->guard.trylock() ) {
+      if ( ! V->tasks.empty() ) {
+        task = V->tasks.front();
+        V->tasks.pop_front();
+        V->guard.unlock();
+        queued.fetch_sub( 1 );
+        return true;
+      }
+      V->guard.unlock();
+    }
+  }
+
+  return false;
+}
+
+
+// =======================================================================================
+/** @brief Complete a chunk.
+ *  @param remaining counter of outstanding chunks.
+ */
+// ---------------------------------------------------------------------------------------
+void ThreadPool::complete( std::atomic<int64_t>* remaining ) {
+  // -------------------------------------------------------------------------------------
+  remaining->fetch_sub( 1 );
+}
+
+
+// =======================================================================================
+/** @brief Help until done.
+ *  @param remaining counter of outstanding chunks.
+ *
+ *  Execute pool tasks in the calling thread until remaining reaches zero.
+ */
+// ---------------------------------------------------------------------------------------
+void ThreadPool::help_until( std::atomic<int64_t>& remaining ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t self = ( this == __tp_owner ) ? __tp_index : -1;
+  task_t        task;
+
+  while ( 0 < remaining.load() ) {
+    if ( take( self, task ) ) {
+      task();
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+
+// =======================================================================================
+/** @brief Worker loop.
+ *
+ *  Execute tasks until the pool is stopping and every deque is empty.
+ */
+// ---------------------------------------------------------------------------------------
+void ThreadPool::Worker::run( void ) {
+  // -------------------------------------------------------------------------------------
+  __tp_owner = pool;
+  __tp_index = index;
+
+  task_t task;
+  for (;;) {
+    if ( pool->take( index, task ) ) {
+      task();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lk( pool->idle_mtx );
+    if ( pool->stopping.load() && ( 0 == pool->queued.load() ) ) {
+      break;
+    }
+    if ( 0 == pool->queued.load() ) {
+      pool->idle_cv.wait_for( lk, std::chrono::milliseconds( 10 ) );
+    }
+  }
+
+  __tp_owner = static_cast<ThreadPool*>(0);
+  __tp_index = -1;
+}
+
+
+// =======================================================================================
+// **                                T H R E A D P O O L                                **
+// ======================================================================== END FILE =====
@@ -0,0 +1,519 @@
+// ====================================================================== BEGIN FILE =====
+// **                                     O R R E Y                                     **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Model of the Solar System.
+ *  @file   Orrey.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides the methods for a Model of the Solar System.
+ */
+// =======================================================================================
+
+
+#include <astro/Orrey.hh>
+#include <ThreadPool.hh>
+#include <cmath>
+
+
+namespace {
+
+
+const real8_t AU        = 1.495978707e11;      ///< astronomical unit (m)
+const real8_t J2000     = 2451545.0;           ///< Julian date of J2000.0
+const real8_t CENTURY   = 36525.0;             ///< days per Julian century
+const real8_t DAY       = 86400.0;             ///< seconds per day
+const real8_t RAD       = 1.745329251994329577e-2;  ///< radians per degree
+
+
+// =======================================================================================
+/** @brief Mean Keplerian elements and their rates per Julian century.
+ *
+ *  a (AU), e, I (deg), L (deg), long. peri. (deg), long. node (deg). Standish, JPL,
+ *  Table 1, mean ecliptic and equinox of J2000, 1800 AD - 2050 AD.
+ */
+// ---------------------------------------------------------------------------------------
+const real8_t ELEMENTS[ Orrey::NUM_BODY ][ 12 ] = {
+  {  0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+  {  0.38709927,  0.00000037,  0.20563593,  0.00001906,  7.00497902, -0.00594749,
+     252.25032350, 149472.67411175,   77.45779628,  0.16047689,  48.33076593, -0.12534081 },
+  {  0.72333566,  0.00000390,  0.00677672, -0.00004107,  3.39467605, -0.00078890,
+     181.97909950,  58517.81538729,  131.60246718,  0.00268329,  76.67984255, -0.27769418 },
+  {  1.00000261,  0.00000562,  0.01671123, -0.00004392, -0.00001531, -0.01294668,
+     100.46457166,  35999.37244981,  102.93768193,  0.32327364,   0.0,         0.0        },
+  {  1.52371034,  0.00001847,  0.09339410,  0.00007882,  1.84969142, -0.00813131,
+     -4.55343205,  19140.30268499,  -23.94362959,  0.44441088,  49.55953891, -0.29257343 },
+  {  5.20288700, -0.00011607,  0.04838624, -0.00013253,  1.30439695, -0.00183714,
+     34.39644051,   3034.74612775,   14.72847983,  0.21252668, 100.47390909,  0.20469106 },
+  {  9.53667594, -0.00125060,  0.05386179, -0.00050991,  2.48599187,  0.00193609,
+     49.95424423,   1222.49362201,   92.59887831, -0.41897216, 113.66242448, -0.28867794 },
+  { 19.18916464, -0.00196176,  0.04725744, -0.00004397,  0.77263783, -0.00242939,
+     313.23810451,   428.48202785,  170.95427630,  0.40805281,  74.01692503,  0.04240589 },
+  { 30.06992276,  0.00026291,  0.00859048,  0.00005105,  1.77004347,  0.00035372,
+     -55.12002969,   218.45945325,   44.96476227, -0.32241464, 131.78422574, -0.00508664 },
+  { 39.48211675, -0.00031596,  0.24882730,  0.00005170, 17.14001206,  0.00004818,
+     238.92903833,   145.20780515,  224.06891629, -0.04062942, 110.30393684, -0.01183482 } };
+
+
+/** Gravitational parameter G*M (m^3/s^2). */
+const real8_t GM[ Orrey::NUM_BODY ] = {
+  1.32712440018e20, 2.2032e13, 3.24859e14, 3.986004418e14, 4.282837e13,
+  1.26686534e17, 3.7931187e16, 5.793939e15, 6.836529e15, 8.71e11 };
+
+/** Equatorial radius (m). */
+const real8_t RADIUS[ Orrey::NUM_BODY ] = {
+  6.957e8, 2.4397e6, 6.0518e6, 6.3781e6, 3.3962e6,
+  7.1492e7, 6.0268e7, 2.5559e7, 2.4764e7, 1.188e6 };
+
+/** Length of a Chebyshev segment (days), roughly a constant fraction of the period. */
+const real8_t SPAN[ Orrey::NUM_BODY ] = {
+  0.0, 8.0, 16.0, 16.0, 32.0, 64.0, 128.0, 256.0, 256.0, 256.0 };
+
+
+// =======================================================================================
+/** @brief Evaluate.
+ *  @param[out] state  position and velocity.
+ *  @param[in]  C      coefficients for x, y and z [3][NUM_COEF].
+ *  @param[in]  tau    normalized time in the segment [-1,1].
+ *  @param[in]  dtau   derivative of tau with respect to time (1/s).
+ *
+ *  Position from the Chebyshev series and velocity from its derivative, both from
+ *  one pass of the T_k and T'_k recurrences.
+ */
+// ---------------------------------------------------------------------------------------
+inline void evaluate( real8_t* state, const real8_t* C,
+                      const real8_t tau, const real8_t dtau ) {
+  // -------------------------------------------------------------------------------------
+  const real8_t* Cx = C;
+  const real8_t* Cy = C +   Orrey::NUM_COEF;
+  const real8_t* Cz = C + 2*Orrey::NUM_COEF;
+
+  real8_t t0 = D_ONE, t1 = tau;
+  real8_t d0 = D_ZERO, d1 = D_ONE;
+
+  real8_t x  = Cx[0] + Cx[1]*t1, y  = Cy[0] + Cy[1]*t1, z  = Cz[0] + Cz[1]*t1;
+  real8_t vx = Cx[1],             vy = Cy[1],             vz = Cz[1];
+
+  const real8_t tau2 = tau + tau;
+  for ( int32_t k=2; k<Orrey::NUM_COEF; k++ ) {
+    const real8_t t2 = tau2*t1 - t0;
+    const real8_t d2 = t1 + t1 + tau2*d1 - d0;
+    x  += Cx[k]*t2;   y  += Cy[k]*t2;   z  += Cz[k]*t2;
+    vx += Cx[k]*d2;   vy += Cy[k]*d2;   vz += Cz[k]*d2;
+    t0 = t1;  t1 = t2;
+    d0 = d1;  d1 = d2;
+  }
+
+  state[0] = x;       state[1] = y;       state[2] = z;
+  state[3] = vx*dtau; state[4] = vy*dtau; state[5] = vz*dtau;
+}
+
+
+} // end namespace
+
+
+#define INIT_VAR(_a) jd_epoch(J2000), cache_start(D_ONE), cache_stop(D_ZERO), \
+    num_seg(), seg_span(), coef()
+
+
+// =======================================================================================
+/** @brief Constructor.
+ *
+ *  Construct an Orrey with its epoch at J2000.0 and an empty cache.
+ */
+// ---------------------------------------------------------------------------------------
+Orrey::Orrey( void ) : INIT_VAR(0) {
+  // -------------------------------------------------------------------------------------
+  for ( int32_t i=0; i<NUM_BODY; i++ ) {
+    seg_span[i] = SPAN[i];
+  }
+}
+
+
+// =======================================================================================
+/** @brief Destructor.
+ */
+// ---------------------------------------------------------------------------------------
+Orrey::~Orrey( void ) {
+  // -------------------------------------------------------------------------------------
+  clear();
+}
+
+
+// =======================================================================================
+/** @brief Check.
+ *  @param[in] planet identifier.
+ *  @return true if the planet is not a member of planet_e.
+ */
+// ---------------------------------------------------------------------------------------
+bool Orrey::check( const planet_e planet ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t p = static_cast<int32_t>( planet );
+  return ( ( p < 0 ) || ( p >= NUM_BODY ) );
+}
+
+
+// =======================================================================================
+/** @brief Gravitational Parameter.
+ *  @param[in] planet identifier.
+ *  @return G*M in m^3/s^2 (zero for an unknown planet).
+ */
+// ---------------------------------------------------------------------------------------
+real8_t Orrey::mu( planet_e planet ) {
+  // -------------------------------------------------------------------------------------
+  return check( planet ) ? D_ZERO : GM[ planet ];
+}
+
+
+// =======================================================================================
+/** @brief Radius.
+ *  @param[in] planet identifier.
+ *  @return equatorial radius in meters (zero for an unknown planet).
+ */
+// ---------------------------------------------------------------------------------------
+real8_t Orrey::radius( planet_e planet ) {
+  // -------------------------------------------------------------------------------------
+  return check( planet ) ? D_ZERO : RADIUS[ planet ];
+}
+
+
+// =======================================================================================
+/** @brief Kepler.
+ *  @param[in]  planet identifier.
+ *  @param[in]  jd     Julian date.
+ *  @param[out] state  heliocentric position (m) and velocity (m/s).
+ *  @return 0 on success, 1 for an unknown planet.
+ *
+ *  Evaluate the mean elements at jd, solve Kepler's equation and rotate the orbital
+ *  plane into the ecliptic. The velocity is the time derivative of that model, the
+ *  secular rates of the elements included. This bypasses the cache.
+ */
+// ---------------------------------------------------------------------------------------
+int Orrey::kepler( planet_e planet, const real8_t jd, real8_t* state ) const {
+  // -------------------------------------------------------------------------------------
+  if ( check( planet ) ) { return 1; }
+
+  if ( SUN == planet ) {
+    for ( int32_t i=0; i<STATE_LEN; i++ ) { state[i] = D_ZERO; }
+    return 0;
+  }
+
+  const real8_t* E = ELEMENTS[ planet ];
+  const real8_t  T = ( jd - J2000 ) / CENTURY;
+
+  const real8_t a    = ( E[0]  + E[1]*T ) * AU;
+  const real8_t e    =   E[2]  + E[3]*T;
+  const real8_t inc  = ( E[4]  + E[5]*T ) * RAD;
+  const real8_t L    =   E[6]  + E[7]*T;
+  const real8_t peri =   E[8]  + E[9]*T;
+  const real8_t node = ( E[10] + E[11]*T ) * RAD;
+
+  const real8_t w  = peri*RAD - node;
+  const real8_t M  = std::remainder( L - peri, 360.0 ) * RAD;
+
+  // ----- element rates per second -------------------------
+  const real8_t per   = D_ONE / ( CENTURY * DAY );
+  const real8_t da    = E[1]  * AU  * per;
+  const real8_t de    = E[3]  * per;
+  const real8_t dinc  = E[5]  * RAD * per;
+  const real8_t dM    = ( E[7] - E[9] )  * RAD * per;
+  const real8_t dw    = ( E[9] - E[11] ) * RAD * per;
+  const real8_t dnode = E[11] * RAD * per;
+
+  // ----- solve E - e sin E = M ----------------------------
+  real8_t EA = M + e*std::sin( M );
+  for ( int32_t it=0; it<20; it++ ) {
+    const real8_t dE = ( EA - e*std::sin( EA ) - M ) / ( D_ONE - e*std::cos( EA ) );
+    EA -= dE;
+    if ( std::fabs( dE ) < 1.0e-15 ) { break; }
+  }
+
+  const real8_t sE  = std::sin( EA );
+  const real8_t cE  = std::cos( EA );
+  const real8_t q   = std::sqrt( D_ONE - e*e );
+  const real8_t dq  = -e*de / q;
+  const real8_t dEA = ( dM + de*sE ) / ( D_ONE - e*cE );
+
+  // ----- orbital plane, including the apsidal rotation ----
+  const real8_t xp  =  a * ( cE - e );
+  const real8_t yp  =  a * q * sE;
+  const real8_t vxp =  da * ( cE - e ) - a * ( sE*dEA + de ) - dw*yp;
+  const real8_t vyp =  ( da*q + a*dq ) * sE + a * q * cE * dEA + dw*xp;
+
+  const real8_t cw = std::cos( w ),    sw = std::sin( w );
+  const real8_t cO = std::cos( node ), sO = std::sin( node );
+  const real8_t cI = std::cos( inc ),  sI = std::sin( inc );
+
+  const real8_t r11 =  cw*cO - sw*sO*cI,  r12 = -sw*cO - cw*sO*cI;
+  const real8_t r21 =  cw*sO + sw*cO*cI,  r22 = -sw*sO + cw*cO*cI;
+  const real8_t r31 =  sw*sI,             r32 =  cw*sI;
+
+  const real8_t x = r11*xp + r12*yp;
+  const real8_t y = r21*xp + r22*yp;
+  const real8_t z = r31*xp + r32*yp;
+
+  // ----- nodal regression and change of inclination -------
+  state[0] = x;
+  state[1] = y;
+  state[2] = z;
+  state[3] = r11*vxp + r12*vyp - dnode*y + dinc*sO*z;
+  state[4] = r21*vxp + r22*vyp + dnode*x - dinc*cO*z;
+  state[5] = r31*vxp + r32*vyp + dinc*( cO*y - sO*x );
+
+  return 0;
+}
+
+
+// =======================================================================================
+/** @brief State.
+ *  @param[in]  planet identifier.
+ *  @param[out] state  heliocentric position (m) and velocity (m/s) at the epoch.
+ *  @return 0 on success, 1 for an unknown planet.
+ */
+// ---------------------------------------------------------------------------------------
+int Orrey::state( planet_e planet, real8_t* state ) {
+  // -------------------------------------------------------------------------------------
+  return this->state( planet, jd_epoch, state );
+}
+
+
+// =======================================================================================
+/** @brief State.
+ *  @param[in]  planet identifier.
+ *  @param[in]  jd     Julian date.
+ *  @param[out] state  heliocentric position (m) and velocity (m/s).
+ *  @return 0 on success, 1 for an unknown planet.
+ *
+ *  Dates inside the cache are read from the Chebyshev segments, all others are
+ *  computed from the mean elements.
+ */
+// ---------------------------------------------------------------------------------------
+int Orrey::state( planet_e planet, const real8_t jd, real8_t* state ) const {
+  // -------------------------------------------------------------------------------------
+  if ( check( planet ) ) { return 1; }
+
+  if ( ( SUN == planet ) || ( ! cached( jd ) ) ) {
+    return kepler( planet, jd, state );
+  }
+
+  const real8_t span = seg_span[ planet ];
+  const int32_t ns   = num_seg[ planet ];
+  const real8_t u    = ( jd - cache_start ) / span;
+  int32_t       k    = static_cast<int32_t>( u );
+  if ( k >= ns ) { k = ns - 1; }
+
+  evaluate( state, coef[ planet ].data() + k*3*NUM_COEF,
+            D_TWO*( u - static_cast<real8_t>(k) ) - D_ONE,
+            D_TWO / ( span * DAY ) );
+
+  return 0;
+}
+
+
+// =======================================================================================
+/** @brief State.
+ *  @param[in]  planet identifier.
+ *  @param[in]  jd     array of Julian dates.
+ *  @param[in]  n      number of dates.
+ *  @param[out] states array of states [n][STATE_LEN].
+ *  @return 0 on success, 1 for an unknown planet.
+ *
+ *  Dates inside the cache are evaluated together in a simd loop, the rest fall back
+ *  to the mean elements.
+ */
+// ---------------------------------------------------------------------------------------
+int Orrey::state( planet_e planet, const real8_t* jd, const int32_t n,
+                  real8_t* states ) const {
+  // -------------------------------------------------------------------------------------
+  if ( check( planet ) ) { return 1; }
+
+  if ( SUN == planet ) {
+    for ( int32_t i=0; i<n*STATE_LEN; i++ ) { states[i] = D_ZERO; }
+    return 0;
+  }
+
+  const int32_t  ns    = num_seg[ planet ];
+  const real8_t  span  = seg_span[ planet ];
+  const real8_t  dtau  = D_TWO / ( span * DAY );
+  const real8_t  start = cache_start;
+  const real8_t  last  = static_cast<real8_t>( ns - 1 );
+  const real8_t* C     = coef[ planet ].data();
+
+  const int32_t BLOCK = 64;
+  int32_t off[ BLOCK ];
+  real8_t tau[ BLOCK ];
+
+  for ( int32_t b=0; b<n; b+=BLOCK ) {
+    const int32_t m = ( ( n - b ) < BLOCK ) ? ( n - b ) : BLOCK;
+    const real8_t* T = jd + b;
+    real8_t*       S = states + b*STATE_LEN;
+
+    // ----- locate segments; out of range dates are clamped and redone below
+    for ( int32_t i=0; i<m; i++ ) {
+      const real8_t u = ( T[i] - start ) / span;
+      const real8_t c = ( u > D_ZERO ) ? ( ( u < last ) ? u : last ) : D_ZERO;   // NaN to 0
+      const int32_t k = static_cast<int32_t>( c );
+      tau[i] = D_TWO*( u - static_cast<real8_t>(k) ) - D_ONE;
+      off[i] = k*3*NUM_COEF;
+    }
+
+    if ( 0 < ns ) {
+#pragma omp simd
+      for ( int32_t i=0; i<m; i++ ) {
+        const real8_t* Cx = C + off[i];
+        const real8_t* Cy = Cx + NUM_COEF;
+        const real8_t* Cz = Cy + NUM_COEF;
+        const real8_t  t  = tau[i];
+        const real8_t  t2x = t + t;
+        real8_t t0 = D_ONE, t1 = t, d0 = D_ZERO, d1 = D_ONE;
+        real8_t x  = Cx[0] + Cx[1]*t, y  = Cy[0] + Cy[1]*t, z  = Cz[0] + Cz[1]*t;
+        real8_t vx = Cx[1],           vy = Cy[1],           vz = Cz[1];
+        for ( int32_t k=2; k<NUM_COEF; k++ ) {
+          const real8_t tk = t2x*t1 - t0;
+          const real8_t dk = t1 + t1 + t2x*d1 - d0;
+          x  += Cx[k]*tk;   y  += Cy[k]*tk;   z  += Cz[k]*tk;
+          vx += Cx[k]*dk;   vy += Cy[k]*dk;   vz += Cz[k]*dk;
+          t0 = t1;  t1 = tk;
+          d0 = d1;  d1 = dk;
+        }
+        real8_t* s = S + i*STATE_LEN;
+        s[0] = x;       s[1] = y;       s[2] = z;
+        s[3] = vx*dtau; s[4] = vy*dtau; s[5] = vz*dtau;
+      }
+    }
+
+    for ( int32_t i=0; i<m; i++ ) {
+      if ( ! cached( T[i] ) ) {
+        kepler( planet, T[i], S + i*STATE_LEN );
+      }
+    }
+  }
+
+  return 0;
+}
+
+
+// =======================================================================================
+/** @brief Fit Segments.
+ *  @param[in] planet identifier.
+ *
+ *  Interpolate x, y and z at the NUM_COEF Chebyshev nodes of each segment of the
+ *  cache and convert the samples to coefficients with a discrete cosine transform.
+ */
+// ---------------------------------------------------------------------------------------
+void Orrey::fitSegments( const planet_e planet ) {
+  // -------------------------------------------------------------------------------------
+  const real8_t span = seg_span[ planet ];
+  const int32_t ns   = static_cast<int32_t>( std::ceil( ( cache_stop - cache_start ) / span ) );
+  const int32_t nc   = NUM_COEF;
+
+  num_seg[ planet ] = ( ns < 1 ) ? 1 : ns;
+  coef[ planet ].assign( static_cast<size_t>( num_seg[ planet ]*3*nc ), D_ZERO );
+
+  real8_t node[ NUM_COEF ];
+  real8_t cosk[ NUM_COEF*NUM_COEF ];
+  for ( int32_t j=0; j<nc; j++ ) {
+    node[j] = std::cos( D_PI * ( static_cast<real8_t>(j) + D_HALF ) / nc );
+    for ( int32_t k=0; k<nc; k++ ) {
+      cosk[ k*nc + j ] = std::cos( D_PI * static_cast<real8_t>(k) *
+                                   ( static_cast<real8_t>(j) + D_HALF ) / nc );
+    }
+  }
+
+  real8_t*      C     = coef[ planet ].data();
+  const real8_t start = cache_start;
+
+  ThreadPool::global()->parallel_for
+      ( 0, num_seg[ planet ], [&]( const int64_t s0, const int64_t s1 ) {
+        real8_t sample[ 3*NUM_COEF ];
+        real8_t st[ STATE_LEN ];
+        for ( int32_t s=static_cast<int32_t>(s0); s<static_cast<int32_t>(s1); s++ ) {
+          const real8_t mid = start + span*( static_cast<real8_t>(s) + D_HALF );
+          for ( int32_t j=0; j<nc; j++ ) {
+            kepler( planet, mid + D_HALF*span*node[j], st );
+            sample[j] = st[0];  sample[nc+j] = st[1];  sample[2*nc+j] = st[2];
+          }
+          real8_t* cs = C + s*3*nc;
+          for ( int32_t c=0; c<3; c++ ) {
+            for ( int32_t k=0; k<nc; k++ ) {
+              real8_t sum = D_ZERO;
+              for ( int32_t j=0; j<nc; j++ ) {
+                sum += sample[ c*nc + j ] * cosk[ k*nc + j ];
+              }
+              cs[ c*nc + k ] = ( ( 0 == k ) ? D_ONE : D_TWO ) * sum / nc;
+            }
+          }
+        }
+      }, 16 );
+}
+
+
+// =======================================================================================
+/** @brief Cache.
+ *  @param[in] jd0 first Julian date.
+ *  @param[in] jd1 last  Julian date.
+ *  @return true on error.
+ *
+ *  Precompute the Chebyshev segments of every planet over [jd0, jd1]. Any previous
+ *  cache is replaced.
+ */
+// ---------------------------------------------------------------------------------------
+bool Orrey::cache( const real8_t jd0, const real8_t jd1 ) {
+  // -------------------------------------------------------------------------------------
+  clear();
+  if ( !( jd1 > jd0 ) ) { return true; }
+
+  cache_start = jd0;
+  cache_stop  = jd1;
+
+  for ( int32_t i=1; i<NUM_BODY; i++ ) {
+    fitSegments( static_cast<planet_e>( i ) );
+  }
+
+  return false;
+}
+
+
+// =======================================================================================
+/** @brief Clear.
+ *
+ *  Release the Chebyshev cache. All states are then computed from the mean elements.
+ */
+// ---------------------------------------------------------------------------------------
+void Orrey::clear( void ) {
+  // -------------------------------------------------------------------------------------
+  cache_start = D_ONE;
+  cache_stop  = D_ZERO;
+  for ( int32_t i=0; i<NUM_BODY; i++ ) {
+    num_seg[i] = 0;
+    coef[i].clear();
+  }
+}
+
+
+// =======================================================================================
+// **                                     O R R E Y                                     **
+// ======================================================================== END FILE =====
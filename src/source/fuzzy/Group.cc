@@ -37,6 +37,7 @@
 
 
 #include <fuzzy/Group.hh>
+#include <fuzzy/Kernel.hh>
 
 
 namespace fuzzy {
@@ -236,6 +237,22 @@ void Group::fuzzify( real8_t* mu, real8_t* x  ) {
 }
 
 
+// =======================================================================================
+/** @brief Fuzzify.
+ *  @param[out] mu table of memberships (samples x nOut). Resized if necessary.
+ *  @param[in]  x  table of crisp inputs (samples x nIn).
+ *
+ *  Compile the Group into a Kernel and fuzzify every sample. Callers that fuzzify many
+ *  tables with the same Group should keep their own Kernel.
+ */
+// ---------------------------------------------------------------------------------------
+void Group::fuzzify( Table& mu, const Table& x ) {
+  // -------------------------------------------------------------------------------------
+  Kernel K( *this );
+  K.fuzzify( mu, x );
+}
+
+
 // =======================================================================================
 // ---------------------------------------------------------------------------------------
 void Group::defuzzify( real8_t* x,  real8_t* mu ) {
@@ -249,6 +266,22 @@ void Group::defuzzify( real8_t* x,  real8_t* mu ) {
 }
 
 
+// =======================================================================================
+/** @brief Defuzzify.
+ *  @param[out] x  table of crisp values (samples x nIn). Resized if necessary.
+ *  @param[in]  mu table of memberships (samples x nOut).
+ *
+ *  Compile the Group into a Kernel and defuzzify every sample. Callers that defuzzify
+ *  many tables with the same Group should keep their own Kernel.
+ */
+// ---------------------------------------------------------------------------------------
+void Group::defuzzify( Table& x, const Table& mu ) {
+  // -------------------------------------------------------------------------------------
+  Kernel K( *this );
+  K.defuzzify( x, mu );
+}
+
+
 // =======================================================================================
 // ---------------------------------------------------------------------------------------
 real8_t* Group::load( real8_t* src ) {
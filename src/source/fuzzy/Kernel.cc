@@ -0,0 +1,400 @@
+// ====================================================================== BEGIN FILE =====
+// **                             F U Z Z Y : : K E R N E L                             **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Compiled fuzzy group.
+ *  @file   fuzzy/Kernel.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides the methods for a compiled fuzzy group.
+ */
+// =======================================================================================
+
+
+#include <fuzzy/Kernel.hh>
+#include <ThreadPool.hh>
+#include <algorithm>
+
+
+namespace fuzzy {
+
+
+TLOGGER_REFERENCE( Kernel, logger );
+
+
+#define INIT_VAR(_a) num_in(_a), num_out(_a), first(), scale(), kind(), \
+    left(), center(), right(), poly()
+
+
+// =======================================================================================
+/** @brief Constructor.
+ *
+ *  Construct an empty Kernel.
+ */
+// ---------------------------------------------------------------------------------------
+Kernel::Kernel( void ) : INIT_VAR(0) {
+  // -------------------------------------------------------------------------------------
+  first.push_back( 0 );
+}
+
+
+// =======================================================================================
+/** @brief Constructor.
+ *  @param[in] G reference to a fuzzy Group.
+ */
+// ---------------------------------------------------------------------------------------
+Kernel::Kernel( Group& G ) : INIT_VAR(0) {
+  // -------------------------------------------------------------------------------------
+  compile( G );
+}
+
+
+// =======================================================================================
+/** @brief Destructor.
+ */
+// ---------------------------------------------------------------------------------------
+Kernel::~Kernel( void ) {
+  // -------------------------------------------------------------------------------------
+}
+
+
+// =======================================================================================
+/** @brief Compile.
+ *  @param[in] G reference to a fuzzy Group.
+ *
+ *  Copy the breakpoints of every set in the Group. The first set of a partition with
+ *  more than one set is a LeftTrapezoid, the last a RightTrapezoid and the rest are
+ *  Triangles. A partition with a single set is one Triangle.
+ */
+// ---------------------------------------------------------------------------------------
+void Kernel::compile( Group& G ) {
+  // -------------------------------------------------------------------------------------
+  num_in  = G.nIn();
+  num_out = 0;
+
+  first.assign( 1, 0 );
+  scale.clear();
+  kind.clear();
+  left.clear();
+  center.clear();
+  right.clear();
+  poly.clear();
+
+  for ( int32_t i=0; i<num_in; i++ ) {
+    Partition& P = G.get( i );
+    const int32_t n = P.nOut();
+
+    for ( int32_t j=0; j<n; j++ ) {
+      Set& S = P.get( j );
+      const int32_t k = ( 1 == n ) ? TRIANGLE :
+          ( ( 0 == j ) ? LEFT : ( ( n-1 == j ) ? RIGHT : TRIANGLE ) );
+      kind.push_back( k );
+      left.push_back(   ( LEFT  == k ) ? S.getCenter() : S.getLeft()  );
+      center.push_back( S.getCenter() );
+      right.push_back(  ( RIGHT == k ) ? S.getCenter() : S.getRight() );
+    }
+
+    const real8_t* c = P.coefficients();
+    poly.insert( poly.end(), c, c + Partition::NUM_COEF*n );
+
+    real8_t s = D_ZERO;
+    if ( 1 < n ) {
+      const real8_t w = P.getCenter( n-1 ) - P.getCenter( 0 );
+      if ( w > D_ZERO ) { s = static_cast<real8_t>( n-1 ) / w; }
+    }
+    scale.push_back( s );
+
+    num_out += n;
+    first.push_back( num_out );
+  }
+}
+
+
+// =======================================================================================
+/** @brief Active Sets.
+ *  @param[in]  i  index of the input.
+ *  @param[in]  x  crisp value of the ith input.
+ *  @param[out] m0 degree of membership in set k.
+ *  @param[out] m1 degree of membership in set k+1.
+ *  @return k the index, within the partition, of the first of the two sets that can be
+ *          non-zero.
+ *
+ *  Every other set of the partition has zero membership. For a partition with more than
+ *  one set k is in [0,n-2]. For a single set k is zero and m1 is zero.
+ *
+ *  The centers c are ordered, so k satisfies c[k] <= x < c[k+1]. It is guessed from
+ *  the mean spacing and confirmed, with a binary search when the guess is wrong.
+ */
+// ---------------------------------------------------------------------------------------
+int32_t Kernel::active( const int32_t i, const real8_t x, real8_t& m0, real8_t& m1 ) const {
+  // -------------------------------------------------------------------------------------
+  const int32_t  j0 = first[ static_cast<size_t>(i) ];
+  const int32_t  n  = first[ static_cast<size_t>(i+1) ] - j0;
+  const real8_t* c  = center.data() + j0;
+
+  m1 = D_ZERO;
+
+  if ( 2 > n ) {
+    const real8_t L = left[ static_cast<size_t>(j0) ];
+    const real8_t R = right[ static_cast<size_t>(j0) ];
+    m0 = D_ZERO;
+    if ( x < c[0] ) {
+      if ( x > L ) { m0 = ( x - L ) / ( c[0] - L ); }
+    } else if ( x > c[0] ) {
+      if ( x < R ) { m0 = ( R - x ) / ( R - c[0] ); }
+    } else {
+      m0 = D_ONE;
+    }
+    return 0;
+  }
+
+  if ( !( x > c[0] ) ) {
+    m0 = D_ONE;
+    return 0;
+  }
+
+  if ( !( x < c[n-1] ) ) {
+    m0 = D_ZERO;
+    m1 = D_ONE;
+    return n-2;
+  }
+
+  int32_t k = static_cast<int32_t>( ( x - c[0] ) * scale[ static_cast<size_t>(i) ] );
+  if ( k > n-2 ) { k = n-2; }
+  if ( ( x < c[k] ) || ( x >= c[k+1] ) ) {
+    k = static_cast<int32_t>( std::upper_bound( c+1, c+n-1, x ) - ( c+1 ) );
+  }
+
+  const real8_t w = c[k+1] - c[k];
+  m0 = ( c[k+1] - x ) / w;
+  m1 = ( x - c[k] ) / w;
+  return k;
+}
+
+
+// =======================================================================================
+/** @brief Membership.
+ *  @param[out] degree membership in each set of the ith partition.
+ *  @param[in]  i      index of the input.
+ *  @param[in]  x      crisp value of the ith input.
+ *
+ *  Same result as Partition::mu.
+ */
+// ---------------------------------------------------------------------------------------
+void Kernel::mu( real8_t* degree, const int32_t i, const real8_t x ) const {
+  // -------------------------------------------------------------------------------------
+  const int32_t n = nSet( i );
+  for ( int32_t j=0; j<n; j++ ) {
+    degree[j] = D_ZERO;
+  }
+
+  real8_t m0 = D_ZERO;
+  real8_t m1 = D_ZERO;
+  const int32_t k = active( i, x, m0, m1 );
+  degree[k] = m0;
+  if ( k+1 < n ) { degree[k+1] = m1; }
+}
+
+
+// =======================================================================================
+/** @brief Fuzzify.
+ *  @param[out] mu degree of membership in each set of each partition.
+ *  @param[in]  x  crisp value of each input.
+ *
+ *  Same result as Group::fuzzify.
+ */
+// ---------------------------------------------------------------------------------------
+void Kernel::fuzzify( real8_t* mu, const real8_t* x ) const {
+  // -------------------------------------------------------------------------------------
+  for ( int32_t i=0; i<num_in; i++ ) {
+    this->mu( mu + first[ static_cast<size_t>(i) ], i, x[i] );
+  }
+}
+
+
+// =======================================================================================
+/** @brief Fuzzify.
+ *  @param[out] mu table of memberships (samples x nOut). Resized if necessary.
+ *  @param[in]  x  table of crisp inputs (samples x nIn).
+ *
+ *  Each set is evaluated for a block of samples at a time with the closed form
+ *  max(0,min(rise,fall)), which is exact for ordered centers and has no branches. Every
+ *  output is written, so the cost is already proportional to the size of mu.
+ */
+// ---------------------------------------------------------------------------------------
+void Kernel::fuzzify( Table& mu, const Table& x ) const {
+  // -------------------------------------------------------------------------------------
+  const int32_t ns = x.size(0);
+
+  if ( x.size(1) != num_in ) {
+    logger->error( "fuzzy::Kernel::fuzzify: table has %d inputs, expected %d",
+                   x.size(1), num_in );
+    return;
+  }
+
+  mu.resize( ns, num_out );
+
+  ThreadPool::global()->parallel_for( 0, ns, [this, &mu, &x]( int64_t s0, int64_t s1 ) {
+    const int32_t nb = static_cast<int32_t>( s1 - s0 );
+    for ( int32_t i=0; i<num_in; i++ ) {
+      const real8_t* __restrict__ X = x.col( i ) + s0;
+      for ( int32_t j=first[ static_cast<size_t>(i) ];
+            j<first[ static_cast<size_t>(i+1) ]; j++ ) {
+        const size_t   sj = static_cast<size_t>(j);
+        const real8_t  L  = left[sj];
+        const real8_t  C  = center[sj];
+        const real8_t  R  = right[sj];
+        real8_t* __restrict__ Y = mu.col( j ) + s0;
+
+        switch( kind[sj] ) {
+          case LEFT: {
+#pragma omp simd
+            for ( int32_t s=0; s<nb; s++ ) {
+              real8_t f = ( R - X[s] ) / ( R - C );
+              f    = ( f < D_ONE  ) ? f : D_ONE;
+              Y[s] = ( f > D_ZERO ) ? f : D_ZERO;
+            }
+          } break;
+
+          case RIGHT: {
+#pragma omp simd
+            for ( int32_t s=0; s<nb; s++ ) {
+              real8_t r = ( X[s] - L ) / ( C - L );
+              r    = ( r < D_ONE  ) ? r : D_ONE;
+              Y[s] = ( r > D_ZERO ) ? r : D_ZERO;
+            }
+          } break;
+
+          default: {
+#pragma omp simd
+            for ( int32_t s=0; s<nb; s++ ) {
+              const real8_t r = ( X[s] - L ) / ( C - L );
+              const real8_t f = ( R - X[s] ) / ( R - C );
+              const real8_t m = ( r < f ) ? r : f;
+              Y[s] = ( m > D_ZERO ) ? m : D_ZERO;
+            }
+          } break;
+        }
+      }
+    }
+  }, 2048 );
+}
+
+
+// =======================================================================================
+/** @brief Defuzzify.
+ *  @param[out] x  crisp value of each input.
+ *  @param[in]  mu degree of membership in each set of each partition.
+ *
+ *  Same result as Group::defuzzify to within rounding. The sums start at D_EPSILON, as
+ *  in Partition::coa, so a vector of zero memberships gives one.
+ */
+// ---------------------------------------------------------------------------------------
+void Kernel::defuzzify( real8_t* x, const real8_t* mu ) const {
+  // -------------------------------------------------------------------------------------
+  const int32_t NC = Partition::NUM_COEF;
+  for ( int32_t i=0; i<num_in; i++ ) {
+    real8_t sumA = D_EPSILON;
+    real8_t sumM = D_EPSILON;
+    for ( int32_t j=first[ static_cast<size_t>(i) ];
+          j<first[ static_cast<size_t>(i+1) ]; j++ ) {
+      const real8_t* c = poly.data() + NC*j;
+      const real8_t  d = mu[j];
+      sumA += d * ( c[0] + c[1]*d );
+      sumM += d * ( c[2] + d*( c[3] + c[4]*d ) );
+    }
+    x[i] = sumM / sumA;
+  }
+}
+
+
+// =======================================================================================
+/** @brief Defuzzify.
+ *  @param[out] x  table of crisp values (samples x nIn). Resized if necessary.
+ *  @param[in]  mu table of memberships (samples x nOut).
+ *
+ *  Samples are processed in tiles. For each set the area and moment polynomials are
+ *  accumulated over the whole tile, then one division gives the center of area.
+ */
+// ---------------------------------------------------------------------------------------
+void Kernel::defuzzify( Table& x, const Table& mu ) const {
+  // -------------------------------------------------------------------------------------
+  const int32_t ns = mu.size(0);
+
+  if ( mu.size(1) != num_out ) {
+    logger->error( "fuzzy::Kernel::defuzzify: table has %d memberships, expected %d",
+                   mu.size(1), num_out );
+    return;
+  }
+
+  x.resize( ns, num_in );
+
+  ThreadPool::global()->parallel_for( 0, ns, [this, &x, &mu]( int64_t s0, int64_t s1 ) {
+    const int32_t NC   = Partition::NUM_COEF;
+    const int32_t TILE = 256;
+    real8_t A[TILE];
+    real8_t M[TILE];
+
+    for ( int64_t t0=s0; t0<s1; t0+=TILE ) {
+      const int32_t nb = static_cast<int32_t>( ( s1-t0 < TILE ) ? ( s1-t0 ) : TILE );
+      for ( int32_t i=0; i<num_in; i++ ) {
+        for ( int32_t s=0; s<nb; s++ ) {
+          A[s] = D_EPSILON;
+          M[s] = D_EPSILON;
+        }
+        for ( int32_t j=first[ static_cast<size_t>(i) ];
+              j<first[ static_cast<size_t>(i+1) ]; j++ ) {
+          const real8_t* c  = poly.data() + NC*j;
+          const real8_t  a1 = c[0];
+          const real8_t  a2 = c[1];
+          const real8_t  m1 = c[2];
+          const real8_t  m2 = c[3];
+          const real8_t  m3 = c[4];
+          const real8_t* __restrict__ D = mu.col( j ) + t0;
+#pragma omp simd
+          for ( int32_t s=0; s<nb; s++ ) {
+            const real8_t d = D[s];
+            A[s] += d * ( a1 + a2*d );
+            M[s] += d * ( m1 + d*( m2 + m3*d ) );
+          }
+        }
+        real8_t* __restrict__ X = x.col( i ) + t0;
+#pragma omp simd
+        for ( int32_t s=0; s<nb; s++ ) {
+          X[s] = M[s] / A[s];
+        }
+      }
+    }
+  }, 2048 );
+}
+
+
+}; // end namespace fuzzy
+
+
+// =======================================================================================
+// **                             F U Z Z Y : : K E R N E L                             **
+// ======================================================================== END FILE =====
@@ -56,8 +56,10 @@ namespace fuzzy {
 
 TLOGGER_REFERENCE( Partition, logger );
 
+const int32_t Partition::NUM_COEF;
 
-#define INIT_VAR(_a) fset(_a), num_set(_a), min_ctr(_a), max_ctr(_a)
+
+#define INIT_VAR(_a) fset(_a), num_set(_a), min_ctr(_a), max_ctr(_a), poly(_a)
 
 
 // =======================================================================================
@@ -166,6 +168,11 @@ void Partition::destroy( void ) {
     delete[] fset;
   }
 
+  if ( static_cast<real8_t*>(0) != poly ) {
+    delete[] poly;
+  }
+
+  poly    = static_cast<real8_t*>(0);
   fset    = static_cast<Set**>(0);
   num_set =  0;
   min_ctr = -D_ZERO;
@@ -192,13 +199,14 @@ bool Partition::resize( const int32_t n ) {
   }
 
   if ( n == num_set ) {
-    logger->debug( "Resize called with no change" );
+    TLOG_DEBUG( logger, "Resize called with no change" );
     return false;
   }
 
   destroy();
 
   fset    = new Set*[n];
+  poly    = new real8_t[ NUM_COEF*n ];
   num_set = n;
 
   switch( n ) {
@@ -207,25 +215,25 @@ bool Partition::resize( const int32_t n ) {
     } break;
 
     case 1: { // ----- special case n=1 -----------------------------------
-      logger->debug( "resize n=1" );
+      TLOG_DEBUG( logger, "resize n=1" );
       fset[0] = new TriangleSet();
     } break;
 
     case 2: { // ----- special case n=2 -----------------------------------
-      logger->debug( "resize n=2" );
+      TLOG_DEBUG( logger, "resize n=2" );
       fset[0] = new LeftTrapezoidSet();
       fset[1] = new RightTrapezoidSet();	
     } break;
 
     case 3: { // ----- special case n=3 -----------------------------------
-      logger->debug( "resize n=3" );
+      TLOG_DEBUG( logger, "resize n=3" );
       fset[0] = new LeftTrapezoidSet();
       fset[1] = new TriangleSet();
       fset[2] = new RightTrapezoidSet();	
     } break;
 
     default: { // ----- general case n>3 -----------------------------------
-      logger->debug( "resize n=%d", n );
+      TLOG_DEBUG( logger, "resize n=%d", n );
       fset[0] = new LeftTrapezoidSet();
       for ( int32_t i=1; i<n-1; i++ ) {
         fset[i] = new TriangleSet();
@@ -319,6 +327,67 @@ real8_t Partition::getCenter( const int32_t idx ) const {
 
 
 
+// =======================================================================================
+/** @brief Coefficients.
+ *  @return pointer to NUM_COEF coefficients for each set.
+ *
+ *  For set j and degree of membership d the coefficients c = poly + NUM_COEF*j give
+ *
+ *    area(d)       = d * ( c[0] + c[1]*d )
+ *    area(d)*coa(d) = d * ( c[2] + d*( c[3] + c[4]*d ) )
+ *
+ *  which are the closed forms of Set::area and Set::area*Set::coa. They are refreshed
+ *  whenever the sets are placed by balance() or set(ctrs), and so after load() and read().
+ */
+// ---------------------------------------------------------------------------------------
+const real8_t* Partition::coefficients( void ) const {
+  // -------------------------------------------------------------------------------------
+  return poly;
+}
+
+
+// =======================================================================================
+/** @brief Tabulate.
+ *
+ *  Compute the area and moment coefficients of every set from its breakpoints. The
+ *  first set of a partition with more than one set is a LeftTrapezoid, the last a
+ *  RightTrapezoid and the rest are Triangles. A single set is a Triangle.
+ */
+// ---------------------------------------------------------------------------------------
+void Partition::tabulate( void ) {
+  // -------------------------------------------------------------------------------------
+  for ( int32_t j=0; j<num_set; j++ ) {
+    const real8_t L = fset[j]->getLeft();
+    const real8_t C = fset[j]->getCenter();
+    const real8_t R = fset[j]->getRight();
+    real8_t*      c = poly + NUM_COEF*j;
+
+    if ( ( 1 < num_set ) && ( 0 == j ) ) {              // ----- left trapezoid -----
+      const real8_t W = R - C;
+      c[0] =  1.5e0 * W;
+      c[1] = -D_HALF * W;
+      c[2] =  3.75e-1 * W * ( D_THREE*C + R );
+      c[3] = -D_HALF * W * R;
+      c[4] =  W * W / 6.0e0;
+    } else if ( ( 1 < num_set ) && ( num_set-1 == j ) ) { // ----- right trapezoid ----
+      const real8_t W = C - L;
+      c[0] =  1.5e0 * W;
+      c[1] = -D_HALF * W;
+      c[2] =  3.75e-1 * W * ( D_THREE*C + L );
+      c[3] = -D_HALF * W * L;
+      c[4] = -W * W / 6.0e0;
+    } else {                                            // ----- triangle ------------
+      const real8_t W = R - L;
+      c[0] =  W;
+      c[1] = -D_HALF * W;
+      c[2] =  D_HALF * W * ( L + R );
+      c[3] = -D_HALF * W * ( R - C + L );
+      c[4] =  W * ( R - D_TWO*C + L ) / 6.0e0;
+    }
+  }
+}
+
+
 // =======================================================================================
 /** @brief Balance Centers.
  *
@@ -372,6 +441,8 @@ void Partition::balance( void ) {
       fset[num_set-1]->set( L, C );
     } break;
   }
+
+  tabulate();
 }
 
 
@@ -485,6 +556,8 @@ void Partition::set( real8_t* ctrs ) {
       fset[num_set-1]->set( ctrs[num_set-2], ctrs[num_set-1] );
     } break;
   }
+
+  tabulate();
 }
 
 
@@ -0,0 +1,496 @@
+// ====================================================================== BEGIN FILE =====
+// **                           F U Z Z Y : : R U L E B A S E                           **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Fuzzy rule base.
+ *  @file   fuzzy/RuleBase.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides the methods for a fuzzy rule base.
+ */
+// =======================================================================================
+
+
+#include <fuzzy/RuleBase.hh>
+#include <ThreadPool.hh>
+#include <cmath>
+#include <vector>
+
+
+namespace fuzzy {
+
+
+TLOGGER_REFERENCE( RuleBase, logger );
+
+
+#define INIT_VAR(_m) mode(_m), input(), output(), num_in(0), num_out(0), num_rule(0), \
+    stride(), conseq(), coef(), failed(true)
+
+
+namespace {
+
+// =======================================================================================
+/** @brief Visit the active rules.
+ *  @param[in] K    compiled antecedent.
+ *  @param[in] S    rule index stride of each input.
+ *  @param[in] x    crisp inputs.
+ *  @param[in] tmin true for the minimum t-norm, false for the product.
+ *  @param[in] f    called with (rule index, firing strength) for every rule that fires.
+ *
+ *  Each input contributes one or two sets with non-zero membership. The rules that fire
+ *  are every combination of those sets, enumerated with an odometer.
+ */
+// ---------------------------------------------------------------------------------------
+template<class F>
+void visit( const Kernel& K, const std::vector<int32_t>& S, const real8_t* x,
+            const bool tmin, F f ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t m = K.nIn();
+  if ( ( 1 > m ) || ( S.size() < static_cast<size_t>( m ) ) ) { return; }
+
+  // fixed buffers cover any practical number of inputs, the heap covers the rest
+  const int32_t MAX_IN = 32;
+  int32_t ifix[ 4*MAX_IN ];
+  real8_t wfix[ 2*MAX_IN ];
+  std::vector<int32_t> iheap;
+  std::vector<real8_t> wheap;
+  int32_t* off = ifix;
+  real8_t* w   = wfix;
+  if ( m > MAX_IN ) {
+    iheap.resize( 4*static_cast<size_t>( m ) );
+    wheap.resize( 2*static_cast<size_t>( m ) );
+    off = iheap.data();
+    w   = wheap.data();
+  }
+  int32_t* cnt = off + 2*m;
+  int32_t* pos = cnt + m;
+
+  for ( int32_t i=0; i<m; i++ ) {
+    real8_t m0 = D_ZERO;
+    real8_t m1 = D_ZERO;
+    const int32_t k = K.active( i, x[i], m0, m1 );
+    const int32_t s = S[ static_cast<size_t>(i) ];
+    int32_t c = 0;
+    if ( m0 > D_ZERO ) { off[2*i+c] = s*k;     w[2*i+c] = m0; c++; }
+    if ( m1 > D_ZERO ) { off[2*i+c] = s*(k+1); w[2*i+c] = m1; c++; }
+    if ( 0 == c ) { return; }
+    cnt[i] = c;
+    pos[i] = 0;
+  }
+
+  for ( ;; ) {
+    int32_t r = 0;
+    real8_t g = D_ONE;
+    for ( int32_t i=0; i<m; i++ ) {
+      const int32_t j = 2*i + pos[i];
+      r += off[j];
+      if ( tmin ) {
+        g = ( w[j] < g ) ? w[j] : g;
+      } else {
+        g *= w[j];
+      }
+    }
+    f( r, g );
+
+    int32_t i = 0;
+    while ( ( i < m ) && ( ++pos[i] == cnt[i] ) ) {
+      pos[i] = 0;
+      i++;
+    }
+    if ( i == m ) { break; }
+  }
+}
+
+} // end namespace
+
+
+// =======================================================================================
+/** @brief Constructor.
+ *  @param[in] in  antecedent Group, one partition per crisp input.
+ *  @param[in] out consequent Group, one partition per crisp output.
+ *
+ *  Construct a MAMDANI rule base. Every rule initially names the first set of each
+ *  output partition.
+ */
+// ---------------------------------------------------------------------------------------
+RuleBase::RuleBase( Group& in, Group& out ) : INIT_VAR( MAMDANI ) {
+  // -------------------------------------------------------------------------------------
+  input.compile( in );
+  output.compile( out );
+  num_out = output.nIn();
+  shape();
+  conseq.assign( static_cast<size_t>( num_rule*num_out ), 0 );
+}
+
+
+// =======================================================================================
+/** @brief Constructor.
+ *  @param[in] in   antecedent Group, one partition per crisp input.
+ *  @param[in] nout number of crisp outputs.
+ *
+ *  Construct a first order TSK rule base. Every rule function is initially zero.
+ */
+// ---------------------------------------------------------------------------------------
+RuleBase::RuleBase( Group& in, const int32_t nout ) : INIT_VAR( TSK ) {
+  // -------------------------------------------------------------------------------------
+  input.compile( in );
+  num_out = nout;
+  shape();
+  coef.assign( static_cast<size_t>( num_rule*num_out*(num_in+1) ), D_ZERO );
+}
+
+
+// =======================================================================================
+/** @brief Destructor.
+ */
+// ---------------------------------------------------------------------------------------
+RuleBase::~RuleBase( void ) {
+  // -------------------------------------------------------------------------------------
+}
+
+
+// =======================================================================================
+/** @brief Shape.
+ *
+ *  Compute the rule index strides. The first input varies fastest. If there are no
+ *  inputs, or the rule tables would not fit an int32_t index, the rule base is marked
+ *  bad and left with no rules and no strides.
+ */
+// ---------------------------------------------------------------------------------------
+void RuleBase::shape( void ) {
+  // -------------------------------------------------------------------------------------
+  num_in   = input.nIn();
+  num_rule = 0;
+  failed   = true;
+  stride.clear();
+
+  if ( 1 > num_in ) {
+    logger->error( "fuzzy::RuleBase: no inputs" );
+    return;
+  }
+
+  const int64_t per_rule = ( 0 < num_out ) ? ( num_out*(num_in+1) ) : 1;
+  std::vector<int32_t> S( static_cast<size_t>( num_in ), 0 );
+
+  int64_t n = 1;
+  for ( int32_t i=0; i<num_in; i++ ) {
+    S[ static_cast<size_t>(i) ] = static_cast<int32_t>( n );
+    n *= input.nSet( i );
+    if ( n > 0x7FFFFFFF / per_rule ) {
+      logger->error( "fuzzy::RuleBase: too many rules at input %d", i );
+      return;
+    }
+  }
+
+  stride.swap( S );
+  num_rule = static_cast<int32_t>( n );
+  failed   = false;
+}
+
+
+// =======================================================================================
+/** @brief Rule Index.
+ *  @param[in] sets index of the set of each input.
+ *  @return index of the rule.
+ */
+// ---------------------------------------------------------------------------------------
+int32_t RuleBase::index( const int32_t* sets ) const {
+  // -------------------------------------------------------------------------------------
+  if ( failed ) { return 0; }
+  int32_t r = 0;
+  for ( int32_t i=0; i<num_in; i++ ) {
+    r += stride[ static_cast<size_t>(i) ] * sets[i];
+  }
+  return r;
+}
+
+
+// =======================================================================================
+/** @brief Set Consequent.
+ *  @param[in] r index of the rule.
+ *  @param[in] o index of the output.
+ *  @param[in] k index of the set in the oth output partition (MAMDANI).
+ */
+// ---------------------------------------------------------------------------------------
+void RuleBase::set( const int32_t r, const int32_t o, const int32_t k ) {
+  // -------------------------------------------------------------------------------------
+  if ( failed ) {
+    logger->error( "fuzzy::RuleBase::set: the rule base is bad" );
+    return;
+  }
+  conseq[ static_cast<size_t>( r*num_out + o ) ] = k;
+}
+
+
+// =======================================================================================
+/** @brief Get Consequent.
+ *  @param[in] r index of the rule.
+ *  @param[in] o index of the output.
+ *  @return index of the set in the oth output partition (MAMDANI).
+ */
+// ---------------------------------------------------------------------------------------
+int32_t RuleBase::get( const int32_t r, const int32_t o ) const {
+  // -------------------------------------------------------------------------------------
+  if ( failed ) { return 0; }
+  return conseq[ static_cast<size_t>( r*num_out + o ) ];
+}
+
+
+// =======================================================================================
+/** @brief Set Consequent.
+ *  @param[in] r index of the rule.
+ *  @param[in] o index of the output.
+ *  @param[in] c nIn()+1 coefficients, y = c[0] + c[1]*x[0] + ... (TSK).
+ */
+// ---------------------------------------------------------------------------------------
+void RuleBase::set( const int32_t r, const int32_t o, const real8_t* c ) {
+  // -------------------------------------------------------------------------------------
+  if ( failed ) {
+    logger->error( "fuzzy::RuleBase::set: the rule base is bad" );
+    return;
+  }
+  real8_t* dst = coef.data() + ( r*num_out + o ) * ( num_in+1 );
+  for ( int32_t k=0; k<=num_in; k++ ) {
+    dst[k] = c[k];
+  }
+}
+
+
+// =======================================================================================
+/** @brief Coefficients.
+ *  @param[in] r index of the rule.
+ *  @param[in] o index of the output.
+ *  @return pointer to the nIn()+1 coefficients of the rule function (TSK), null if bad.
+ */
+// ---------------------------------------------------------------------------------------
+const real8_t* RuleBase::coefficients( const int32_t r, const int32_t o ) const {
+  // -------------------------------------------------------------------------------------
+  if ( failed ) { return static_cast<const real8_t*>(0); }
+  return coef.data() + ( r*num_out + o ) * ( num_in+1 );
+}
+
+
+// =======================================================================================
+/** @brief Fire.
+ *  @param[out] mu degree of membership in each set of the output Group.
+ *  @param[in]  x  crisp value of each input.
+ *
+ *  Max-min inference of a MAMDANI rule base. Only the rules with non-zero firing
+ *  strength are visited.
+ */
+// ---------------------------------------------------------------------------------------
+void RuleBase::fire( real8_t* mu, const real8_t* x ) const {
+  // -------------------------------------------------------------------------------------
+  if ( MAMDANI != mode ) {
+    logger->error( "fuzzy::RuleBase::fire: a TSK rule base has no output sets" );
+    return;
+  }
+
+  const int32_t n = output.nOut();
+  for ( int32_t j=0; j<n; j++ ) {
+    mu[j] = D_ZERO;
+  }
+
+  if ( failed ) { return; }
+
+  const int32_t  no = num_out;
+  const int32_t* cq = conseq.data();
+  const Kernel&  ok = output;
+  visit( input, stride, x, true, [mu, no, cq, &ok]( int32_t r, real8_t g ) {
+      for ( int32_t o=0; o<no; o++ ) {
+        const int32_t j = ok.offset( o ) + cq[ r*no + o ];
+        mu[j] = ( g > mu[j] ) ? g : mu[j];
+      }
+    } );
+}
+
+
+// =======================================================================================
+/** @brief Evaluate.
+ *  @param[out] y crisp value of each output.
+ *  @param[in]  x crisp value of each input.
+ *
+ *  MAMDANI: fire the rules and defuzzify the output Group.
+ *  TSK:     firing weighted mean of the rule functions. The output is zero when no rule
+ *           fires.
+ */
+// ---------------------------------------------------------------------------------------
+void RuleBase::evaluate( real8_t* y, const real8_t* x ) const {
+  // -------------------------------------------------------------------------------------
+  for ( int32_t o=0; o<num_out; o++ ) {
+    y[o] = D_ZERO;
+  }
+
+  if ( failed ) { return; }
+
+  if ( MAMDANI == mode ) {
+    std::vector<real8_t> mu( static_cast<size_t>( output.nOut() ) );
+    fire( mu.data(), x );
+    output.defuzzify( y, mu.data() );
+    return;
+  }
+
+  real8_t        sw = D_ZERO;
+  const int32_t  ni = num_in;
+  const int32_t  no = num_out;
+  const real8_t* cf = coef.data();
+  visit( input, stride, x, false, [y, x, ni, no, cf, &sw]( int32_t r, real8_t g ) {
+      const real8_t* c = cf + r * no * ( ni+1 );
+      for ( int32_t o=0; o<no; o++ ) {
+        real8_t v = c[0];
+        for ( int32_t k=0; k<ni; k++ ) {
+          v += c[k+1] * x[k];
+        }
+        y[o] += g * v;
+        c    += ni+1;
+      }
+      sw += g;
+    } );
+
+  if ( sw > D_ZERO ) {
+    for ( int32_t o=0; o<num_out; o++ ) {
+      y[o] /= sw;
+    }
+  }
+}
+
+
+// =======================================================================================
+/** @brief Evaluate.
+ *  @param[out] y table of crisp outputs (samples x nOut). Resized if necessary.
+ *  @param[in]  x table of crisp inputs  (samples x nIn).
+ *
+ *  Blocks of samples are evaluated in parallel on the global ThreadPool.
+ */
+// ---------------------------------------------------------------------------------------
+void RuleBase::evaluate( Table& y, const Table& x ) const {
+  // -------------------------------------------------------------------------------------
+  const int32_t ns = x.size(0);
+
+  if ( x.size(1) != num_in ) {
+    logger->error( "fuzzy::RuleBase::evaluate: table has %d inputs, expected %d",
+                   x.size(1), num_in );
+    return;
+  }
+
+  y.resize( ns, num_out );
+
+  ThreadPool::global()->parallel_for( 0, ns, [this, &y, &x]( int64_t s0, int64_t s1 ) {
+    std::vector<real8_t> buf( static_cast<size_t>( num_in + num_out ) );
+    real8_t* xs = buf.data();
+    real8_t* ys = xs + num_in;
+    for ( int64_t s=s0; s<s1; s++ ) {
+      const int32_t is = static_cast<int32_t>( s );
+      for ( int32_t i=0; i<num_in; i++ ) {
+        xs[i] = x.col( i )[is];
+      }
+      evaluate( ys, xs );
+      for ( int32_t o=0; o<num_out; o++ ) {
+        y( is, o ) = ys[o];
+      }
+    }
+  }, 512 );
+}
+
+
+// =======================================================================================
+/** @brief Buffer Size.
+ *  @return number of elements required to support load/store.
+ *
+ *  MAMDANI: one set index per rule and output.
+ *  TSK:     nIn()+1 coefficients per rule and output.
+ */
+// ---------------------------------------------------------------------------------------
+int32_t RuleBase::size( void ) const {
+  // -------------------------------------------------------------------------------------
+  return ( MAMDANI == mode ) ? static_cast<int32_t>( conseq.size() )
+      : static_cast<int32_t>( coef.size() );
+}
+
+
+// =======================================================================================
+/** @brief Load.
+ *  @param[in] src pointer to source data.
+ *  @return pointer to the next location.
+ *
+ *  Set the consequents from an array of real8_t. Mamdani set indices are rounded to the
+ *  nearest set of the output partition.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t* RuleBase::load( real8_t* src ) {
+  // -------------------------------------------------------------------------------------
+  if ( MAMDANI == mode ) {
+    for ( int32_t r=0; r<num_rule; r++ ) {
+      for ( int32_t o=0; o<num_out; o++ ) {
+        const int32_t n = output.nSet( o );
+        int32_t       k = static_cast<int32_t>( std::lround( *src++ ) );
+        k = ( k < 0 ) ? 0 : ( ( k < n ) ? k : ( n-1 ) );
+        conseq[ static_cast<size_t>( r*num_out + o ) ] = k;
+      }
+    }
+    return src;
+  }
+
+  const size_t n = coef.size();
+  for ( size_t i=0; i<n; i++ ) {
+    coef[i] = *src++;
+  }
+  return src;
+}
+
+
+// =======================================================================================
+/** @brief Store.
+ *  @param[out] dst pointer to destination data.
+ *  @return pointer to the next location.
+ *
+ *  Store the consequents to an array of real8_t.
+ */
+// ---------------------------------------------------------------------------------------
+real8_t* RuleBase::store( real8_t* dst ) const {
+  // -------------------------------------------------------------------------------------
+  if ( MAMDANI == mode ) {
+    const size_t n = conseq.size();
+    for ( size_t i=0; i<n; i++ ) {
+      *dst++ = static_cast<real8_t>( conseq[i] );
+    }
+    return dst;
+  }
+
+  const size_t n = coef.size();
+  for ( size_t i=0; i<n; i++ ) {
+    *dst++ = coef[i];
+  }
+  return dst;
+}
+
+
+}; // end namespace fuzzy
+
+
+// =======================================================================================
+// **                           F U Z Z Y : : R U L E B A S E                           **
+// ======================================================================== END FILE =====
@@ -36,99 +36,253 @@
 
 
 #include <trncmp.hh>
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 // =======================================================================================
-/** @brief Radial Center of mass.
- *  @param[in] mag array of vector magnitudes
- *  @param[in] rad array of vector directions
- *  @param[in] n   number of array elements
- *  @return    direction of the weighted average vector [0,2Pi)
+/** @brief Radial moments.
+ *  @param[out] M   sum of the magnitudes.
+ *  @param[out] X   sum of the magnitude weighted cosines.
+ *  @param[out] Y   sum of the magnitude weighted sines.
+ *  @param[in]  mag array of vector magnitudes.
+ *  @param[in]  rad array of vector directions.
+ *  @param[in]  i0  first index.
+ *  @param[in]  i1  one past the last index.
  *
- *  Find the two dimensional weighted average [0,2Pi)
+ *  Single pass over the elements; summation::sinCos is inlined so that the loop
+ *  vectorizes. If any direction is outside the sinCos range (or NaN) the sums of the
+ *  components are recomputed with std::cos and std::sin.
  */
 // ---------------------------------------------------------------------------------------
-real8_t centerOfMassRad( const real8_t* mag, const real8_t* rad, const size_t n ) {
+template<class T>
+static void radialMoments( T& M, T& X, T& Y, const T* mag, const T* rad,
+                           const size_t i0, const size_t i1 ) {
   // -------------------------------------------------------------------------------------
-  real8_t MXSum = D_ZERO;
-  real8_t MYSum = D_ZERO;
-  real8_t MSum  = D_ZERO;
+  T m = static_cast<T>(0);
+  T x = static_cast<T>(0);
+  T y = static_cast<T>(0);
 
-  for (size_t i=0; i<n; i++) { MSum  +=  mag[i]; }
+  int32_t out = 0;
 
-  if (isZero(MSum)) { return D_ZERO; }
+#pragma omp simd reduction( +:m,x,y,out )
+  for ( size_t i=i0; i<i1; i++ ) {
+    T s, c;
+    summation::sinCos( rad[i], s, c );
+    m   += mag[i];
+    x   += mag[i] * c;
+    y   += mag[i] * s;
+    out += summation::sinCosRange( rad[i] ) ? 0 : 1;
+  }
 
-  for (size_t i=0; i<n; i++) {
-    MXSum += (mag[i] * cos(rad[i]));
-    MYSum += (mag[i] * sin(rad[i]));
+  if ( 0 < out ) {
+    x = static_cast<T>(0);
+    y = static_cast<T>(0);
+    for ( size_t i=i0; i<i1; i++ ) {
+      x += mag[i] * std::cos( rad[i] );
+      y += mag[i] * std::sin( rad[i] );
+    }
   }
 
-  return ArcTan( (MYSum / MSum), (MXSum / MSum) );
+  M = m;
+  X = x;
+  Y = y;
+}
+
+
+// =======================================================================================
+/** @brief Mean direction.
+ *  @param[in] M  sum of the magnitudes.
+ *  @param[in] X  sum of the magnitude weighted cosines.
+ *  @param[in] Y  sum of the magnitude weighted sines.
+ *  @param[in] pm true for (-Pi,+Pi], false for [0,2Pi).
+ *  @return direction of the weighted average vector, zero if the magnitudes sum to zero.
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+static T meanDirection( const T M, const T X, const T Y, const bool pm ) {
+  // -------------------------------------------------------------------------------------
+  if ( isZero( M ) ) { return static_cast<T>(0); }
+  return ( pm ) ? ArcTanPM( (Y / M), (X / M) ) : ArcTan( (Y / M), (X / M) );
 }
 
 
 // =======================================================================================
 /** @brief Radial Center of mass.
- *  @param[in] mag array of vector magnitudes
- *  @param[in] rad array of vector directions
- *  @param[in] n   number of array elements
- *  @return    direction of the weighted average vector (-Pi,+Pi]
+ *  @param[in] mag array of vector magnitudes.
+ *  @param[in] rad array of vector directions.
+ *  @param[in] n   number of array elements.
+ *  @param[in] pm  true for (-Pi,+Pi], false for [0,2Pi).
+ *  @return    direction of the weighted average vector.
  *
- *  Find the two dimensional weighted average (-Pi,+Pi]
+ *  Arrays of at least summation::PARALLEL_MIN elements are split into one contiguous
+ *  block per OpenMP thread; the partial moments are combined in thread order.
  */
 // ---------------------------------------------------------------------------------------
-real8_t centerOfMassRadPM( const real8_t* mag, const real8_t* rad, const size_t n ) {
+template<class T>
+static T radialCenter( const T* mag, const T* rad, const size_t n, const bool pm ) {
+  // -------------------------------------------------------------------------------------
+#ifdef _OPENMP
+  const int32_t nthr = ( summation::PARALLEL_MIN > n ) ? ( 1 ) : ( omp_get_max_threads() );
+#else
+  const int32_t nthr = 1;
+#endif
+
+  T M, X, Y;
+
+  if ( 1 == nthr ) {
+    radialMoments( M, X, Y, mag, rad, 0, n );
+    return meanDirection( M, X, Y, pm );
+  }
+
+  std::vector<T> part( static_cast<size_t>( 3 * nthr ) );
+
+#pragma omp parallel num_threads( nthr )
+  {
+#ifdef _OPENMP
+    const size_t tid = static_cast<size_t>( omp_get_thread_num() );
+#else
+    const size_t tid = 0;
+#endif
+    const size_t nt = static_cast<size_t>( nthr );
+    const size_t i0 = ( tid * n ) / nt;
+    const size_t i1 = ( ( tid + 1 ) * n ) / nt;
+    radialMoments( part[3*tid], part[3*tid+1], part[3*tid+2], mag, rad, i0, i1 );
+  }
+
+  M = X = Y = static_cast<T>(0);
+  for ( size_t t=0; t<static_cast<size_t>( nthr ); t++ ) {
+    M += part[3*t];
+    X += part[3*t+1];
+    Y += part[3*t+2];
+  }
+
+  return meanDirection( M, X, Y, pm );
+}
+
+
+// =======================================================================================
+/** @brief Segmented Radial Center of mass.
+ *  @param[out] com    one direction per segment.
+ *  @param[in]  mag    array of vector magnitudes.
+ *  @param[in]  rad    array of vector directions.
+ *  @param[in]  offset nseg+1 non-decreasing segment boundaries.
+ *  @param[in]  nseg   number of segments.
+ *  @param[in]  pm     true for (-Pi,+Pi], false for [0,2Pi).
+ *  @return true on error.
+ *
+ *  Each thread takes the segments that start inside its share of the elements, so the
+ *  work is balanced by element count rather than by segment count.
+ */
+// ---------------------------------------------------------------------------------------
+template<class T>
+static bool radialCenterBatch( T* com, const T* mag, const T* rad,
+                               const size_t* offset, const size_t nseg, const bool pm ) {
   // -------------------------------------------------------------------------------------
-  real8_t MXSum = D_ZERO;
-  real8_t MYSum = D_ZERO;
-  real8_t MSum  = D_ZERO;
+  for ( size_t k=0; k<nseg; k++ ) {
+    if ( offset[k+1] < offset[k] ) { return true; }
+  }
+
+  if ( 0 == nseg ) { return false; }
 
-  for (size_t i=0; i<n; i++) { MSum  +=  mag[i]; }
+  const size_t first = offset[0];
+  const size_t total = offset[nseg] - first;
 
-  if (isZero(MSum)) { return D_ZERO; }
+#ifdef _OPENMP
+  const int32_t nthr = ( ( summation::PARALLEL_MIN > total ) || ( 2 > nseg ) ) ?
+      ( 1 ) : ( omp_get_max_threads() );
+#else
+  const int32_t nthr = 1;
+#endif
 
-  for (size_t i=0; i<n; i++) {
-    MXSum += (mag[i] * cos(rad[i]));
-    MYSum += (mag[i] * sin(rad[i]));
+#pragma omp parallel num_threads( nthr )
+  {
+#ifdef _OPENMP
+    const size_t tid = static_cast<size_t>( omp_get_thread_num() );
+#else
+    const size_t tid = 0;
+#endif
+    const size_t nt = static_cast<size_t>( nthr );
+    const size_t e0 = first + ( tid * total ) / nt;
+    const size_t e1 = first + ( ( tid + 1 ) * total ) / nt;
+    const size_t k0 = static_cast<size_t>( std::lower_bound( offset, offset+nseg, e0 ) - offset );
+    const size_t k1 = ( tid + 1 == nt ) ? nseg :
+        static_cast<size_t>( std::lower_bound( offset, offset+nseg, e1 ) - offset );
+
+    for ( size_t k=k0; k<k1; k++ ) {
+      T M, X, Y;
+      radialMoments( M, X, Y, mag, rad, offset[k], offset[k+1] );
+      com[k] = meanDirection( M, X, Y, pm );
+    }
   }
 
-  return ArcTanPM( (MYSum / MSum), (MXSum / MSum) );  
+  return false;
 }
 
 
 // =======================================================================================
 /** @brief Radial Center of mass.
  *  @param[in] mag array of vector magnitudes
- *  @param[in] rad array of vector directions
+ *  @param[in] rad array of vector directions [radians]. Directions beyond
+ *                 summation::SINCOS8_RANGE (SINCOS4_RANGE for real4_t) are evaluated
+ *                 with std::sin and std::cos, at the cost of the vectorized path.
  *  @param[in] n   number of array elements
  *  @return    direction of the weighted average vector [0,2Pi)
  *
  *  Find the two dimensional weighted average [0,2Pi)
  */
 // ---------------------------------------------------------------------------------------
-real4_t centerOfMassRad( const real4_t* mag, const real4_t* rad, const size_t n ) {
+real8_t centerOfMassRad( const real8_t* mag, const real8_t* rad, const size_t n ) {
   // -------------------------------------------------------------------------------------
-  real4_t MXSum = F_ZERO;
-  real4_t MYSum = F_ZERO;
-  real4_t MSum  = F_ZERO;
+  return radialCenter( mag, rad, n, false );
+}
 
-  for (size_t i=0; i<n; i++) { MSum  +=  mag[i]; }
 
-  if (isZero(MSum)) { return F_ZERO; }
+// =======================================================================================
+/** @brief Radial Center of mass.
+ *  @param[in] mag array of vector magnitudes
+ *  @param[in] rad array of vector directions [radians]. Directions beyond
+ *                 summation::SINCOS8_RANGE (SINCOS4_RANGE for real4_t) are evaluated
+ *                 with std::sin and std::cos, at the cost of the vectorized path.
+ *  @param[in] n   number of array elements
+ *  @return    direction of the weighted average vector (-Pi,+Pi]
+ *
+ *  Find the two dimensional weighted average (-Pi,+Pi]
+ */
+// ---------------------------------------------------------------------------------------
+real8_t centerOfMassRadPM( const real8_t* mag, const real8_t* rad, const size_t n ) {
+  // -------------------------------------------------------------------------------------
+  return radialCenter( mag, rad, n, true );
+}
 
-  for (size_t i=0; i<n; i++) {
-    MXSum += (mag[i] * cosf(rad[i]));
-    MYSum += (mag[i] * sinf(rad[i]));
-  }
 
-  return ArcTan( (MYSum / MSum), (MXSum / MSum) );
+// =======================================================================================
+/** @brief Radial Center of mass.
+ *  @param[in] mag array of vector magnitudes
+ *  @param[in] rad array of vector directions [radians]. Directions beyond
+ *                 summation::SINCOS8_RANGE (SINCOS4_RANGE for real4_t) are evaluated
+ *                 with std::sin and std::cos, at the cost of the vectorized path.
+ *  @param[in] n   number of array elements
+ *  @return    direction of the weighted average vector [0,2Pi)
+ *
+ *  Find the two dimensional weighted average [0,2Pi)
+ */
+// ---------------------------------------------------------------------------------------
+real4_t centerOfMassRad( const real4_t* mag, const real4_t* rad, const size_t n ) {
+  // -------------------------------------------------------------------------------------
+  return radialCenter( mag, rad, n, false );
 }
 
 
 // =======================================================================================
 /** @brief Radial Center of mass.
  *  @param[in] mag array of vector magnitudes
- *  @param[in] rad array of vector directions
+ *  @param[in] rad array of vector directions [radians]. Directions beyond
+ *                 summation::SINCOS8_RANGE (SINCOS4_RANGE for real4_t) are evaluated
+ *                 with std::sin and std::cos, at the cost of the vectorized path.
  *  @param[in] n   number of array elements
  *  @return    direction of the weighted average vector (-Pi,+Pi]
  *
@@ -137,20 +291,91 @@ real4_t centerOfMassRad( const real4_t* mag, const real4_t* rad, const size_t n
 // ---------------------------------------------------------------------------------------
 real4_t centerOfMassRadPM( const real4_t* mag, const real4_t* rad, const size_t n ) {
   // -------------------------------------------------------------------------------------
-  real4_t MXSum = F_ZERO;
-  real4_t MYSum = F_ZERO;
-  real4_t MSum  = F_ZERO;
+  return radialCenter( mag, rad, n, true );
+}
+
+
+// =======================================================================================
+/** @brief Segmented Radial Center of mass.
+ *  @param[out] com    array of nseg directions of the weighted average vectors [0,2Pi)
+ *  @param[in]  mag    array of vector magnitudes
+ *  @param[in]  rad    array of vector directions [radians]. A segment with a direction
+ *                     beyond summation::SINCOS8_RANGE (SINCOS4_RANGE for real4_t) is
+ *                     evaluated with std::sin and std::cos.
+ *  @param[in]  offset nseg+1 segment boundaries; segment k is [offset[k],offset[k+1])
+ *  @param[in]  nseg   number of segments
+ *  @return true if the offsets are decreasing.
+ *
+ *  Find the two dimensional weighted average [0,2Pi) of every segment.
+ */
+// ---------------------------------------------------------------------------------------
+bool centerOfMassRad( real8_t* com, const real8_t* mag, const real8_t* rad,
+                      const size_t* offset, const size_t nseg ) {
+  // -------------------------------------------------------------------------------------
+  return radialCenterBatch( com, mag, rad, offset, nseg, false );
+}
+
 
-  for (size_t i=0; i<n; i++) { MSum  +=  mag[i]; }
+// =======================================================================================
+/** @brief Segmented Radial Center of mass.
+ *  @param[out] com    array of nseg directions of the weighted average vectors (-Pi,+Pi]
+ *  @param[in]  mag    array of vector magnitudes
+ *  @param[in]  rad    array of vector directions [radians]. A segment with a direction
+ *                     beyond summation::SINCOS8_RANGE (SINCOS4_RANGE for real4_t) is
+ *                     evaluated with std::sin and std::cos.
+ *  @param[in]  offset nseg+1 segment boundaries; segment k is [offset[k],offset[k+1])
+ *  @param[in]  nseg   number of segments
+ *  @return true if the offsets are decreasing.
+ *
+ *  Find the two dimensional weighted average (-Pi,+Pi] of every segment.
+ */
+// ---------------------------------------------------------------------------------------
+bool centerOfMassRadPM( real8_t* com, const real8_t* mag, const real8_t* rad,
+                        const size_t* offset, const size_t nseg ) {
+  // -------------------------------------------------------------------------------------
+  return radialCenterBatch( com, mag, rad, offset, nseg, true );
+}
 
-  if (isZero(MSum)) { return F_ZERO; }
 
-  for (size_t i=0; i<n; i++) {
-    MXSum += (mag[i] * cosf(rad[i]));
-    MYSum += (mag[i] * sinf(rad[i]));
-  }
+// =======================================================================================
+/** @brief Segmented Radial Center of mass.
+ *  @param[out] com    array of nseg directions of the weighted average vectors [0,2Pi)
+ *  @param[in]  mag    array of vector magnitudes
+ *  @param[in]  rad    array of vector directions [radians]. A segment with a direction
+ *                     beyond summation::SINCOS8_RANGE (SINCOS4_RANGE for real4_t) is
+ *                     evaluated with std::sin and std::cos.
+ *  @param[in]  offset nseg+1 segment boundaries; segment k is [offset[k],offset[k+1])
+ *  @param[in]  nseg   number of segments
+ *  @return true if the offsets are decreasing.
+ *
+ *  Find the two dimensional weighted average [0,2Pi) of every segment.
+ */
+// ---------------------------------------------------------------------------------------
+bool centerOfMassRad( real4_t* com, const real4_t* mag, const real4_t* rad,
+                      const size_t* offset, const size_t nseg ) {
+  // -------------------------------------------------------------------------------------
+  return radialCenterBatch( com, mag, rad, offset, nseg, false );
+}
 
-  return ArcTanPM( (MYSum / MSum), (MXSum / MSum) );  
+
+// =======================================================================================
+/** @brief Segmented Radial Center of mass.
+ *  @param[out] com    array of nseg directions of the weighted average vectors (-Pi,+Pi]
+ *  @param[in]  mag    array of vector magnitudes
+ *  @param[in]  rad    array of vector directions [radians]. A segment with a direction
+ *                     beyond summation::SINCOS8_RANGE (SINCOS4_RANGE for real4_t) is
+ *                     evaluated with std::sin and std::cos.
+ *  @param[in]  offset nseg+1 segment boundaries; segment k is [offset[k],offset[k+1])
+ *  @param[in]  nseg   number of segments
+ *  @return true if the offsets are decreasing.
+ *
+ *  Find the two dimensional weighted average (-Pi,+Pi] of every segment.
+ */
+// ---------------------------------------------------------------------------------------
+bool centerOfMassRadPM( real4_t* com, const real4_t* mag, const real4_t* rad,
+                        const size_t* offset, const size_t nseg ) {
+  // -------------------------------------------------------------------------------------
+  return radialCenterBatch( com, mag, rad, offset, nseg, true );
 }
 
 
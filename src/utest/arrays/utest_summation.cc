@@ -37,6 +37,10 @@
 #include <limits.h>
 #include "trncmp.hh"
 #include "gtest/gtest.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 
 namespace {
@@ -524,9 +528,255 @@ TEST( test_rad_com8, Positive ) {
   //EXPECT_DOUBLE_EQ( target , rtest );
 }
 
+
+// ---------------------------------------------------------------------------------------
+
+
+TEST( test_sum_kahan, cancel ) {
+  real8_t X[] = { 1.0, 1.0e100, 1.0, -1.0e100 };
+  real4_t Y[] = { 1.0f, 1.0e20f, 1.0f, -1.0e20f };
+
+  EXPECT_DOUBLE_EQ( 2.0,  sumKahan( X, 4 ) );
+  EXPECT_FLOAT_EQ(  2.0f, sumKahan( Y, 4 ) );
+  EXPECT_DOUBLE_EQ( 0.0,  sumKahan( X, 0 ) );
+}
+
+
+// ---------------------------------------------------------------------------------------
+
+
+TEST( test_sum_kahan, long8 ) {
+  // ----- above PARALLEL_MIN so the threaded path is used --
+  const size_t N = 1000003;
+  std::vector<real8_t> X( N );
+  size_t count[17] = { 0 };
+  for ( size_t k=0; k<N; k++ ) {
+    X[k] = 0.1 + 1.0e-3 * static_cast<real8_t>( k % 17 );
+    count[ k % 17 ] += 1;
+  }
+  long double ref = 0.0L;
+  for ( size_t j=0; j<17; j++ ) {
+    ref += static_cast<long double>( count[j] ) *
+        static_cast<long double>( 0.1 + 1.0e-3 * static_cast<real8_t>( j ) );
+  }
+  const real8_t target = static_cast<real8_t>( ref );
+
+  EXPECT_NEAR( target, sumKahan( X.data(), N ),    target * 4.0e-16 );
+  EXPECT_NEAR( target, sumPairwise( X.data(), N ), target * 4.0e-15 );
+  EXPECT_NEAR( target, sum( X.data(), N ),         target * 1.0e-10 );
+}
+
+
+// ---------------------------------------------------------------------------------------
+
+
+TEST( test_sum_kahan, long4 ) {
+  const size_t N = 1000003;
+  std::vector<real4_t> X( N );
+  size_t count[17] = { 0 };
+  for ( size_t k=0; k<N; k++ ) {
+    X[k] = 0.1f + 1.0e-3f * static_cast<real4_t>( k % 17 );
+    count[ k % 17 ] += 1;
+  }
+  real8_t ref = 0.0;
+  for ( size_t j=0; j<17; j++ ) {
+    ref += static_cast<real8_t>( count[j] ) *
+        static_cast<real8_t>( 0.1f + 1.0e-3f * static_cast<real4_t>( j ) );
+  }
+  const real4_t target = static_cast<real4_t>( ref );
+
+  EXPECT_NEAR( target, sumKahan( X.data(), N ),    target * 2.0e-7f );
+  EXPECT_NEAR( target, sumPairwise( X.data(), N ), target * 2.0e-6f );
+
+  // ----- a single float accumulator drifts ---------------
+  EXPECT_GT( std::fabs( sum( X.data(), N ) - target ), target * 1.0e-5f );
+}
+
+
+// ---------------------------------------------------------------------------------------
+
+
+TEST( test_sum_kahan, variants ) {
+  const size_t N = 100003;
+  std::vector<real8_t> W( N ), X( N ), Y( N );
+  long double rsq = 0.0L, rw = 0.0L, rd = 0.0L;
+  for ( size_t k=0; k<N; k++ ) {
+    W[k] = 1.0 / static_cast<real8_t>( k + 1 );
+    X[k] = 0.3 + 1.0e-4 * static_cast<real8_t>( k % 101 );
+    Y[k] = 0.7 - 1.0e-4 * static_cast<real8_t>( k % 37 );
+    const long double d = static_cast<long double>( X[k] ) - static_cast<long double>( Y[k] );
+    rsq += static_cast<long double>( X[k] ) * static_cast<long double>( X[k] );
+    rw  += static_cast<long double>( W[k] ) * static_cast<long double>( X[k] );
+    rd  += d*d;
+  }
+
+  EXPECT_NEAR( static_cast<real8_t>( rsq ), sumsqKahan( X.data(), N ),
+               static_cast<real8_t>( rsq ) * 1.0e-15 );
+  EXPECT_NEAR( static_cast<real8_t>( rw ), wsumKahan( W.data(), X.data(), N ),
+               static_cast<real8_t>( rw ) * 1.0e-15 );
+  EXPECT_NEAR( static_cast<real8_t>( rd ), sumsqDiffKahan( X.data(), Y.data(), N ),
+               static_cast<real8_t>( rd ) * 1.0e-15 );
+  EXPECT_NEAR( static_cast<real8_t>( rd / N ), MSEKahan( X.data(), Y.data(), N ),
+               static_cast<real8_t>( rd / N ) * 1.0e-15 );
+}
+
 } // end namespace
 
 
+// ---------------------------------------------------------------------------------------
+
+
+TEST( test_sincos, bound8 ) {
+  real8_t emax = 0.0;
+  const int32_t n = 200001;
+  for ( int32_t i=0; i<n; i++ ) {
+    const real8_t x = -100.0 + 200.0 * static_cast<real8_t>( i ) / static_cast<real8_t>( n-1 );
+    real8_t s, c;
+    summation::sinCos( x, s, c );
+    emax = std::max( emax, std::fabs( s - std::sin( x ) ) );
+    emax = std::max( emax, std::fabs( c - std::cos( x ) ) );
+  }
+  for ( int32_t i=0; i<1000; i++ ) {
+    const real8_t x = summation::SINCOS8_RANGE * ( 1.0 - 1.7e-3 * static_cast<real8_t>( i ) );
+    real8_t s, c;
+    summation::sinCos( x, s, c );
+    emax = std::max( emax, std::fabs( s - std::sin( x ) ) );
+    emax = std::max( emax, std::fabs( c - std::cos( x ) ) );
+  }
+  EXPECT_LT( emax, summation::SINCOS8_ERROR );
+}
+
+
+TEST( test_sincos, bound4 ) {
+  real8_t emax = 0.0;
+  const int32_t n = 200001;
+  for ( int32_t i=0; i<n; i++ ) {
+    const real4_t x = static_cast<real4_t>( -100.0 + 200.0 * static_cast<real8_t>( i ) /
+                                            static_cast<real8_t>( n-1 ) );
+    real4_t s, c;
+    summation::sinCos( x, s, c );
+    emax = std::max( emax, std::fabs( static_cast<real8_t>( s ) - std::sin( static_cast<real8_t>( x ) ) ) );
+    emax = std::max( emax, std::fabs( static_cast<real8_t>( c ) - std::cos( static_cast<real8_t>( x ) ) ) );
+  }
+  for ( int32_t i=0; i<1000; i++ ) {
+    const real4_t x = summation::SINCOS4_RANGE * ( 1.0f - 1.7e-3f * static_cast<real4_t>( i ) );
+    real4_t s, c;
+    summation::sinCos( x, s, c );
+    emax = std::max( emax, std::fabs( static_cast<real8_t>( s ) - std::sin( static_cast<real8_t>( x ) ) ) );
+    emax = std::max( emax, std::fabs( static_cast<real8_t>( c ) - std::cos( static_cast<real8_t>( x ) ) ) );
+  }
+  EXPECT_LT( emax, static_cast<real8_t>( summation::SINCOS4_ERROR ) );
+}
+
+
+TEST( test_rad_com, single ) {
+  const size_t n = 100000;
+  std::vector<real8_t> M( n ), R( n );
+  std::vector<real4_t> M4( n ), R4( n );
+  real8_t mx = 0.0, my = 0.0;
+  for ( size_t i=0; i<n; i++ ) {
+    M[i]  = 1.0 + static_cast<real8_t>( i % 7 );
+    R[i]  = 2.5 + 0.9 * std::sin( static_cast<real8_t>( i ) );
+    M4[i] = static_cast<real4_t>( M[i] );
+    R4[i] = static_cast<real4_t>( R[i] );
+    mx += M[i] * std::cos( R[i] );
+    my += M[i] * std::sin( R[i] );
+  }
+  const real8_t ref = std::atan2( my, mx );
+
+  EXPECT_NEAR( ref,         centerOfMassRad(   M.data(), R.data(), n ),   1.0e-12 );
+  EXPECT_NEAR( ref,         centerOfMassRadPM( M.data(), R.data(), n ),   1.0e-12 );
+  EXPECT_NEAR( ref,         centerOfMassRad(   M4.data(), R4.data(), n ), 1.0e-4 );
+  EXPECT_NEAR( ref,         centerOfMassRadPM( M4.data(), R4.data(), n ), 1.0e-4 );
+
+  // ----- a bearing west of north wraps differently in the two ranges -------------------
+  real8_t W[] = { 1.0, 1.0 };
+  real8_t X[] = { -0.2, -0.4 };
+  EXPECT_NEAR( D_2PI - 0.3, centerOfMassRad(   W, X, 2 ), 1.0e-15 );
+  EXPECT_NEAR( -0.3,        centerOfMassRadPM( W, X, 2 ), 1.0e-15 );
+
+  real8_t Z[] = { 0.0, 0.0 };
+  EXPECT_DOUBLE_EQ( 0.0, centerOfMassRad( Z, X, 2 ) );
+}
+
+
+TEST( test_rad_com, out_of_range ) {
+  const size_t n = 1000;
+  std::vector<real8_t> M( n ), R( n ), B( n );
+  std::vector<real4_t> M4( n ), B4( n );
+  real8_t mx = 0.0, my = 0.0, fx = 0.0, fy = 0.0;
+  for ( size_t i=0; i<n; i++ ) {
+    M[i]  = 1.0 + static_cast<real8_t>( i % 7 );
+    R[i]  = 2.5 + 0.9 * std::sin( static_cast<real8_t>( i ) );
+    B[i]  = R[i] + D_2PI * 1.0e9;
+    M4[i] = static_cast<real4_t>( M[i] );
+    B4[i] = static_cast<real4_t>( B[i] );
+    mx += M[i] * std::cos( B[i] );
+    my += M[i] * std::sin( B[i] );
+    fx += M[i] * std::cos( static_cast<real8_t>( B4[i] ) );
+    fy += M[i] * std::sin( static_cast<real8_t>( B4[i] ) );
+  }
+  EXPECT_FALSE( summation::sinCosRange( B[0] ) );
+  EXPECT_FALSE( summation::sinCosRange( B4[0] ) );
+
+  EXPECT_NEAR( std::atan2( my, mx ), centerOfMassRadPM( M.data(),  B.data(),  n ), 1.0e-12 );
+  EXPECT_NEAR( std::atan2( fy, fx ), centerOfMassRadPM( M4.data(), B4.data(), n ), 1.0e-4 );
+
+  std::vector<size_t> offset = { 0, 500, 1000 };
+  real8_t C[2];
+  EXPECT_FALSE( centerOfMassRadPM( C, M.data(), B.data(), offset.data(), 2 ) );
+  EXPECT_DOUBLE_EQ( centerOfMassRadPM( M.data(),     B.data(),     500 ), C[0] );
+  EXPECT_DOUBLE_EQ( centerOfMassRadPM( M.data()+500, B.data()+500, 500 ), C[1] );
+
+  // ----- NaN propagates ----------------------------------------------------------------
+  real8_t s, c;
+  summation::sinCos( std::numeric_limits<real8_t>::quiet_NaN(), s, c );
+  EXPECT_TRUE( std::isnan( s ) );
+  EXPECT_TRUE( std::isnan( c ) );
+}
+
+
+TEST( test_rad_com, segmented ) {
+  const size_t nseg = 500;
+  std::vector<size_t> offset( nseg+1 );
+  offset[0] = 0;
+  for ( size_t k=0; k<nseg; k++ ) {
+    const size_t len = ( 0 == k % 50 ) ? 0 : ( ( 7 == k ) ? 40000 : ( k * 13 ) % 311 );
+    offset[k+1] = offset[k] + len;
+  }
+  const size_t n = offset[nseg];
+  ASSERT_GT( n, summation::PARALLEL_MIN );
+
+  std::vector<real8_t> M( n ), R( n ), C( nseg ), P( nseg );
+  std::vector<real4_t> M4( n ), R4( n ), C4( nseg );
+  for ( size_t i=0; i<n; i++ ) {
+    M[i]  = 0.5 + static_cast<real8_t>( i % 5 );
+    R[i]  = 6.0 * std::fabs( std::sin( 0.37 * static_cast<real8_t>( i ) ) );
+    M4[i] = static_cast<real4_t>( M[i] );
+    R4[i] = static_cast<real4_t>( R[i] );
+  }
+
+  EXPECT_FALSE( centerOfMassRad(   C.data(),  M.data(),  R.data(),  offset.data(), nseg ) );
+  EXPECT_FALSE( centerOfMassRadPM( P.data(),  M.data(),  R.data(),  offset.data(), nseg ) );
+  EXPECT_FALSE( centerOfMassRad(   C4.data(), M4.data(), R4.data(), offset.data(), nseg ) );
+
+  for ( size_t k=0; k<nseg; k++ ) {
+    const size_t len = offset[k+1] - offset[k];
+    EXPECT_DOUBLE_EQ( centerOfMassRad(   M.data()+offset[k], R.data()+offset[k], len ), C[k] );
+    EXPECT_DOUBLE_EQ( centerOfMassRadPM( M.data()+offset[k], R.data()+offset[k], len ), P[k] );
+    EXPECT_FLOAT_EQ(  centerOfMassRad(   M4.data()+offset[k], R4.data()+offset[k], len ), C4[k] );
+  }
+  EXPECT_DOUBLE_EQ( 0.0, C[0] );
+  EXPECT_DOUBLE_EQ( 0.0, C[50] );
+
+  std::swap( offset[10], offset[11] );
+  if ( offset[10] != offset[11] ) {
+    EXPECT_TRUE( centerOfMassRad( C.data(), M.data(), R.data(), offset.data(), nseg ) );
+  }
+  EXPECT_FALSE( centerOfMassRad( C.data(), M.data(), R.data(), offset.data(), 0 ) );
+}
+
+
 // =======================================================================================
 // **                           U T E S T _ S U M M A T I O N                           **
 // ======================================================================== END FILE =====
@@ -0,0 +1,193 @@
+// ====================================================================== BEGIN FILE =====
+// **                               U T E S T _ O R R E Y                               **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Automated testing for the Orrey.
+ *  @file   utest_orrey.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides automated testing for the Orrey.
+ */
+// =======================================================================================
+
+#include <limits.h>
+#include <gtest/gtest.h>
+#include <astro/Orrey.hh>
+#include <Dice.hh>
+#include <cmath>
+
+namespace {
+
+const real8_t AU = 1.495978707e11;
+const real8_t J2000 = 2451545.0;
+
+
+// =======================================================================================
+TEST( test_orrey, constants ) {
+  // -------------------------------------------------------------------------------------
+  Orrey orrey;
+
+  EXPECT_DOUBLE_EQ( 1.32712440018e20, orrey.mu( SUN ) );
+  EXPECT_DOUBLE_EQ( 3.986004418e14,   orrey.mu( EARTH ) );
+  EXPECT_DOUBLE_EQ( 7.1492e7,         orrey.radius( JUPITER ) );
+
+  EXPECT_DOUBLE_EQ( D_ZERO, orrey.mu( static_cast<planet_e>( 12 ) ) );
+
+  real8_t st[6];
+  EXPECT_EQ( 1, orrey.state( static_cast<planet_e>( 11 ), J2000, st ) );
+  EXPECT_EQ( 0, orrey.state( SUN, J2000, st ) );
+  for ( int32_t i=0; i<6; i++ ) {
+    EXPECT_DOUBLE_EQ( D_ZERO, st[i] );
+  }
+}
+
+
+// =======================================================================================
+TEST( test_orrey, earth ) {
+  // -------------------------------------------------------------------------------------
+  Orrey   orrey;
+  real8_t st[6];
+
+  // ----- Earth-Moon barycenter at J2000.0 -----------------
+  EXPECT_EQ( 0, orrey.state( EARTH, st ) );
+  EXPECT_NEAR( -0.1771, st[0] / AU, 1.0e-3 );
+  EXPECT_NEAR(  0.9672, st[1] / AU, 1.0e-3 );
+  EXPECT_NEAR(  0.0,    st[2] / AU, 1.0e-5 );
+
+  const real8_t v = std::sqrt( st[3]*st[3] + st[4]*st[4] + st[5]*st[5] );
+  EXPECT_NEAR( 30.29e3, v, 0.05e3 );
+
+  // ----- one sidereal year later --------------------------
+  real8_t s2[6];
+  orrey.setEpoch( J2000 + 365.25636 );
+  orrey.state( EARTH, s2 );
+  for ( int32_t i=0; i<3; i++ ) {
+    EXPECT_NEAR( st[i] / AU, s2[i] / AU, 1.0e-4 );
+  }
+}
+
+
+// =======================================================================================
+TEST( test_orrey, energy ) {
+  // -------------------------------------------------------------------------------------
+  Orrey   orrey;
+  real8_t st[6];
+  const real8_t gm = orrey.mu( SUN );
+  const real8_t sma[] = { 0.0, 0.38709927, 0.72333566, 1.00000261, 1.52371034,
+                          5.20288700, 9.53667594, 19.18916464, 30.06992276, 39.48211675 };
+
+  for ( int32_t p=1; p<Orrey::NUM_BODY; p++ ) {
+    orrey.state( static_cast<planet_e>(p), J2000, st );
+    const real8_t r  = std::sqrt( st[0]*st[0] + st[1]*st[1] + st[2]*st[2] );
+    const real8_t v2 = st[3]*st[3] + st[4]*st[4] + st[5]*st[5];
+    const real8_t a  = -D_HALF * gm / ( D_HALF*v2 - gm/r );
+    EXPECT_NEAR( D_ONE, a / ( sma[p]*AU ), 5.0e-3 );
+  }
+}
+
+
+// =======================================================================================
+TEST( test_orrey, cache ) {
+  // -------------------------------------------------------------------------------------
+  Orrey orrey;
+  Dice* dd = Dice::TestDice();
+
+  const real8_t jd0 = J2000;
+  const real8_t jd1 = J2000 + 30.0*365.25;
+
+  EXPECT_TRUE(  orrey.cache( jd1, jd0 ) );
+  EXPECT_FALSE( orrey.cached( jd0 ) );
+  EXPECT_FALSE( orrey.cache( jd0, jd1 ) );
+  EXPECT_TRUE(  orrey.cached( jd0 ) );
+  EXPECT_TRUE(  orrey.cached( jd1 ) );
+  EXPECT_FALSE( orrey.cached( jd1 + D_ONE ) );
+
+  real8_t a[6], b[6];
+  for ( int32_t p=1; p<Orrey::NUM_BODY; p++ ) {
+    const planet_e planet = static_cast<planet_e>(p);
+    for ( int32_t i=0; i<200; i++ ) {
+      const real8_t jd = jd0 + dd->uniform()*( jd1 - jd0 );
+      EXPECT_EQ( 0, orrey.state( planet, jd, a ) );
+      EXPECT_EQ( 0, orrey.kepler( planet, jd, b ) );
+      const real8_t r = std::sqrt( b[0]*b[0] + b[1]*b[1] + b[2]*b[2] );
+      const real8_t v = std::sqrt( b[3]*b[3] + b[4]*b[4] + b[5]*b[5] );
+      for ( int32_t k=0; k<3; k++ ) {
+        EXPECT_NEAR( b[k],   a[k],   r*1.0e-10 );
+        EXPECT_NEAR( b[k+3], a[k+3], v*1.0e-8 );
+      }
+    }
+  }
+
+}
+
+
+// =======================================================================================
+TEST( test_orrey, batch ) {
+  // -------------------------------------------------------------------------------------
+  Orrey orrey;
+  Dice* dd = Dice::TestDice();
+
+  const int32_t n   = 300;
+  const real8_t jd0 = J2000 + 1000.0;
+  const real8_t jd1 = J2000 + 4000.0;
+  orrey.cache( jd0, jd1 );
+
+  real8_t jd[n];
+  real8_t S[n*6];
+  for ( int32_t i=0; i<n; i++ ) {
+    // ----- some dates fall outside of the cache ----------
+    jd[i] = jd0 - 500.0 + dd->uniform()*( jd1 - jd0 + 1000.0 );
+  }
+  // ----- the end of the cache, and dates whose segment index overflows int32_t ---
+  jd[0] = jd1;
+  jd[1] = J2000 + 1.0e12;
+  jd[2] = J2000 - 1.0e12;
+
+  for ( int32_t p=0; p<Orrey::NUM_BODY; p++ ) {
+    const planet_e planet = static_cast<planet_e>(p);
+    EXPECT_EQ( 0, orrey.state( planet, jd, n, S ) );
+    for ( int32_t i=0; i<n; i++ ) {
+      real8_t st[6];
+      orrey.state( planet, jd[i], st );
+      for ( int32_t k=0; k<6; k++ ) {
+        if ( std::isnan( st[k] ) ) {
+          EXPECT_TRUE( std::isnan( S[i*6+k] ) );
+        } else {
+          EXPECT_NEAR( st[k], S[i*6+k], std::fabs( st[k] )*1.0e-12 + 1.0e-6 );
+        }
+      }
+    }
+  }
+
+}
+
+  
+} // end namespace
+
+
+// =======================================================================================
+// **                               U T E S T _ O R R E Y                               **
+// ======================================================================== END FILE =====
@@ -0,0 +1,268 @@
+// ====================================================================== BEGIN FILE =====
+// **                              U T E S T _ D O P R I 5                              **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Automated testing for DOPRI5.
+ *  @file   utest_dopri5.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides automated testing for the adaptive Dormand-Prince integrator.
+ */
+// =======================================================================================
+
+#include <limits.h>
+#include <DOPRI5.hh>
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace {
+
+
+// =======================================================================================
+class Decay : public DOPRI5 {
+  // -------------------------------------------------------------------------------------
+ public:
+  Decay( void ) : DOPRI5(1) {};
+  virtual ~Decay( void ) {};
+  virtual int  check( real8_t*, real8_t, real8_t* ) { return 0; }
+  virtual void difeq( real8_t* Qd, real8_t* Q, real8_t, real8_t* P ) { Qd[0] = -P[0]*Q[0]; }
+}; // end class Decay
+
+
+// =======================================================================================
+/** Harmonic oscillator x'' = -w^2 x, state (x, v), P[0] = w. Optionally stop when x
+ *  exceeds P[1].
+ */
+class Spring : public DOPRI5 {
+  // -------------------------------------------------------------------------------------
+ public:
+  Spring( void ) : DOPRI5(2) {};
+  virtual ~Spring( void ) {};
+  virtual int  check( real8_t* Q, real8_t, real8_t* P ) { return ( Q[0] > P[1] ) ? 1 : 0; }
+  virtual void difeq( real8_t* Qd, real8_t* Q, real8_t, real8_t* P ) {
+    Qd[0] = Q[1];
+    Qd[1] = -P[0]*P[0]*Q[0];
+  }
+}; // end class Spring
+
+
+// =======================================================================================
+/** Spring with a vectorised block derivative.
+ */
+class SpringBlock : public Spring {
+  // -------------------------------------------------------------------------------------
+ public:
+  SpringBlock( void ) : Spring() {};
+  virtual ~SpringBlock( void ) {};
+  virtual void difeqBlock( real8_t* Qd, real8_t* Q, int32_t n, real8_t, real8_t* P ) {
+    const real8_t w2 = P[0]*P[0];
+    for ( int32_t m=0; m<n; m++ ) {
+      Qd[m]   = Q[n+m];
+      Qd[n+m] = -w2*Q[m];
+    }
+  }
+}; // end class SpringBlock
+
+
+// =======================================================================================
+/** Ballistic flight, state (height, speed). The event is the return to the ground.
+ */
+class Flight : public DOPRI5 {
+  // -------------------------------------------------------------------------------------
+ public:
+  Flight( void ) : DOPRI5(2) {};
+  virtual ~Flight( void ) {};
+  virtual int     check( real8_t*, real8_t, real8_t* ) { return 0; }
+  virtual real8_t event( real8_t* Q, real8_t, real8_t* ) { return Q[0]; }
+  virtual void    difeq( real8_t* Qd, real8_t* Q, real8_t, real8_t* P ) {
+    Qd[0] = Q[1];
+    Qd[1] = -P[0] - P[1]*Q[1];
+  }
+}; // end class Flight
+
+
+// =======================================================================================
+TEST( test_dopri5, decay ) {
+  // -------------------------------------------------------------------------------------
+  Decay   I;
+  real8_t P[] = { 1.5 };
+  real8_t Q[] = { 2.0 };
+
+  I.tolerance( 1.0e-10, 1.0e-12 );
+  EXPECT_DOUBLE_EQ( 5.0, I.integrate( Q, 0.0, 5.0, P ) );
+  EXPECT_NEAR( 2.0*exp(-7.5), Q[0], 1.0e-10 );
+  EXPECT_LT( I.nAccept(), 200 );
+  EXPECT_EQ( 6*(I.nAccept() + I.nReject()) + 2, I.nEval() );
+
+  // ----- backwards ----------------------------------------------------------------------
+  EXPECT_DOUBLE_EQ( 0.0, I.integrate( Q, 5.0, 0.0, P ) );
+  EXPECT_NEAR( 2.0, Q[0], 1.0e-8 );
+
+  // ----- the fixed step RK4 is still available ------------------------------------------
+  Q[0] = 2.0;
+  I.integrate( Q, 0.0, 5.0, 1000, P );
+  EXPECT_NEAR( 2.0*exp(-7.5), Q[0], 1.0e-9 );
+}
+
+
+// =======================================================================================
+TEST( test_dopri5, dense ) {
+  // -------------------------------------------------------------------------------------
+  Spring  I;
+  real8_t P[] = { 2.0, 1.0e9 };
+  real8_t Q[] = { 1.0, 0.0 };
+
+  const int32_t nout = 201;
+  std::vector<real8_t> tout( nout );
+  std::vector<real8_t> Qout( 2*nout, -99.0 );
+  for ( int32_t k=0; k<nout; k++ ) {
+    tout[k] = 10.0 * static_cast<real8_t>(k) / static_cast<real8_t>(nout-1);
+  }
+
+  I.tolerance( 1.0e-10, 1.0e-10 );
+  EXPECT_DOUBLE_EQ( 10.0, I.integrate( Q, 0.0, 10.0, P, tout.data(), nout, Qout.data() ) );
+  EXPECT_LT( I.nAccept(), 1000 );
+
+  for ( int32_t k=0; k<nout; k++ ) {
+    EXPECT_NEAR(  cos( 2.0*tout[k] ),     Qout[2*k],   1.0e-7 );
+    EXPECT_NEAR( -2.0*sin( 2.0*tout[k] ), Qout[2*k+1], 1.0e-7 );
+  }
+  EXPECT_NEAR( cos( 20.0 ), Q[0], 1.0e-8 );
+}
+
+
+// =======================================================================================
+TEST( test_dopri5, check ) {
+  // -------------------------------------------------------------------------------------
+  Spring  I;
+  real8_t P[] = { 1.0, 0.5 };
+  real8_t Q[] = { 0.0, 1.0 };
+
+  I.limits( 0.01, 0.01, 100000 );
+  const real8_t t = I.integrate( Q, 0.0, 10.0, P );
+  EXPECT_GT( Q[0], 0.5 );
+  EXPECT_NEAR( asin( 0.5 ), t, 0.011 );
+}
+
+
+// =======================================================================================
+TEST( test_dopri5, event ) {
+  // -------------------------------------------------------------------------------------
+  Flight  I;
+  real8_t P[] = { 9.81, 0.0 };
+  real8_t Q[] = { 0.0, 10.0 };
+
+  const real8_t t = I.integrate( Q, 0.0, 100.0, P );
+  EXPECT_NEAR( 20.0/9.81, t, 1.0e-10 );
+  EXPECT_NEAR( 0.0,   Q[0], 1.0e-9 );
+  EXPECT_NEAR( -10.0, Q[1], 1.0e-6 );
+
+  // ----- no event before the final time -------------------------------------------------
+  Q[0] = 0.0;
+  Q[1] = 10.0;
+  EXPECT_DOUBLE_EQ( 1.0, I.integrate( Q, 0.0, 1.0, P ) );
+  EXPECT_NEAR( 10.0 - 0.5*9.81, Q[0], 1.0e-9 );
+}
+
+
+// =======================================================================================
+TEST( test_dopri5, ensemble ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t n = 1000;
+  real8_t P[] = { 3.0, 1.0e9 };
+
+  std::vector<real8_t> Q0( 2*n );
+  for ( int32_t m=0; m<n; m++ ) {
+    const real8_t a = 0.5 + static_cast<real8_t>( m % 17 );
+    const real8_t f = 0.01 * static_cast<real8_t>( m );
+    Q0[m]   =  a*cos( f );
+    Q0[n+m] = -3.0*a*sin( f );
+  }
+
+  Spring      I;
+  SpringBlock J;
+  I.tolerance( 1.0e-10, 1.0e-10 );
+  J.tolerance( 1.0e-10, 1.0e-10 );
+
+  std::vector<real8_t> QI( Q0 );
+  std::vector<real8_t> QJ( Q0 );
+  EXPECT_DOUBLE_EQ( 4.0, I.ensemble( QI.data(), n, 0.0, 4.0, P ) );
+  EXPECT_DOUBLE_EQ( 4.0, J.ensemble( QJ.data(), n, 0.0, 4.0, P ) );
+
+  for ( int32_t m=0; m<n; m++ ) {
+    const real8_t a = 0.5 + static_cast<real8_t>( m % 17 );
+    const real8_t f = 0.01 * static_cast<real8_t>( m );
+    EXPECT_NEAR(  a*cos( 12.0 + f ),     QI[m],   1.0e-7*a );
+    EXPECT_NEAR( -3.0*a*sin( 12.0 + f ), QI[n+m], 3.0e-7*a );
+    EXPECT_DOUBLE_EQ( QI[m],   QJ[m] );
+    EXPECT_DOUBLE_EQ( QI[n+m], QJ[n+m] );
+  }
+}
+
+
+
+// =======================================================================================
+TEST( test_dopri5, ensemble_max_step ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t n = 200;
+  real8_t P[] = { 3.0, 1.0e9 };
+
+  std::vector<real8_t> Q( 2*n );
+  for ( int32_t m=0; m<n; m++ ) {
+    const real8_t a = 0.5 + static_cast<real8_t>( m % 17 );
+    Q[m]   = a;
+    Q[n+m] = 0.0;
+  }
+
+  Spring I;
+  I.tolerance( 1.0e-10, 1.0e-10 );
+  I.limits( 0.0, 0.0, 5 );
+
+  std::vector<real8_t> T( n );
+  const real8_t tr = I.ensemble( Q.data(), n, 0.0, 4.0, P, T.data() );
+  EXPECT_LT( 0.0, tr );
+  EXPECT_GT( 4.0, tr );
+
+  for ( int32_t m=0; m<n; m++ ) {
+    const real8_t a = 0.5 + static_cast<real8_t>( m % 17 );
+    EXPECT_LE( tr,  T[m] );
+    EXPECT_GT( 4.0, T[m] );
+    EXPECT_NEAR( a*cos( 3.0*T[m] ), Q[m], 1.0e-7*a );
+  }
+
+  // ----- backwards ---------------------------------------------------------------------
+  const real8_t tb = I.ensemble( Q.data(), n, 0.0, -4.0, P );
+  EXPECT_GT( 0.0,  tb );
+  EXPECT_LT( -4.0, tb );
+}
+
+} // end namespace
+
+
+// =======================================================================================
+// **                              U T E S T _ D O P R I 5                              **
+// ======================================================================== END FILE =====
@@ -0,0 +1,124 @@
+// ====================================================================== BEGIN FILE =====
+// **                            U T E S T _ P R O F I L E R                            **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Automated testing for StopWatch and Profiler.
+ *  @file   utest_profiler.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides automated testing for the wall clock StopWatch and the profiling zones.
+ */
+// =======================================================================================
+
+
+#include <Profiler.hh>
+#include <thread>
+#include <sstream>
+#include "gtest/gtest.h"
+
+
+namespace {
+
+
+// =======================================================================================
+void nap( int32_t us ) {
+  // -------------------------------------------------------------------------------------
+  PROFILE_ZONE( "utest_nap" );
+  std::this_thread::sleep_for( std::chrono::microseconds( us ) );
+}
+
+
+// =======================================================================================
+TEST( test_profiler, stopwatch ) {
+  // -------------------------------------------------------------------------------------
+  StopWatch SW;
+  SW.reset();
+  std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+  const real8_t wall = SW.check();
+  const real8_t cpu  = SW.cpu();
+
+  EXPECT_GE( wall, 0.019 );
+  EXPECT_LT( cpu,  wall );
+
+  const u_int64_t a = StopWatch::nanoseconds();
+  const u_int64_t b = StopWatch::nanoseconds();
+  EXPECT_LE( a, b );
+  EXPECT_LT( 0u, StopWatch::cycles() );
+}
+
+
+// =======================================================================================
+TEST( test_profiler, stopwatch_cpu_start ) {
+  // -------------------------------------------------------------------------------------
+  const clock_t   c0   = clock();
+  volatile real8_t sink = 0.0;
+  while ( ( clock() - c0 ) < ( CLOCKS_PER_SEC / 5 ) ) { sink = sink + 1.0; }
+
+  StopWatch SW;
+  EXPECT_LT( SW.cpu(), 0.1 );
+}
+
+
+// =======================================================================================
+TEST( test_profiler, zones ) {
+  // -------------------------------------------------------------------------------------
+  Profiler::reset();
+
+  std::thread T( []( void ) { for ( int32_t i=0; i<3; i++ ) { nap( 200 ); } } );
+  for ( int32_t i=0; i<5; i++ ) { nap( 100 ); }
+  T.join();
+
+  int32_t id = -1;
+  for ( int32_t z=0; z<Profiler::zones(); z++ ) {
+    if ( 0 == strcmp( "utest_nap", Profiler::name( z ) ) ) { id = z; }
+  }
+  ASSERT_LE( 0, id );
+  EXPECT_EQ( id, Profiler::zone( "utest_nap" ) );
+
+  const Profiler::stat S = Profiler::total( id );
+  EXPECT_EQ( 8u, S.count );
+  EXPECT_GE( S.min_ns, 100000u );
+  EXPECT_GE( S.max_ns, 200000u );
+  EXPECT_LE( S.min_ns * S.count, S.total_ns );
+  EXPECT_GE( S.max_ns * S.count, S.total_ns );
+
+  std::ostringstream oss;
+  Profiler::report( oss );
+  const std::string text = oss.str();
+  EXPECT_NE( std::string::npos, text.find( "utest_nap" ) );
+  EXPECT_NE( std::string::npos, text.find( "thread" ) );
+
+  Profiler::reset();
+  EXPECT_EQ( 0u, Profiler::total( id ).count );
+}
+
+
+} // end namespace
+
+
+// =======================================================================================
+// **                            U T E S T _ P R O F I L E R                            **
+// ======================================================================== END FILE =====
@@ -0,0 +1,168 @@
+// ====================================================================== BEGIN FILE =====
+// **                              U T E S T _ S Q U E U E                              **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Automated testing for the lock free queues and pipeline.
+ *  @file   utest_squeue.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides automated testing for SPSCQueue, MPMCQueue, Pipeline and SThreadCond.
+ */
+// =======================================================================================
+
+
+#include <SQueue.hh>
+#include <Pipeline.hh>
+#include <vector>
+#include "gtest/gtest.h"
+
+
+namespace {
+
+
+// =======================================================================================
+TEST( test_squeue, spsc ) {
+  // -------------------------------------------------------------------------------------
+  SPSCQueue<int64_t> Q( 100 );
+  EXPECT_EQ( 128u, Q.capacity() );
+
+  int64_t x = 0;
+  EXPECT_FALSE( Q.try_pop( x ) );
+  for ( int64_t i=0; i<128; i++ ) { EXPECT_TRUE( Q.try_push( i ) ); }
+  EXPECT_FALSE( Q.try_push( 999 ) );
+  EXPECT_EQ( 128u, Q.size() );
+  for ( int64_t i=0; i<128; i++ ) { Q.pop( x ); EXPECT_EQ( i, x ); }
+
+  // ----- ordered transfer between two threads ------------------------------------------
+  const int64_t n = 200000;
+  std::thread prod( [&Q, n]( void ) { for ( int64_t i=0; i<n; i++ ) { Q.push( i ); } } );
+
+  int64_t bad = 0;
+  for ( int64_t i=0; i<n; i++ ) { Q.pop( x ); if ( x != i ) { bad++; } }
+  prod.join();
+  EXPECT_EQ( 0, bad );
+}
+
+
+// =======================================================================================
+TEST( test_squeue, mpmc ) {
+  // -------------------------------------------------------------------------------------
+  MPMCQueue<int64_t> Q( 64 );
+  const int32_t np = 3;
+  const int32_t nc = 3;
+  const int64_t n  = 50000;
+
+  std::atomic<int64_t> total( 0 );
+  std::atomic<int64_t> taken( 0 );
+  std::vector<std::thread*> T;
+
+  for ( int32_t p=0; p<np; p++ ) {
+    T.push_back( new std::thread( [&Q, n]( void ) {
+          for ( int64_t i=1; i<=n; i++ ) { Q.push( i ); } } ) );
+  }
+  for ( int32_t c=0; c<nc; c++ ) {
+    T.push_back( new std::thread( [&Q, &total, &taken, np, n]( void ) {
+          int64_t x = 0;
+          int64_t s = 0;
+          while ( taken.fetch_add( 1 ) < np*n ) {
+            Q.pop( x );
+            s += x;
+          }
+          total.fetch_add( s );
+        } ) );
+  }
+  for ( size_t i=0; i<T.size(); i++ ) { T[i]->join(); delete T[i]; }
+
+  EXPECT_EQ( np * ( n*(n+1)/2 ), total.load() );
+  EXPECT_EQ( 0u, Q.size() );
+}
+
+
+// =======================================================================================
+TEST( test_squeue, pipeline ) {
+  // -------------------------------------------------------------------------------------
+  const int64_t n    = 10000;
+  int64_t       next = 0;
+  int64_t       sum  = 0;
+  int64_t       last = -1;
+  bool          fifo = true;
+
+  Pipeline<int64_t> job( 16 );
+  EXPECT_EQ( 1, job.run() );
+
+  job.source( [&next, n]( int64_t& x ) { if ( next >= n ) { return false; } x = next++; return true; } )
+     .stage ( []( int64_t& x ) { return ( 0 == ( x % 2 ) ); } )
+     .stage ( []( int64_t& x ) { x = x*x; return true; } )
+     .sink  ( [&sum, &last, &fifo]( int64_t& x ) {
+         if ( x <= last ) { fifo = false; }
+         last = x;
+         sum += x;
+       } );
+
+  EXPECT_EQ( 0, job.run() );
+  EXPECT_EQ( static_cast<u_int64_t>(n),   job.produced() );
+  EXPECT_EQ( static_cast<u_int64_t>(n/2), job.delivered() );
+  EXPECT_TRUE( fifo );
+
+  int64_t expect = 0;
+  for ( int64_t i=0; i<n; i+=2 ) { expect += i*i; }
+  EXPECT_EQ( expect, sum );
+}
+
+
+// =======================================================================================
+TEST( test_squeue, cond_wait ) {
+  // -------------------------------------------------------------------------------------
+  SMutex      M;
+  SThreadCond C;
+
+  M.lock();
+  EXPECT_TRUE( C.wait( M, 5 ) );
+  EXPECT_FALSE( M.trylock() );
+  M.unlock();
+
+  bool ready = false;
+  std::thread T( [&M, &C, &ready]( void ) {
+      M.lock();
+      ready = true;
+      C.signal();
+      M.unlock();
+    } );
+
+  M.lock();
+  while ( ! ready ) { C.wait( M, 1000 ); }
+  M.unlock();
+  T.join();
+  EXPECT_TRUE( ready );
+}
+
+
+} // end namespace
+
+
+// =======================================================================================
+// **                              U T E S T _ S Q U E U E                              **
+// ======================================================================== END FILE =====
@@ -0,0 +1,167 @@
+// ====================================================================== BEGIN FILE =====
+// **                          U T E S T _ T H R E A D P O O L                          **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Automated testing for the ThreadPool.
+ *  @file   utest_threadpool.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides automated testing for the work stealing thread pool.
+ */
+// =======================================================================================
+
+
+#include <ThreadPool.hh>
+#include <mathdef.hh>
+#include <stdexcept>
+#include "gtest/gtest.h"
+
+
+namespace {
+
+
+// =======================================================================================
+TEST( test_threadpool, submit ) {
+  // -------------------------------------------------------------------------------------
+  ThreadPool pool( 3 );
+  EXPECT_EQ( 3, pool.size() );
+
+  std::vector< std::future<int64_t> > fut;
+  for ( int64_t i=0; i<100; i++ ) {
+    fut.push_back( pool.submit( [i]( void ) { return i*i; } ) );
+  }
+
+  int64_t sum = 0;
+  for ( size_t i=0; i<fut.size(); i++ ) { sum += fut[i].get(); }
+  EXPECT_EQ( 328350, sum );
+
+  std::future<int32_t> bad = pool.submit( []( void ) -> int32_t {
+      throw std::runtime_error( "task" ); } );
+  EXPECT_THROW( bad.get(), std::runtime_error );
+}
+
+
+// =======================================================================================
+TEST( test_threadpool, parallel_for ) {
+  // -------------------------------------------------------------------------------------
+  ThreadPool pool( 4 );
+  const int64_t n = 100003;
+  std::vector<int32_t> hit( static_cast<size_t>(n), 0 );
+  int32_t* H = hit.data();
+
+  pool.parallel_for( 0, n, [H]( int64_t i0, int64_t i1 ) {
+      for ( int64_t i=i0; i<i1; i++ ) { H[i]++; }
+    }, 1000 );
+
+  int64_t bad = 0;
+  for ( int64_t i=0; i<n; i++ ) { if ( 1 != H[i] ) { bad++; } }
+  EXPECT_EQ( 0, bad );
+
+  // ----- nested loops run inside workers without deadlock ------------------------------
+  std::atomic<int64_t> count( 0 );
+  ThreadPool* pp = &pool;
+  pool.parallel_for( 0, 16, [pp, &count]( int64_t a0, int64_t a1 ) {
+      for ( int64_t a=a0; a<a1; a++ ) {
+        pp->parallel_for( 0, 64, [&count]( int64_t b0, int64_t b1 ) {
+            count.fetch_add( b1 - b0 );
+          }, 4 );
+      }
+    }, 1 );
+  EXPECT_EQ( 16*64, count.load() );
+}
+
+
+// =======================================================================================
+TEST( test_threadpool, parallel_for_throw ) {
+  // -------------------------------------------------------------------------------------
+  ThreadPool pool( 4 );
+  std::atomic<int64_t> done( 0 );
+
+  // ----- thrown on a worker ------------------------------------------------------------
+  EXPECT_THROW( pool.parallel_for( 0, 1000, [&done]( int64_t i0, int64_t i1 ) {
+        if ( ( 500 >= i0 ) && ( 500 < i1 ) ) { throw std::runtime_error( "worker" ); }
+        done.fetch_add( i1 - i0 );
+      }, 10 ), std::runtime_error );
+  EXPECT_GT( 1000, done.load() );
+
+  // ----- thrown on the calling thread --------------------------------------------------
+  EXPECT_THROW( pool.parallel_for( 0, 1000, []( int64_t i0, int64_t ) {
+        if ( 0 == i0 ) { throw std::logic_error( "caller" ); }
+      }, 10 ), std::logic_error );
+
+  // ----- the pool is still usable ------------------------------------------------------
+  done.store( 0 );
+  pool.parallel_for( 0, 1000, [&done]( int64_t i0, int64_t i1 ) {
+      done.fetch_add( i1 - i0 );
+    }, 10 );
+  EXPECT_EQ( 1000, done.load() );
+}
+
+
+// =======================================================================================
+TEST( test_threadpool, parallel_reduce ) {
+  // -------------------------------------------------------------------------------------
+  ThreadPool* pool = ThreadPool::global();
+  const int64_t n = 1000000;
+
+  const int64_t total = pool->parallel_reduce( 0, n, static_cast<int64_t>(0),
+      []( int64_t i0, int64_t i1 ) {
+        int64_t s = 0;
+        for ( int64_t i=i0; i<i1; i++ ) { s += i; }
+        return s;
+      },
+      []( int64_t a, int64_t b ) { return a + b; } );
+  EXPECT_EQ( n*(n-1)/2, total );
+
+  // ----- ordered combination: same floating point result for any grain --------------
+  const real8_t a = pool->parallel_reduce( 0, n, D_ZERO,
+      []( int64_t i0, int64_t i1 ) {
+        real8_t s = D_ZERO;
+        for ( int64_t i=i0; i<i1; i++ ) { s += D_ONE / static_cast<real8_t>(i+1); }
+        return s;
+      },
+      []( real8_t x, real8_t y ) { return x + y; }, 4096 );
+  const real8_t b = pool->parallel_reduce( 0, n, D_ZERO,
+      []( int64_t i0, int64_t i1 ) {
+        real8_t s = D_ZERO;
+        for ( int64_t i=i0; i<i1; i++ ) { s += D_ONE / static_cast<real8_t>(i+1); }
+        return s;
+      },
+      []( real8_t x, real8_t y ) { return x + y; }, 4096 );
+  EXPECT_DOUBLE_EQ( a, b );
+  EXPECT_NEAR( 14.392726722864, a, 1.0e-9 );
+
+  EXPECT_EQ( 7, pool->parallel_reduce( 5, 5, 7, []( int64_t, int64_t ) { return 0; },
+                                       []( int32_t x, int32_t y ) { return x + y; } ) );
+}
+
+
+} // end namespace
+
+
+// =======================================================================================
+// **                          U T E S T _ T H R E A D P O O L                          **
+// ======================================================================== END FILE =====
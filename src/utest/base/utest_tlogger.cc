@@ -0,0 +1,163 @@
+// ====================================================================== BEGIN FILE =====
+// **                             U T E S T _ T L O G G E R                             **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Automated testing for the TLogger.
+ *  @file   utest_tlogger.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides automated testing for the asynchronous TLogger backend.
+ */
+// =======================================================================================
+
+
+#include <TLogger.hh>
+#include <thread>
+#include <cstring>
+#include <unistd.h>
+#include "gtest/gtest.h"
+
+
+namespace {
+
+
+// =======================================================================================
+// ---------------------------------------------------------------------------------------
+int32_t count_lines( const char* fspc, const char* key ) {
+  // -------------------------------------------------------------------------------------
+  char  line[1024];
+  int32_t n  = 0;
+  FILE* fp = fopen( fspc, "r" );
+  if ( static_cast<FILE*>(0) == fp ) { return -1; }
+  while ( static_cast<char*>(0) != fgets( line, 1024, fp ) ) {
+    if ( static_cast<char*>(0) != strstr( line, key ) ) { n++; }
+  }
+  fclose( fp );
+  return n;
+}
+
+
+// =======================================================================================
+TEST( test_tlogger, async ) {
+  // -------------------------------------------------------------------------------------
+  const char*   fspc = "/tmp/utest_tlogger_async.log";
+  const int32_t nthr = 4;
+  const int32_t nmsg = 500;
+
+  unlink( fspc );
+
+  TLogger* logger = TLogger::getInstance();
+  logger->setConsoleLevel( TLogger::CRITICAL );
+  logger->setLogfile( fspc, TLogger::INFO );
+  EXPECT_TRUE(  logger->setAsync( true, 0 ) );
+  EXPECT_FALSE( logger->isAsync() );
+  EXPECT_FALSE( logger->setAsync( true, 4096 ) );
+  EXPECT_TRUE(  logger->isAsync() );
+  EXPECT_TRUE(  logger->setAsync( true, 1 ) );
+  EXPECT_TRUE(  logger->isAsync() );
+
+  std::thread* T[nthr];
+  for ( int32_t t=0; t<nthr; t++ ) {
+    T[t] = new std::thread( [logger, t]() {
+        for ( int32_t i=0; i<nmsg; i++ ) {
+          logger->info( "worker %d message %d", t, i );
+        }
+      } );
+  }
+  for ( int32_t t=0; t<nthr; t++ ) { T[t]->join(); delete T[t]; }
+
+  logger->debug( "not written %d", 1 );
+  logger->flush();
+
+  EXPECT_EQ( 0u, logger->dropped() );
+  EXPECT_EQ( nthr*nmsg, count_lines( fspc, "**I** worker" ) );
+  EXPECT_EQ( 0,         count_lines( fspc, "not written" ) );
+
+  // ----- a small ring drops instead of blocking ----------------------------------------
+
+  EXPECT_FALSE( logger->setAsync( true, 2 ) );
+  for ( int32_t i=0; i<nmsg; i++ ) {
+    logger->info( "burst %d", i );
+  }
+  logger->flush();
+  const int32_t kept = count_lines( fspc, "**I** burst" );
+  EXPECT_EQ( static_cast<u_int64_t>(nmsg), logger->dropped() + static_cast<u_int64_t>(kept) );
+
+  EXPECT_FALSE( logger->setAsync( false ) );
+  EXPECT_FALSE( logger->isAsync() );
+
+  TLogger::delInstance();
+  unlink( fspc );
+}
+
+
+// =======================================================================================
+TEST( test_tlogger, deferred ) {
+  // -------------------------------------------------------------------------------------
+  const char* fspc = "/tmp/utest_tlogger_deferred.log";
+
+  unlink( fspc );
+
+  TLogger* logger = TLogger::getInstance();
+  logger->setConsoleLevel( TLogger::CRITICAL );
+  logger->setLogfile( fspc, TLogger::INFO );
+
+  int32_t evaluated = 0;
+  TLOG_DEBUG( logger, "filtered %d", ++evaluated );
+  EXPECT_EQ( 0, evaluated );
+
+  // ----- synchronous path --------------------------------------------------------------
+  TLOG_INFO( logger, "sync %d %s %.2f", 7, "seven", 7.0 );
+  EXPECT_EQ( 1, count_lines( fspc, "**I** sync 7 seven 7.00 (" ) );
+
+  // ----- deferred path, strings are copied at the call ---------------------------------
+  EXPECT_FALSE( logger->setAsync( true, 64 ) );
+  {
+    char scratch[32];
+    strcpy( scratch, "copied" );
+    TLOG_INFO( logger, "deferred %d %s %s %c", 42, scratch, static_cast<char*>(0), 'x' );
+    strcpy( scratch, "clobbered" );
+  }
+  TLOG_INFO( logger, "plain" );
+  logger->flush();
+
+  EXPECT_EQ( 1, count_lines( fspc, "**I** deferred 42 copied (null) x (" ) );
+  EXPECT_EQ( 1, count_lines( fspc, "**I** plain (" ) );
+  EXPECT_EQ( 3, count_lines( fspc, "utest_tlogger.cc:" ) );
+
+  EXPECT_FALSE( logger->setAsync( false ) );
+
+  TLogger::delInstance();
+  unlink( fspc );
+}
+
+
+} // end namespace
+
+
+// =======================================================================================
+// **                             U T E S T _ T L O G G E R                             **
+// ======================================================================== END FILE =====
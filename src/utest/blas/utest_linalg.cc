@@ -631,6 +631,43 @@ TEST( test_linalg_covariance, three ) {
 }
 
 
+// =======================================================================================
+TEST( test_linalg_covariance, stream ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t NS = 1037;
+  const int32_t NV = 5;
+
+  Dice* dd = Dice::TestDice();
+
+  Table tab( NS, NV );
+  for ( int32_t i=0; i<NS; i++ ) {
+    const real8_t a = dd->normal();
+    for ( int32_t j=0; j<NV; j++ ) {
+      tab(i,j) = 1.0e3 + static_cast<real8_t>(j+1) * ( a + dd->normal() );
+    }
+  }
+
+  real8_t mu1[NV];
+  real8_t mu2[NV];
+  Matrix  cov1;
+  Matrix  cov2;
+
+  tab.mean( mu1, NV, 0 );
+  covariance( cov1, tab, mu1 );
+
+  // ----- odd block size forces a partial last block ------------------------------------
+  streamCovariance( cov2, mu2, tab, 100 );
+
+  for ( int32_t i=0; i<NV; i++ ) {
+    EXPECT_NEAR( mu1[i], mu2[i], 1.0e-10 );
+    for ( int32_t j=0; j<NV; j++ ) {
+      EXPECT_NEAR( cov1.get(i,j), cov2.get(i,j), 1.0e-10 );
+      EXPECT_DOUBLE_EQ( cov2.get(i,j), cov2.get(j,i) );
+    }
+  }
+}
+
+
 // =======================================================================================
 TEST( test_linalg_lapack, svd ) {
   // -------------------------------------------------------------------------------------
@@ -961,6 +998,56 @@ TEST( test_linalg_table, rotate ) {
 }
 
 
+
+// =======================================================================================
+TEST( test_linalg_pca, truncated ) {
+  // -------------------------------------------------------------------------------------
+  Dice* dd = Dice::TestDice();
+
+  const int32_t NS = 5000;
+  const int32_t NV = 12;
+  const int32_t NK = 3;
+
+  const real8_t SIG[NK] = { 9.0, 5.0, 3.0 };
+
+  Table data( NS, NV );
+  for ( int32_t i=0; i<NS; i++ ) {
+    real8_t z[NK];
+    for ( int32_t k=0; k<NK; k++ ) {
+      z[k] = SIG[k] * dd->normal();
+    }
+    for ( int32_t j=0; j<NV; j++ ) {
+      real8_t x = 2.0 + 0.1*dd->normal();
+      for ( int32_t k=0; k<NK; k++ ) {
+        x += z[k] * cos( static_cast<real8_t>( (k+1)*(j+1) ) );
+      }
+      data(i,j) = x;
+    }
+  }
+
+  PCA full;
+  PCA part;
+
+  EXPECT_EQ( 0, full.fromSamples( data ) );
+  EXPECT_EQ( 0, part.fromSamples( data, NK ) );
+
+  Table rfull, rpart;
+  full.transform( rfull, data );
+  part.transform( rpart, data, 333 );
+
+  EXPECT_EQ( NS, size( rpart, 0 ) );
+  EXPECT_EQ( NK, size( rpart, 1 ) );
+
+  // ----- projections agree up to the sign of each axis ---------------------------------
+  for ( int32_t k=0; k<NK; k++ ) {
+    const real8_t sgn = ( D_ZERO < rfull.get(0,k) * rpart.get(0,k) ) ? D_ONE : -D_ONE;
+    for ( int32_t i=0; i<NS; i+=97 ) {
+      EXPECT_NEAR( rfull.get(i,k), sgn*rpart.get(i,k), 1.0e-6 * SIG[0] );
+    }
+  }
+}
+
+
 } // end namespace
 
 
@@ -0,0 +1,143 @@
+// ====================================================================== BEGIN FILE =====
+// **                            U T E S T _ C S V T A B L E                            **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Automated testing for CSVTable.
+ *  @file   utest_csvtable.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides automated testing for the columnar CSV reader.
+ */
+// =======================================================================================
+
+#include <limits.h>
+#include <CSVTable.hh>
+#include <CSVFile.hh>
+#include <fstream>
+#include <cmath>
+#include <gtest/gtest.h>
+
+namespace {
+
+  // =======================================================================================
+  TEST(test_csvtable, fields ) {
+    // -------------------------------------------------------------------------------------
+    {
+      std::ofstream outf( "/tmp/csvtable_test.csv" );
+      outf << "name,x,y\r\n";
+      outf << "one,1.5,-2\r\n";
+      outf << "two, 2.5e3 ,7\n";
+      outf << "three,,4\n";
+      outf << "four,abc\n";
+    }
+
+    CSVTable C( "/tmp/csvtable_test.csv" );
+    EXPECT_FALSE( C.bad() );
+    EXPECT_EQ( 4u, C.size(0) );
+    EXPECT_EQ( 3u, C.size(1) );
+    EXPECT_EQ( std::string("y"),     C.header(2) );
+    EXPECT_EQ( 1u,                   C.find("x") );
+    EXPECT_EQ( CSVTable::NOT_FOUND,  C.find("z") );
+    EXPECT_EQ( std::string("three"), C.get( 2, 0 ) );
+    EXPECT_EQ( std::string("-2"),    C.get( 0, "y" ) );
+    EXPECT_EQ( std::string(""),      C.get( 0, "z" ) );
+    EXPECT_EQ( std::string(""),      C.get( 2, 1 ) );
+    EXPECT_EQ( std::string(""),      C.get( 3, 2 ) );
+
+    size_t      n = 0;
+    const char* p = C.field( 1, 0, n );
+    EXPECT_EQ( 3u, n );
+    EXPECT_EQ( 0, strncmp( "two", p, n ) );
+
+    EXPECT_DOUBLE_EQ( 1.5,    C.getReal8( 0, 1 ) );
+    EXPECT_DOUBLE_EQ( 2500.0, C.getReal8( 1, 1 ) );
+    EXPECT_EQ( 7, C.getInt64( 1, 2 ) );
+
+    const real8_t* x = C.real8Column( "x" );
+    ASSERT_NE( static_cast<const real8_t*>(0), x );
+    EXPECT_DOUBLE_EQ( 1.5,    x[0] );
+    EXPECT_DOUBLE_EQ( 2500.0, x[1] );
+    EXPECT_TRUE( std::isnan( x[2] ) );
+    EXPECT_TRUE( std::isnan( x[3] ) );
+    EXPECT_EQ( x, C.real8Column( 1 ) );
+
+    const int64_t* y = C.int64Column( "y" );
+    ASSERT_NE( static_cast<const int64_t*>(0), y );
+    EXPECT_EQ( -2, y[0] );
+    EXPECT_EQ(  7, y[1] );
+    EXPECT_EQ(  4, y[2] );
+    EXPECT_EQ(  0, y[3] );
+
+    EXPECT_EQ( static_cast<const real8_t*>(0), C.real8Column( "z" ) );
+    EXPECT_EQ( static_cast<const int64_t*>(0), C.int64Column( 3 ) );
+    C.release();
+    EXPECT_DOUBLE_EQ( 1.5, C.real8Column( 1 )[0] );
+  }
+
+
+  // =======================================================================================
+  TEST(test_csvtable, csvfile ) {
+    // -------------------------------------------------------------------------------------
+    const size_t nr = 20000;
+    {
+      std::ofstream outf( "/tmp/csvtable_test.csv" );
+      outf << "id,a,b\n";
+      for ( size_t i=0; i<nr; i++ ) {
+        outf << i << "," << (static_cast<real8_t>(i)*0.125) << "," << (-3.0*static_cast<real8_t>(i)) << "\n";
+      }
+    }
+
+    CSVTable T( "/tmp/csvtable_test.csv" );
+    CSVFile  F( "/tmp/csvtable_test.csv" );
+    ASSERT_EQ( F.size(0), T.size(0) );
+    ASSERT_EQ( F.size(1), T.size(1) );
+
+    const int64_t* id = T.int64Column( 0 );
+    const real8_t* b  = T.real8Column( "b" );
+    for ( size_t i=0; i<nr; i++ ) {
+      EXPECT_EQ( static_cast<int64_t>( F.getInt32( i, 0 ) ), id[i] );
+      EXPECT_DOUBLE_EQ( F.getReal8( i, "a" ), T.getReal8( i, 1 ) );
+      EXPECT_DOUBLE_EQ( F.getReal8( i, 2 ), b[i] );
+    }
+  }
+
+
+  // =======================================================================================
+  TEST(test_csvtable, missing ) {
+    // -------------------------------------------------------------------------------------
+    CSVTable C( "/tmp/csvtable_no_such_file.csv" );
+    EXPECT_TRUE( C.bad() );
+    EXPECT_EQ( 0u, C.size(0) );
+    EXPECT_EQ( 0u, C.size(1) );
+  }
+
+
+} // end namespace
+
+
+// =======================================================================================
+// **                            U T E S T _ C S V T A B L E                            **
+// ======================================================================== END FILE =====
@@ -0,0 +1,224 @@
+// ====================================================================== BEGIN FILE =====
+// **                                U T E S T _ H 5 I O                                **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Automated testing for HDF5 input and output.
+ *  @file   utest_h5io.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides automated testing for the H5IO functions.
+ */
+// =======================================================================================
+
+#include <limits.h>
+#include <H5IO.hh>
+#include <cstdio>
+#include <gtest/gtest.h>
+
+namespace {
+
+  const char* H5FILE = "/tmp/h5io_test.h5";
+
+  // =======================================================================================
+  inline real8_t ELEM( int32_t i, int32_t j ) {
+    // -------------------------------------------------------------------------------------
+    return ((real8_t)i) + (((real8_t)j)/100.0);
+  }
+
+
+  // =======================================================================================
+  TEST(test_h5io, table ) {
+    // -------------------------------------------------------------------------------------
+    // Test: write(), read(), shape() with a row range
+    // -------------------------------------------------------------------------------------
+    int32_t ns = 1000;
+    int32_t nv = 7;
+    Table T(ns,nv);
+
+    for ( int32_t s=0; s<ns; s++ ) {
+      for ( int32_t v=0; v<nv; v++ ) {
+	T(s,v) = ELEM(s,v);
+      }
+    }
+
+    remove( H5FILE );
+    EXPECT_FALSE( H5IO::write( H5FILE, "data/table", T, H5IO::Options( 64, 6 ) ) );
+
+    int32_t nr = 0;
+    int32_t nc = 0;
+    EXPECT_FALSE( H5IO::shape( nr, nc, H5FILE, "data/table" ) );
+    EXPECT_EQ( ns, nr );
+    EXPECT_EQ( nv, nc );
+
+    Table X;
+    EXPECT_FALSE( H5IO::read( X, H5FILE, "data/table" ) );
+    EXPECT_EQ( ns, size(X,0) );
+    EXPECT_EQ( nv, size(X,1) );
+    for ( int32_t s=0; s<ns; s++ ) {
+      for ( int32_t v=0; v<nv; v++ ) {
+	EXPECT_DOUBLE_EQ( ELEM(s,v), X(s,v) );
+      }
+    }
+
+    Table Y;
+    EXPECT_FALSE( H5IO::read( Y, H5FILE, "data/table", 100, 250 ) );
+    EXPECT_EQ( 250, size(Y,0) );
+    for ( int32_t s=0; s<250; s++ ) {
+      for ( int32_t v=0; v<nv; v++ ) {
+	EXPECT_DOUBLE_EQ( ELEM(s+100,v), Y(s,v) );
+      }
+    }
+
+    EXPECT_TRUE( H5IO::read( Y, H5FILE, "data/table", 900, 101 ) );
+    EXPECT_TRUE( H5IO::read( Y, H5FILE, "data/missing" ) );
+  }
+
+
+  // =======================================================================================
+  TEST(test_h5io, append ) {
+    // -------------------------------------------------------------------------------------
+    // Test: append()
+    // -------------------------------------------------------------------------------------
+    int32_t ns = 10;
+    int32_t nv = 3;
+    Table T(ns,nv);
+
+    remove( H5FILE );
+    for ( int32_t k=0; k<4; k++ ) {
+      for ( int32_t s=0; s<ns; s++ ) {
+	for ( int32_t v=0; v<nv; v++ ) {
+	  T(s,v) = ELEM(k*ns+s,v);
+	}
+      }
+      EXPECT_FALSE( H5IO::append( H5FILE, "grow", T, H5IO::Options( 4 ) ) );
+    }
+
+    Table W(2,2);
+    EXPECT_TRUE( H5IO::append( H5FILE, "grow", W ) );
+
+    Table X;
+    EXPECT_FALSE( H5IO::read( X, H5FILE, "grow" ) );
+    EXPECT_EQ( 4*ns, size(X,0) );
+    for ( int32_t s=0; s<4*ns; s++ ) {
+      for ( int32_t v=0; v<nv; v++ ) {
+	EXPECT_DOUBLE_EQ( ELEM(s,v), X(s,v) );
+      }
+    }
+  }
+
+
+  // =======================================================================================
+  TEST(test_h5io, matrix ) {
+    // -------------------------------------------------------------------------------------
+    // Test: write(), read() of a Matrix next to a Table in the same file
+    // -------------------------------------------------------------------------------------
+    Matrix M(5,9);
+    for ( int32_t r=0; r<5; r++ ) {
+      for ( int32_t c=0; c<9; c++ ) {
+	M(r,c) = ELEM(r,c);
+      }
+    }
+
+    Table T(3,2);
+    T.set( 1.5 );
+
+    remove( H5FILE );
+    EXPECT_FALSE( H5IO::write( H5FILE, "table",  T ) );
+    EXPECT_FALSE( H5IO::write( H5FILE, "matrix", M ) );
+
+    Matrix X;
+    EXPECT_FALSE( H5IO::read( X, H5FILE, "matrix", 1, 3 ) );
+    EXPECT_EQ( 3, size(X,0) );
+    EXPECT_EQ( 9, size(X,1) );
+    for ( int32_t r=0; r<3; r++ ) {
+      for ( int32_t c=0; c<9; c++ ) {
+	EXPECT_DOUBLE_EQ( ELEM(r+1,c), X(r,c) );
+      }
+    }
+
+    Table Y;
+    EXPECT_FALSE( H5IO::read( Y, H5FILE, "table" ) );
+    EXPECT_DOUBLE_EQ( 1.5, Y(2,1) );
+  }
+
+
+  // =======================================================================================
+  TEST(test_h5io, exemplar ) {
+    // -------------------------------------------------------------------------------------
+    // Test: write(), read(), read_meta() of an Exemplar
+    // -------------------------------------------------------------------------------------
+    int32_t ns = 50;
+    int32_t ni = 4;
+    int32_t no = 2;
+    Exemplar E( ns, ni, no );
+    for ( int32_t s=0; s<ns; s++ ) {
+      for ( int32_t i=0; i<ni; i++ ) { E.setIn(  s, i, ELEM(s,i) ); }
+      for ( int32_t o=0; o<no; o++ ) { E.setOut( s, o, -ELEM(s,o) ); }
+    }
+
+    Exemplar U( ns, ni );
+    for ( int32_t s=0; s<ns; s++ ) {
+      for ( int32_t i=0; i<ni; i++ ) { U.setIn( s, i, ELEM(i,s) ); }
+    }
+
+    remove( H5FILE );
+    EXPECT_FALSE( H5IO::write( H5FILE, "train", E, H5IO::Options( 16, 1 ) ) );
+    EXPECT_FALSE( H5IO::write( H5FILE, "/",     U ) );
+
+    Exemplar::Meta meta;
+    EXPECT_FALSE( H5IO::read_meta( meta, H5FILE, "train" ) );
+    EXPECT_EQ( ns, meta.n_sample );
+    EXPECT_EQ( ni, meta.n_input );
+    EXPECT_EQ( no, meta.n_output );
+
+    Exemplar X;
+    EXPECT_FALSE( H5IO::read( X, H5FILE, "train", 10, 20 ) );
+    EXPECT_EQ( 20, X.nSample() );
+    EXPECT_EQ( ni, X.nInput() );
+    EXPECT_EQ( no, X.nOutput() );
+    for ( int32_t s=0; s<20; s++ ) {
+      for ( int32_t i=0; i<ni; i++ ) { EXPECT_DOUBLE_EQ(  ELEM(s+10,i), X.getIn(  s, i ) ); }
+      for ( int32_t o=0; o<no; o++ ) { EXPECT_DOUBLE_EQ( -ELEM(s+10,o), X.getOut( s, o ) ); }
+    }
+
+    Exemplar Y;
+    EXPECT_FALSE( H5IO::read( Y, H5FILE, "" ) );
+    EXPECT_EQ( ns, Y.nSample() );
+    EXPECT_FALSE( Y.hasOutput() );
+    for ( int32_t s=0; s<ns; s++ ) {
+      for ( int32_t i=0; i<ni; i++ ) { EXPECT_DOUBLE_EQ( ELEM(i,s), Y.getIn( s, i ) ); }
+    }
+
+    EXPECT_TRUE( H5IO::read_meta( meta, H5FILE, "missing" ) );
+  }
+
+
+} // end namespace
+
+
+// =======================================================================================
+// **                                U T E S T _ H 5 I O                                **
+// ======================================================================== END FILE =====
@@ -0,0 +1,228 @@
+// ====================================================================== BEGIN FILE =====
+// **                           U T E S T _ P A R S E T O O L                           **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Automated testing for ParseTool.
+ *  @file   utest_parsetool.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides automated testing for the ASCII parsing layer and the readers built on it.
+ */
+// =======================================================================================
+
+#include <limits.h>
+#include <ParseTool.hh>
+#include <Table.hh>
+#include <Exemplar.hh>
+#include <CSVFile.hh>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <cmath>
+#include <gtest/gtest.h>
+
+namespace {
+
+  // =======================================================================================
+  bool SAME( const char* text ) {
+    // -------------------------------------------------------------------------------------
+    const size_t n = strlen( text );
+    real8_t      x = 0.0;
+    const char*  r = ParseTool::real8( text, text+n, x );
+    const real8_t a = strtod( text, static_cast<char**>(0) );
+    return ( text+n == r ) && ( 0 == memcmp( &a, &x, sizeof(x) ) );
+  }
+
+
+  // =======================================================================================
+  TEST(test_parsetool, real8_cases ) {
+    // -------------------------------------------------------------------------------------
+    EXPECT_TRUE( SAME( "0" ) );
+    EXPECT_TRUE( SAME( "-0.0" ) );
+    EXPECT_TRUE( SAME( "+12.5" ) );
+    EXPECT_TRUE( SAME( ".5e-3" ) );
+    EXPECT_TRUE( SAME( "5." ) );
+    EXPECT_TRUE( SAME( "1.7976931348623157e308" ) );
+    EXPECT_TRUE( SAME( "1.7976931348623159e308" ) );
+    EXPECT_TRUE( SAME( "2.2250738585072014e-308" ) );
+    EXPECT_TRUE( SAME( "4.9406564584124654e-324" ) );
+    EXPECT_TRUE( SAME( "1e-400" ) );
+    EXPECT_TRUE( SAME( "9007199254740993" ) );
+    EXPECT_TRUE( SAME( "0.1000000000000000055511151231257827021181583404541015625" ) );
+    EXPECT_TRUE( SAME( "123456789012345678901234567890" ) );
+    EXPECT_TRUE( SAME( "-inf" ) );
+    EXPECT_TRUE( SAME( "2.5" ) );
+    EXPECT_TRUE( SAME( "0x1.8p3" ) );
+    EXPECT_TRUE( SAME( "-0X10" ) );
+
+    real8_t x = 0.0;
+    const char* t = "1.5e+ 7";
+    EXPECT_EQ( t+3, ParseTool::real8( t, t+strlen(t), x ) );
+    EXPECT_DOUBLE_EQ( 1.5, x );
+
+    const char* u = "-x";
+    EXPECT_EQ( static_cast<const char*>(0), ParseTool::real8( u, u+2, x ) );
+  }
+
+
+  // =======================================================================================
+  TEST(test_parsetool, real8_random ) {
+    // -------------------------------------------------------------------------------------
+    std::mt19937_64 gen( 17 );
+    char buf[64];
+    for ( int i=0; i<200000; i++ ) {
+      u_int64_t b = gen();
+      real8_t   v;
+      memcpy( &v, &b, sizeof(v) );
+      if ( ! std::isfinite( v ) ) { continue; }
+      snprintf( buf, 64, ( i & 1 ) ? "%.17g" : "%23.16e", v );
+      const char* s = buf;
+      while ( ' ' == *s ) { ++s; }
+      ASSERT_TRUE( SAME( s ) ) << s;
+    }
+  }
+
+
+  // =======================================================================================
+  TEST(test_parsetool, int64_range ) {
+    // -------------------------------------------------------------------------------------
+    int64_t x = 0;
+    const char* a = "9223372036854775807";
+    EXPECT_EQ( a+strlen(a), ParseTool::int64( a, a+strlen(a), x ) );
+    EXPECT_EQ( INT64_MAX, x );
+
+    const char* b = "-9223372036854775808";
+    EXPECT_EQ( b+strlen(b), ParseTool::int64( b, b+strlen(b), x ) );
+    EXPECT_EQ( INT64_MIN, x );
+
+    const char* c = "9223372036854775808";
+    EXPECT_EQ( static_cast<const char*>(0), ParseTool::int64( c, c+strlen(c), x ) );
+
+    const char* d = "-99999999999999999999";
+    EXPECT_EQ( static_cast<const char*>(0), ParseTool::int64( d, d+strlen(d), x ) );
+
+    {
+      std::ofstream outf( "/tmp/parsetool_test.tab" );
+      outf << "3000000000 2\n1 2\n";
+    }
+    Table T;
+    EXPECT_TRUE( T.read_ascii( "/tmp/parsetool_test.tab" ) );
+
+    {
+      std::ofstream outf( "/tmp/parsetool_test.tab" );
+      outf << "70000 70000\n1 2\n";
+    }
+    EXPECT_TRUE( T.read_ascii( "/tmp/parsetool_test.tab" ) );
+  }
+
+
+  // =======================================================================================
+  TEST(test_parsetool, values ) {
+    // -------------------------------------------------------------------------------------
+    // Large enough to be cut into several pieces.
+    // -------------------------------------------------------------------------------------
+    const int64_t nr = 20000;
+    const int64_t nc = 7;
+    std::string text;
+    char buf[64];
+    for ( int64_t r=0; r<nr; r++ ) {
+      for ( int64_t c=0; c<nc; c++ ) {
+        snprintf( buf, 64, "%23.16e%s", static_cast<real8_t>(r) + static_cast<real8_t>(c)/8.0,
+                  ( c+1 < nc ) ? " " : ( ( 0 == r%3 ) ? "\r\n" : "\n" ) );
+        text += buf;
+      }
+    }
+
+    std::vector<real8_t> col( static_cast<size_t>( nr*nc ) );
+    const char* p = text.data();
+    EXPECT_EQ( nr*nc, ParseTool::values( p, p+text.size(), col.data(), nr, nc, 1, nr ) );
+    for ( int64_t r=0; r<nr; r++ ) {
+      for ( int64_t c=0; c<nc; c++ ) {
+        ASSERT_DOUBLE_EQ( static_cast<real8_t>(r) + static_cast<real8_t>(c)/8.0,
+                          col[static_cast<size_t>( r + c*nr )] );
+      }
+    }
+
+    EXPECT_EQ( 10, ParseTool::values( p, p+text.size(), col.data(), 2, 5, 5, 1 ) );
+
+    text[text.size()/2] = 'x';
+    p = text.data();
+    EXPECT_EQ( -1, ParseTool::values( p, p+text.size(), col.data(), nr, nc, nc, 1 ) );
+  }
+
+
+  // =======================================================================================
+  TEST(test_parsetool, exemplar ) {
+    // -------------------------------------------------------------------------------------
+    Exemplar E( 30, 3, 2 );
+    for ( int32_t s=0; s<30; s++ ) {
+      for ( int32_t i=0; i<3; i++ ) { E.setIn(  s, i, s + i/10.0 ); }
+      for ( int32_t o=0; o<2; o++ ) { E.setOut( s, o, -s - o/10.0 ); }
+    }
+    E.write( "/tmp/parsetool_test.ex" );
+
+    Exemplar X( "/tmp/parsetool_test.ex" );
+    EXPECT_EQ( 30, X.nSample() );
+    EXPECT_EQ( 3,  X.nInput()  );
+    EXPECT_EQ( 2,  X.nOutput() );
+    for ( int32_t s=0; s<30; s++ ) {
+      for ( int32_t i=0; i<3; i++ ) { EXPECT_DOUBLE_EQ(  s + i/10.0, X.getIn(  s, i ) ); }
+      for ( int32_t o=0; o<2; o++ ) { EXPECT_DOUBLE_EQ( -s - o/10.0, X.getOut( s, o ) ); }
+    }
+  }
+
+
+  // =======================================================================================
+  TEST(test_parsetool, csvfile ) {
+    // -------------------------------------------------------------------------------------
+    {
+      std::ofstream outf( "/tmp/parsetool_test.csv" );
+      outf << "name,x,y\r\n";
+      outf << "one,1.5,-2\r\n";
+      outf << "two,2.5e3,7\n";
+      outf << "three,,4";
+    }
+
+    CSVFile C( "/tmp/parsetool_test.csv" );
+    EXPECT_EQ( 3u, C.size(0) );
+    EXPECT_EQ( 3u, C.size(1) );
+    EXPECT_EQ( std::string("y"),     C.header(2) );
+    EXPECT_EQ( std::string("three"), C.get( 2, 0 ) );
+    EXPECT_DOUBLE_EQ( 1.5,    C.getReal8( 0, 1 ) );
+    EXPECT_DOUBLE_EQ( 2500.0, C.getReal8( 1, "x" ) );
+    EXPECT_DOUBLE_EQ( -2.0,   C.getReal8( 0, "y" ) );
+    EXPECT_EQ( 4, C.getInt32( 2, 2 ) );
+    EXPECT_EQ( std::string(""), C.get( 2, 1 ) );
+  }
+
+
+} // end namespace
+
+
+// =======================================================================================
+// **                           U T E S T _ P A R S E T O O L                           **
+// ======================================================================== END FILE =====
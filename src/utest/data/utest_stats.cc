@@ -37,6 +37,7 @@
 #include <Statistics.hh>
 #include <gtest/gtest.h>
 #include <Dice.hh>
+#include <algorithm>
 
 namespace {
 
@@ -109,6 +110,66 @@ TEST(test_statistics_histogram, add ) {
     
 }
 
+// =======================================================================================
+int32_t brute_map( const Statistics::histogram& H, const real8_t x ) {
+  // -------------------------------------------------------------------------------------
+  int32_t idx = 0;
+  real8_t md  = Abs( x - H.center(0) );
+  for ( int32_t i=1; i<H.size(); i++ ) {
+    const real8_t d = Abs( x - H.center(i) );
+    if ( d < md ) {
+      md  = d;
+      idx = i;
+    }
+  }
+  return idx;
+}
+
+
+// =======================================================================================
+TEST(test_statistics_histogram, map ) {
+  // -------------------------------------------------------------------------------------
+  // Test: map (uniform, sorted, unsorted), add(array)
+  // -------------------------------------------------------------------------------------
+  Dice* dd = Dice::TestDice();
+
+  real8_t sctr[] = { -3.0, -1.5, -1.0, 0.0, 0.25, 0.5, 2.0, 3.5, 7.0 };
+  real8_t uctr[] = { 0.5, -3.0, 2.0, 7.0, -1.0, 0.25, 3.5, 0.0, -1.5 };
+  int32_t nc = sizeof(sctr) / sizeof( sctr[0] );
+
+  Statistics::histogram HU( -2.0, 6.0, 17 );
+  Statistics::histogram HS( sctr, nc );
+  Statistics::histogram HR( uctr, nc );
+
+  const int32_t ns = 100000;
+  real8_t* data = new real8_t[ns];
+  for ( int32_t i=0; i<ns; i++ ) {
+    data[i] = 1.5 + 4.0*dd->normal();
+  }
+  data[0] = -2.0;  data[1] = 6.0;  data[2] = 0.375;  data[3] = -1.25;  data[4] = 2.75;
+
+  for ( int32_t i=0; i<ns; i++ ) {
+    EXPECT_EQ( brute_map( HU, data[i] ), HU.map( data[i] ) );
+    EXPECT_EQ( brute_map( HS, data[i] ), HS.map( data[i] ) );
+    EXPECT_EQ( brute_map( HR, data[i] ), HR.map( data[i] ) );
+  }
+
+  Statistics::histogram H1( sctr, nc );
+  Statistics::histogram H2( sctr, nc );
+  H1.add( data, ns );
+  for ( int32_t i=0; i<ns; i++ ) {
+    H2.add( data[i] );
+  }
+
+  EXPECT_EQ( ns, H1.count() );
+  for ( int32_t i=0; i<nc; i++ ) {
+    EXPECT_EQ( H2.bin(i), H1.bin(i) );
+  }
+
+  delete[] data;
+}
+
+
 #define  TEST_MEAN   3.0
 #define  TEST_SIGMA  2.0
 #define  TEST_VAR   (TEST_SIGMA*TEST_SIGMA)
@@ -281,6 +342,136 @@ TEST(test_statistics_single, running_integer ) {
 }
 
 
+
+// =======================================================================================
+TEST(test_statistics_moments, merge ) {
+  // -------------------------------------------------------------------------------------
+  Dice* dd = Dice::TestDice();
+
+  const int32_t nsamp  = 200000;
+  const int32_t nsplit = 73421;
+  real8_t* buffer = new real8_t[nsamp];
+
+  for ( int32_t i=0; i<nsamp; i++ ) {
+    const real8_t u = dd->uniform();
+    buffer[i] = TEST_MEAN + TEST_SIGMA*dd->normal() + 4.0*u*u;
+  }
+
+  Statistics::single S;
+  S.compile( buffer, nsamp );
+  S.extra(   buffer, nsamp );
+
+  // ----- serial --------------------------------------------------------------------------
+  Statistics::moments A;
+  for ( int32_t i=0; i<nsamp; i++ ) {
+    A.update( buffer[i] );
+  }
+
+  // ----- two partial accumulators, merged ------------------------------------------------
+  Statistics::moments B;
+  Statistics::moments C;
+  B.batch( buffer,          nsplit );
+  C.batch( buffer + nsplit, nsamp - nsplit );
+  B.merge( C );
+
+  // ----- parallel batch ------------------------------------------------------------------
+  Statistics::moments D;
+  D.batch( buffer, nsamp );
+
+  Statistics::moments* T[] = { &A, &B, &D };
+  for ( int32_t k=0; k<3; k++ ) {
+    EXPECT_EQ(   (int64_t)nsamp,  T[k]->count()  );
+    EXPECT_EQ(   S.minv(),        T[k]->minv()   );
+    EXPECT_EQ(   S.maxv(),        T[k]->maxv()   );
+    EXPECT_EQ(   S.minidx(),      T[k]->minidx() );
+    EXPECT_EQ(   S.maxidx(),      T[k]->maxidx() );
+    EXPECT_NEAR( S.mean(),        T[k]->mean(), 1.0e-12 );
+    EXPECT_NEAR( S.var(),         T[k]->var(),  1.0e-10 );
+    EXPECT_NEAR( S.skew(),        T[k]->skew(), 1.0e-10 );
+    EXPECT_NEAR( S.kurt(),        T[k]->kurt(), 1.0e-10 );
+  }
+
+  delete[] buffer;
+}
+
+
+// =======================================================================================
+TEST(test_statistics_quantile, normal_Dice ) {
+  // -------------------------------------------------------------------------------------
+  Dice* dd = Dice::TestDice();
+
+  const int32_t nsamp = 200000;
+  real8_t* buffer = new real8_t[nsamp];
+  for ( int32_t i=0; i<nsamp; i++ ) {
+    buffer[i] = TEST_MEAN + TEST_SIGMA*dd->normal();
+  }
+
+  Statistics::quantile Q;
+  Statistics::quantile A;
+  Statistics::quantile B;
+
+  Q.batch( buffer, nsamp );
+  A.batch( buffer,           nsamp/3 );
+  B.batch( buffer + nsamp/3, nsamp - nsamp/3 );
+  EXPECT_FALSE( A.merge( B ) );
+
+  EXPECT_EQ( (int64_t)nsamp, Q.count() );
+  EXPECT_EQ( (int64_t)nsamp, A.count() );
+  EXPECT_GT( 2000, Q.retained() );
+
+  real8_t* sorted = new real8_t[nsamp];
+  for ( int32_t i=0; i<nsamp; i++ ) { sorted[i] = buffer[i]; }
+  std::sort( sorted, sorted+nsamp );
+
+  const real8_t eps = Q.rank_error();
+  const real8_t qs[] = { 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99 };
+  for ( size_t j=0; j<sizeof(qs)/sizeof(qs[0]); j++ ) {
+    const real8_t vq = Q.get( qs[j] );
+    const real8_t va = A.get( qs[j] );
+    const real8_t rq = static_cast<real8_t>( std::upper_bound( sorted, sorted+nsamp, vq ) - sorted ) / nsamp;
+    const real8_t ra = static_cast<real8_t>( std::upper_bound( sorted, sorted+nsamp, va ) - sorted ) / nsamp;
+    EXPECT_NEAR( qs[j], rq, eps );
+    EXPECT_NEAR( qs[j], ra, eps );
+  }
+
+  EXPECT_DOUBLE_EQ( sorted[0],       Q.get( D_ZERO ) );
+  EXPECT_DOUBLE_EQ( sorted[nsamp-1], Q.get( D_ONE  ) );
+
+  delete[] sorted;
+  delete[] buffer;
+}
+
+
+// =======================================================================================
+TEST(test_statistics_distinct, count ) {
+  // -------------------------------------------------------------------------------------
+  const int64_t N = 250000;
+
+  Statistics::distinct D;
+  Statistics::distinct A;
+  Statistics::distinct B;
+
+  for ( int64_t i=0; i<N; i++ ) {
+    D.add( i );
+    D.add( i );                  // duplicates do not count
+    if ( 0 == (i % 2) ) { A.add( i ); } else { B.add( i ); }
+  }
+
+  EXPECT_NEAR( (real8_t)N, D.estimate(), 4.0*D.rel_error()*(real8_t)N );
+
+  EXPECT_FALSE( A.merge( B ) );
+  EXPECT_DOUBLE_EQ( D.estimate(), A.estimate() );
+
+  Statistics::distinct S( 10 );
+  EXPECT_TRUE( S.merge( D ) );
+
+  Statistics::distinct small;
+  for ( int64_t i=0; i<100; i++ ) {
+    small.add( static_cast<real8_t>( i ) * 0.5 );
+  }
+  EXPECT_NEAR( 100.0, small.estimate(), 2.0 );
+}
+
   
 } // end namespace
 
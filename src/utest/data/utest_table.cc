@@ -37,6 +37,8 @@
 #include <Table.hh>
 #include <Vector.hh>
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <fstream>
 
 namespace {
 
@@ -207,6 +209,142 @@ namespace {
   }
 
 
+  // =======================================================================================
+  TEST(test_table_file, binary ) {
+    // -------------------------------------------------------------------------------------
+    // Test: read_binary(), write_binary()
+    // -------------------------------------------------------------------------------------
+    int32_t ns = 11;
+    int32_t nv = 7;
+    Table T(ns,nv);
+
+    for ( int32_t s=0; s<ns; s++ ) {
+      for ( int32_t v=0; v<nv; v++ ) {
+	T(s,v) = ELEM(s,v) / 3.0;
+      }
+    }
+
+    EXPECT_FALSE( T.write_binary( "/tmp/table_test.bin" ) );
+
+    Table X(2,2);
+    EXPECT_FALSE( X.read_binary( "/tmp/table_test.bin" ) );
+    EXPECT_EQ( ns, size(X,0) );
+    EXPECT_EQ( nv, size(X,1) );
+
+    for ( int32_t s=0; s<ns; s++ ) {
+      for ( int32_t v=0; v<nv; v++ ) {
+	EXPECT_EQ( T(s,v), X(s,v) );
+      }
+    }
+
+    EXPECT_TRUE( X.read_binary( "/tmp/table_test.dat" ) );
+  }
+
+
+  // =======================================================================================
+  TEST(test_table_file, binary_swapped ) {
+    // -------------------------------------------------------------------------------------
+    // Test: read_binary() of a file written with the other byte order
+    // -------------------------------------------------------------------------------------
+    int32_t ns = 5;
+    int32_t nv = 3;
+    Table T(ns,nv);
+
+    for ( int32_t s=0; s<ns; s++ ) {
+      for ( int32_t v=0; v<nv; v++ ) {
+	T(s,v) = ELEM(s,v);
+      }
+    }
+
+    T.write_binary( "/tmp/table_test.bin" );
+
+    // ----- reverse every header field and value -----------------------------------------
+    std::fstream io( "/tmp/table_test.bin", std::ios::in | std::ios::out | std::ios::binary );
+    char buf[64 + 8*5*3];
+    io.read( buf, sizeof(buf) );
+    const int fld[] = { 8,4, 12,4, 16,4, 20,4, 24,8, 32,8, 40,8 };
+    for ( int k=0; k<14; k+=2 ) {
+      std::reverse( buf+fld[k], buf+fld[k]+fld[k+1] );
+    }
+    for ( int k=64; k<(int)sizeof(buf); k+=8 ) {
+      std::reverse( buf+k, buf+k+8 );
+    }
+    io.seekp( 0 );
+    io.write( buf, sizeof(buf) );
+    io.close();
+
+    Table X;
+    EXPECT_FALSE( X.read_binary( "/tmp/table_test.bin" ) );
+    EXPECT_EQ( ns, size(X,0) );
+    EXPECT_EQ( nv, size(X,1) );
+    for ( int32_t s=0; s<ns; s++ ) {
+      for ( int32_t v=0; v<nv; v++ ) {
+	EXPECT_EQ( T(s,v), X(s,v) );
+      }
+    }
+
+    Table M;
+    EXPECT_TRUE( M.map( "/tmp/table_test.bin" ) );
+    EXPECT_FALSE( M.isMapped() );
+  }
+
+
+  // =======================================================================================
+  TEST(test_table_file, map ) {
+    // -------------------------------------------------------------------------------------
+    // Test: map(), isMapped(), col()
+    // -------------------------------------------------------------------------------------
+    int32_t ns = 13;
+    int32_t nv = 4;
+    Table T(ns,nv);
+
+    for ( int32_t s=0; s<ns; s++ ) {
+      for ( int32_t v=0; v<nv; v++ ) {
+	T(s,v) = ELEM(s,v);
+      }
+    }
+
+    T.write_binary( "/tmp/table_test.bin" );
+
+    {
+      Table X;
+      EXPECT_FALSE( X.map( "/tmp/table_test.bin" ) );
+      EXPECT_TRUE( X.isMapped() );
+      EXPECT_EQ( ns, size(X,0) );
+      EXPECT_EQ( nv, size(X,1) );
+
+      for ( int32_t v=0; v<nv; v++ ) {
+	const real8_t* C = X.col(v);
+	EXPECT_EQ( 0u, reinterpret_cast<size_t>( C - v*ns ) % 64 );
+	for ( int32_t s=0; s<ns; s++ ) {
+	  EXPECT_DOUBLE_EQ( ELEM(s,v), C[s] );
+	}
+      }
+
+      X(0,0) = -1.0;           // copy-on-write, file is unchanged
+
+      Table K( X );
+      EXPECT_FALSE( K.isMapped() );
+      EXPECT_DOUBLE_EQ( -1.0, K(0,0) );
+
+      X.resize( 2, 2 );        // detach
+      EXPECT_FALSE( X.isMapped() );
+    }
+
+    {
+      Table X;
+      EXPECT_FALSE( X.map( "/tmp/table_test.bin", true ) );
+      EXPECT_DOUBLE_EQ( ELEM(0,0), X(0,0) );
+      X(1,2) = 42.0;
+    }
+
+    Table Y;
+    Y.read_binary( "/tmp/table_test.bin" );
+    EXPECT_DOUBLE_EQ( 42.0, Y(1,2) );
+    EXPECT_DOUBLE_EQ( ELEM(0,0), Y(0,0) );
+  }
+
+
   // =======================================================================================
   TEST(test_table_ops, sum_mean ) {
     // -------------------------------------------------------------------------------------
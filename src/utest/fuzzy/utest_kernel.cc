@@ -0,0 +1,325 @@
+// ====================================================================== BEGIN FILE =====
+// **                              U T E S T _ K E R N E L                              **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Automated testing for fuzzy::Kernel class methods.
+ *  @file   utest_kernel.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides automated testing for the fuzzy::Kernel class and methods.
+ */
+// =======================================================================================
+
+#include <limits.h>
+#include <fuzzy/Kernel.hh>
+#include <VarReal.hh>
+#include <gtest/gtest.h>
+
+namespace {
+
+
+real8_t ctr[] = {  1.0,  2.0,  3.0,
+                   7.0,  8.0,  9.5, 10.0, 11.0, 14.0,
+                  -1.0,  1.0,
+                   4.0,
+                   0.0,  0.1,  0.2,  0.3,  0.4,  0.5,  0.6, 0.7 };
+
+int32_t nc[] = { 3, 6, 2, 1, 8 };
+
+real8_t min_x[] = { 0.0,  6.0, -2.0, 2.5, -0.1 };
+real8_t max_x[] = { 4.0, 15.0,  2.0, 5.5,  0.8 };
+
+
+// =======================================================================================
+TEST( test_kernel, compile ) {
+  // -------------------------------------------------------------------------------------
+  VarReal V( 5, nc, ctr );
+  fuzzy::Group  G( V );
+  fuzzy::Kernel K( G );
+
+  EXPECT_EQ( G.nIn(),  K.nIn() );
+  EXPECT_EQ( G.nOut(), K.nOut() );
+  int32_t off = 0;
+  for ( int32_t i=0; i<K.nIn(); i++ ) {
+    EXPECT_EQ( nc[i], K.nSet(i) );
+    EXPECT_EQ( off,   K.offset(i) );
+    off += nc[i];
+  }
+}
+
+
+// =======================================================================================
+TEST( test_kernel, fuzzify ) {
+  // -------------------------------------------------------------------------------------
+  VarReal V( 5, nc, ctr );
+  fuzzy::Group  G( V );
+  fuzzy::Kernel K( G );
+
+  const int32_t n_in  = G.nIn();
+  const int32_t n_out = G.nOut();
+  const int32_t n_sample = 401;
+
+  real8_t x[n_in];
+  real8_t a[n_out];
+  real8_t b[n_out];
+
+  for ( int32_t s=0; s<n_sample; s++ ) {
+    for ( int32_t i=0; i<n_in; i++ ) {
+      x[i] = min_x[i] + ( max_x[i] - min_x[i] ) * static_cast<real8_t>(s) /
+          static_cast<real8_t>(n_sample-1);
+    }
+    G.fuzzify( a, x );
+    K.fuzzify( b, x );
+    for ( int32_t j=0; j<n_out; j++ ) {
+      EXPECT_DOUBLE_EQ( a[j], b[j] );
+    }
+  }
+
+  // ----- exactly on the centers ---------------------------------------------------------
+  for ( int32_t s=0; s<8; s++ ) {
+    for ( int32_t i=0; i<n_in; i++ ) {
+      const int32_t j = ( s < nc[i] ) ? s : ( nc[i] - 1 );
+      x[i] = ctr[ K.offset(i) + j ];
+    }
+    G.fuzzify( a, x );
+    K.fuzzify( b, x );
+    for ( int32_t j=0; j<n_out; j++ ) {
+      EXPECT_DOUBLE_EQ( a[j], b[j] );
+    }
+  }
+}
+
+
+// =======================================================================================
+TEST( test_kernel, active ) {
+  // -------------------------------------------------------------------------------------
+  VarReal V( 5, nc, ctr );
+  fuzzy::Group  G( V );
+  fuzzy::Kernel K( G );
+
+  real8_t m0 = 0.0;
+  real8_t m1 = 0.0;
+
+  EXPECT_EQ( 0, K.active( 1, 5.0, m0, m1 ) );
+  EXPECT_DOUBLE_EQ( 1.0, m0 );
+  EXPECT_DOUBLE_EQ( 0.0, m1 );
+
+  EXPECT_EQ( 2, K.active( 1, 9.75, m0, m1 ) );
+  EXPECT_DOUBLE_EQ( 0.5, m0 );
+  EXPECT_DOUBLE_EQ( 0.5, m1 );
+
+  EXPECT_EQ( 4, K.active( 1, 13.25, m0, m1 ) );
+  EXPECT_DOUBLE_EQ( 0.25, m0 );
+  EXPECT_DOUBLE_EQ( 0.75, m1 );
+
+  EXPECT_EQ( 4, K.active( 1, 20.0, m0, m1 ) );
+  EXPECT_DOUBLE_EQ( 0.0, m0 );
+  EXPECT_DOUBLE_EQ( 1.0, m1 );
+
+  EXPECT_EQ( 0, K.active( 3, 4.5, m0, m1 ) );
+  EXPECT_DOUBLE_EQ( 0.5, m0 );
+  EXPECT_DOUBLE_EQ( 0.0, m1 );
+}
+
+
+// =======================================================================================
+TEST( test_kernel, table ) {
+  // -------------------------------------------------------------------------------------
+  VarReal V( 5, nc, ctr );
+  fuzzy::Group  G( V );
+  fuzzy::Kernel K( G );
+
+  const int32_t n_in     = G.nIn();
+  const int32_t n_out    = G.nOut();
+  const int32_t n_sample = 10007;
+
+  Table X( n_sample, n_in );
+  for ( int32_t s=0; s<n_sample; s++ ) {
+    for ( int32_t i=0; i<n_in; i++ ) {
+      const int32_t t = ( s * ( 7 + 2*i ) ) % n_sample;
+      X( s, i ) = min_x[i] + ( max_x[i] - min_x[i] ) * static_cast<real8_t>(t) /
+          static_cast<real8_t>(n_sample-1);
+    }
+  }
+
+  Table M;
+  G.fuzzify( M, X );
+  ASSERT_EQ( n_sample, M.size(0) );
+  ASSERT_EQ( n_out,    M.size(1) );
+
+  real8_t x[n_in];
+  real8_t a[n_out];
+  for ( int32_t s=0; s<n_sample; s++ ) {
+    for ( int32_t i=0; i<n_in; i++ ) { x[i] = X( s, i ); }
+    K.fuzzify( a, x );
+    for ( int32_t j=0; j<n_out; j++ ) {
+      EXPECT_DOUBLE_EQ( a[j], M( s, j ) );
+    }
+  }
+}
+
+
+// =======================================================================================
+TEST( test_kernel, coefficients ) {
+  // -------------------------------------------------------------------------------------
+  real8_t c5[] = { -3.0, -1.0, 0.5, 2.0, 6.0 };
+  fuzzy::Partition P[] = { fuzzy::Partition( 1, 2.0, 6.0 ),
+                           fuzzy::Partition( 2, -1.0, 3.0 ),
+                           fuzzy::Partition( 3, 7.0, 19.0 ),
+                           fuzzy::Partition( 5, c5 ) };
+
+  for ( size_t p=0; p<sizeof(P)/sizeof(P[0]); p++ ) {
+    const real8_t* c = P[p].coefficients();
+    for ( int32_t j=0; j<P[p].nOut(); j++ ) {
+      fuzzy::Set& S = P[p].get( j );
+      for ( int32_t k=1; k<=8; k++ ) {
+        const real8_t d = static_cast<real8_t>(k) / 8.0;
+        const real8_t a = d * ( c[0] + c[1]*d );
+        const real8_t m = d * ( c[2] + d*( c[3] + c[4]*d ) );
+        EXPECT_NEAR( S.area( d ),             a, 1.0e-12 );
+        EXPECT_NEAR( S.area( d ) * S.coa( d ), m, 1.0e-11 );
+      }
+      c += fuzzy::Partition::NUM_COEF;
+    }
+  }
+}
+
+
+// =======================================================================================
+TEST( test_kernel, defuzzify ) {
+  // -------------------------------------------------------------------------------------
+  real8_t tD[] = { 1.000, 0.750, 0.500, 0.250, 0.000 };
+  const int32_t nd = sizeof(tD) / sizeof(tD[0]);
+
+  // ----- reference values from test_part_functions.coa ----------------------------------
+  real8_t test[nd][nd][nd] =
+      { { {  14.000000000000, 13.517412935323, 12.822222222222, 11.823529411765, 10.266666666667,},
+          {  14.056737588652, 13.567430025445, 12.860398860399, 11.838383838384, 10.225108225108,},
+          {  14.212121212121, 13.699453551913, 12.950617283951, 11.844444444444, 10.019607843137,},
+          {  14.461538461538, 13.900311526480, 13.060931899642, 11.760000000000,  9.383647798742,},
+          {  14.833333333333, 14.178294573643, 13.148148148148, 11.370370370370,  7.166666666667,} },
+        { {  14.278177458034, 13.798449612403, 13.107246376812, 12.109965635739, 10.533333333333,},
+          {  14.343137254902, 13.857142857143, 13.154761904762, 12.134751773050, 10.500000000000,},
+          {  14.524934383202, 14.017094017094, 13.275080906149, 12.172549019608, 10.317460317460,},
+          {  14.827380952381, 14.274509803922, 13.446969696970, 12.152380952381,  9.708333333333,},
+          {  15.304029304029, 14.666666666667, 13.661691542289, 11.891156462585,  7.333333333333,} },
+        { {  14.676767676768, 14.202185792350, 13.518518518519, 12.525925925926, 10.921568627451,},
+          {  14.754521963824, 14.274509803922, 13.580952380952, 12.567049808429, 10.902564102564,},
+          {  14.977777777778, 14.478787878788, 13.750000000000, 12.658119658120, 10.761904761905,},
+          {  15.365079365079, 14.828070175439, 14.024691358025, 12.751322751323, 10.211382113821,},
+          {  16.015873015873, 15.414414414414, 14.466666666667, 12.746031746032,  7.533333333333,} },
+        { {  15.219512195122, 14.755162241888, 14.087542087542, 13.111111111111, 11.480225988701,},
+          {  15.316666666667, 14.848484848485, 14.173611111111, 13.179487179487, 11.488095238095,},
+          {  15.603603603604, 15.122112211221, 14.421455938697, 13.362318840580, 11.432624113475,},
+          {  16.125000000000, 15.620155038760, 14.870370370370, 13.666666666667, 11.041666666667,},
+          {  17.066666666667, 16.543589743590, 15.738562091503, 14.242424242424,  7.757575757576,} },
+        { {  15.952380952381, 15.509803921569, 14.878787878788, 13.952380952381, 12.333333333333,},
+          {  16.079510703364, 15.636363636364, 15.003921568627, 14.069651741294, 12.400000000000,},
+          {  16.466666666667, 16.022222222222, 15.385964912281, 14.425287356322, 12.555555555556,},
+          {  17.207843137255, 16.773333333333, 16.153005464481, 15.178294573643, 12.761904761905,},
+          {  18.666666666667, 18.333333333333, 17.933333333333, 17.484848484848,  1.000000000000,} } };
+
+  real8_t ctrs[] = { 7.0, 11.0, 19.0 };
+  fuzzy::Partition* P[] = { new fuzzy::Partition( 3, ctrs ) };
+  fuzzy::Group  G( 1, P );
+  fuzzy::Kernel K( G );
+  delete P[0];
+
+  Table M( nd*nd*nd, 3 );
+  real8_t D[3];
+  real8_t x[1];
+  int32_t s = 0;
+  for ( int32_t a=0; a<nd; a++ ) {
+    for ( int32_t b=0; b<nd; b++ ) {
+      for ( int32_t c=0; c<nd; c++ ) {
+        D[0] = M(s,0) = tD[a];
+        D[1] = M(s,1) = tD[b];
+        D[2] = M(s,2) = tD[c];
+        K.defuzzify( x, D );
+        EXPECT_NEAR( test[a][b][c], x[0], 1.0e-10 );
+        s++;
+      }
+    }
+  }
+
+  Table X;
+  K.defuzzify( X, M );
+  ASSERT_EQ( nd*nd*nd, X.size(0) );
+  ASSERT_EQ( 1,        X.size(1) );
+  s = 0;
+  for ( int32_t a=0; a<nd; a++ ) {
+    for ( int32_t b=0; b<nd; b++ ) {
+      for ( int32_t c=0; c<nd; c++ ) {
+        EXPECT_NEAR( test[a][b][c], X(s,0), 1.0e-10 );
+        s++;
+      }
+    }
+  }
+}
+
+
+// =======================================================================================
+TEST( test_kernel, round_trip ) {
+  // -------------------------------------------------------------------------------------
+  VarReal V( 5, nc, ctr );
+  fuzzy::Group  G( V );
+  fuzzy::Kernel K( G );
+
+  const int32_t n_in     = G.nIn();
+  const int32_t n_out    = G.nOut();
+  const int32_t n_sample = 3001;
+
+  Table X( n_sample, n_in );
+  for ( int32_t s=0; s<n_sample; s++ ) {
+    for ( int32_t i=0; i<n_in; i++ ) {
+      X( s, i ) = min_x[i] + ( max_x[i] - min_x[i] ) * static_cast<real8_t>(s) /
+          static_cast<real8_t>(n_sample-1);
+    }
+  }
+
+  Table M;
+  Table Y;
+  K.fuzzify( M, X );
+  G.defuzzify( Y, M );
+
+  real8_t mu[n_out];
+  real8_t y[n_in];
+  for ( int32_t s=0; s<n_sample; s++ ) {
+    for ( int32_t j=0; j<n_out; j++ ) { mu[j] = M( s, j ); }
+    K.defuzzify( y, mu );
+    for ( int32_t i=0; i<n_in; i++ ) {
+      EXPECT_NEAR( y[i], Y( s, i ), 1.0e-12 * ( 1.0 + fabs( y[i] ) ) );
+    }
+  }
+}
+
+
+} // end namespace
+
+
+// =======================================================================================
+// **                              U T E S T _ K E R N E L                              **
+// ======================================================================== END FILE =====
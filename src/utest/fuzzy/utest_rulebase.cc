@@ -0,0 +1,299 @@
+// ====================================================================== BEGIN FILE =====
+// **                            U T E S T _ R U L E B A S E                            **
+// =======================================================================================
+// **                                                                                   **
+// **  This file is part of the TRNCMP Research Library, `Callisto' (formerly SolLib.)  **
+// **                                                                                   **
+// **  Copyright (c) 2026, Stephen W. Soliday                                           **
+// **                      stephen.soliday@trncmp.org                                   **
+// **                      http://research.trncmp.org                                   **
+// **                                                                                   **
+// **  -------------------------------------------------------------------------------  **
+// **                                                                                   **
+// **  Callisto is free software: you can redistribute it and/or modify it under the    **
+// **  terms of the GNU General Public License as published by the Free Software        **
+// **  Foundation, either version 3 of the License, or (at your option)                 **
+// **  any later version.                                                               **
+// **                                                                                   **
+// **  Callisto is distributed in the hope that it will be useful, but WITHOUT          **
+// **  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS    **
+// **  FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.   **
+// **                                                                                   **
+// **  You should have received a copy of the GNU General Public License along with     **
+// **  Callisto. If not, see <https://www.gnu.org/licenses/>.                           **
+// **                                                                                   **
+// ----- Modification History ------------------------------------------------------------
+//
+/** @brief  Automated testing for fuzzy::RuleBase class methods.
+ *  @file   utest_rulebase.cc
+ *  @author Stephen W. Soliday
+ *  @date   2026-Oct-18
+ *
+ *  Provides automated testing for the fuzzy::RuleBase class and methods.
+ */
+// =======================================================================================
+
+#include <limits.h>
+#include <fuzzy/RuleBase.hh>
+#include <evo/RealEncoding.hh>
+#include <VarReal.hh>
+#include <cmath>
+#include <gtest/gtest.h>
+
+namespace {
+
+
+real8_t in_ctr[] = { -1.0, 0.0, 1.0,
+                      0.0, 1.0, 2.0, 4.0,
+                     -2.0, 2.0 };
+int32_t in_nc[]  = { 3, 4, 2 };
+
+real8_t out_ctr[] = { 0.0, 1.0, 2.0, 3.0, 4.0,
+                      -1.0, 1.0 };
+int32_t out_nc[]  = { 5, 2 };
+
+
+// =======================================================================================
+/** @brief Reference Mamdani inference over the full Cartesian product of sets.
+ */
+// ---------------------------------------------------------------------------------------
+void brute_fire( real8_t* mu, fuzzy::RuleBase& R, fuzzy::Kernel& I, fuzzy::Kernel& O,
+                 const real8_t* x ) {
+  // -------------------------------------------------------------------------------------
+  real8_t deg[ I.nOut() ];
+  I.fuzzify( deg, x );
+  for ( int32_t j=0; j<O.nOut(); j++ ) { mu[j] = 0.0; }
+
+  int32_t sets[ I.nIn() ];
+  for ( int32_t r=0; r<R.nRule(); r++ ) {
+    int32_t t = r;
+    real8_t g = 1.0;
+    for ( int32_t i=0; i<I.nIn(); i++ ) {
+      sets[i] = t % I.nSet(i);
+      t      /= I.nSet(i);
+      g = std::min( g, deg[ I.offset(i) + sets[i] ] );
+    }
+    EXPECT_EQ( r, R.index( sets ) );
+    for ( int32_t o=0; o<R.nOut(); o++ ) {
+      const int32_t j = O.offset(o) + R.get( r, o );
+      mu[j] = std::max( mu[j], g );
+    }
+  }
+}
+
+
+// =======================================================================================
+TEST( test_rulebase, mamdani ) {
+  // -------------------------------------------------------------------------------------
+  VarReal VI( 3, in_nc, in_ctr );
+  VarReal VO( 2, out_nc, out_ctr );
+  fuzzy::Group GI( VI );
+  fuzzy::Group GO( VO );
+  fuzzy::Kernel KI( GI );
+  fuzzy::Kernel KO( GO );
+
+  fuzzy::RuleBase R( GI, GO );
+  EXPECT_EQ( fuzzy::RuleBase::MAMDANI, R.kind() );
+  EXPECT_EQ( 3,  R.nIn() );
+  EXPECT_EQ( 2,  R.nOut() );
+  EXPECT_EQ( 24, R.nRule() );
+  EXPECT_EQ( 48, R.size() );
+
+  for ( int32_t r=0; r<R.nRule(); r++ ) {
+    R.set( r, 0, ( r * 7 ) % 5 );
+    R.set( r, 1, ( r / 3 ) % 2 );
+  }
+
+  real8_t x[3];
+  real8_t a[7];
+  real8_t b[7];
+  for ( int32_t s=0; s<500; s++ ) {
+    x[0] = -1.5 + 3.0 * static_cast<real8_t>( ( s * 37 ) % 500 ) / 499.0;
+    x[1] = -0.5 + 5.0 * static_cast<real8_t>( ( s * 91 ) % 500 ) / 499.0;
+    x[2] = -2.5 + 5.0 * static_cast<real8_t>( s ) / 499.0;
+    R.fire( a, x );
+    brute_fire( b, R, KI, KO, x );
+    for ( int32_t j=0; j<7; j++ ) {
+      EXPECT_DOUBLE_EQ( b[j], a[j] );
+    }
+
+    real8_t y[2];
+    real8_t z[2];
+    R.evaluate( y, x );
+    KO.defuzzify( z, b );
+    EXPECT_NEAR( z[0], y[0], 1.0e-12 );
+    EXPECT_NEAR( z[1], y[1], 1.0e-12 );
+  }
+}
+
+
+// =======================================================================================
+TEST( test_rulebase, tsk ) {
+  // -------------------------------------------------------------------------------------
+  VarReal VI( 3, in_nc, in_ctr );
+  fuzzy::Group GI( VI );
+
+  fuzzy::RuleBase R( GI, 1 );
+  EXPECT_EQ( fuzzy::RuleBase::TSK, R.kind() );
+  EXPECT_EQ( 24*4, R.size() );
+
+  // ----- every rule holds the same plane, so the output is that plane -----------------
+  const real8_t c[] = { 0.5, 2.0, -1.0, 0.25 };
+  for ( int32_t r=0; r<R.nRule(); r++ ) {
+    R.set( r, 0, c );
+  }
+
+  const int32_t ns = 1000;
+  Table X( ns, 3 );
+  for ( int32_t s=0; s<ns; s++ ) {
+    X( s, 0 ) = -1.5 + 3.0 * static_cast<real8_t>( ( s * 37 ) % ns ) / (ns-1.0);
+    X( s, 1 ) = -0.5 + 5.0 * static_cast<real8_t>( ( s * 91 ) % ns ) / (ns-1.0);
+    X( s, 2 ) = -2.5 + 5.0 * static_cast<real8_t>( s ) / (ns-1.0);
+  }
+
+  Table Y;
+  R.evaluate( Y, X );
+  ASSERT_EQ( ns, Y.size(0) );
+  ASSERT_EQ( 1,  Y.size(1) );
+  for ( int32_t s=0; s<ns; s++ ) {
+    const real8_t e = c[0] + c[1]*X(s,0) + c[2]*X(s,1) + c[3]*X(s,2);
+    EXPECT_NEAR( e, Y( s, 0 ), 1.0e-12 );
+  }
+
+  // ----- load and store -----------------------------------------------------------------
+  real8_t buf[ R.size() ];
+  real8_t* end = R.store( buf );
+  EXPECT_EQ( buf + R.size(), end );
+  for ( int32_t r=0; r<R.nRule(); r++ ) {
+    for ( int32_t k=0; k<4; k++ ) {
+      EXPECT_DOUBLE_EQ( c[k], buf[ r*4 + k ] );
+    }
+  }
+}
+
+
+// =======================================================================================
+TEST( test_rulebase, train ) {
+  // -------------------------------------------------------------------------------------
+  real8_t ctr[] = { -1.0, 0.0, 1.0,  -1.0, 0.0, 1.0 };
+  int32_t nc[]  = { 3, 3 };
+  VarReal VI( 2, nc, ctr );
+  fuzzy::Group GI( VI );
+
+  fuzzy::RuleBase R( GI, 1 );
+
+  const int32_t ns = 121;
+  Table X( ns, 2 );
+  real8_t target[ns];
+  for ( int32_t s=0; s<ns; s++ ) {
+    X( s, 0 ) = -1.0 + 0.2 * static_cast<real8_t>( s % 11 );
+    X( s, 1 ) = -1.0 + 0.2 * static_cast<real8_t>( s / 11 );
+    target[s] = X( s, 0 ) * X( s, 1 );
+  }
+
+  Table Y;
+  auto error = [&]( evo::RealEncoding& E ) {
+    R.load( E.get_data() );
+    R.evaluate( Y, X );
+    real8_t sum = 0.0;
+    for ( int32_t s=0; s<ns; s++ ) {
+      const real8_t d = Y( s, 0 ) - target[s];
+      sum += d*d;
+    }
+    return sum / static_cast<real8_t>( ns );
+  };
+
+  evo::RealEncoding parent( R.size(), -2.0, 2.0 );
+  evo::RealEncoding child(  R.size(), -2.0, 2.0 );
+  parent.zero();
+
+  const real8_t e0 = error( parent );
+  real8_t best = e0;
+  for ( int32_t g=0; g<400; g++ ) {
+    child.mutate( &parent, 0.2, 0.05 );
+    const real8_t e = error( child );
+    if ( e < best ) {
+      parent.copy( &child );
+      best = e;
+    }
+  }
+
+  EXPECT_LT( best, 0.5 * e0 );
+
+  real8_t buf[ R.size() ];
+  R.load( parent.get_data() );
+  R.store( buf );
+  for ( int32_t i=0; i<R.size(); i++ ) {
+    EXPECT_DOUBLE_EQ( parent.get(i), buf[i] );
+  }
+}
+
+
+// =======================================================================================
+TEST( test_rulebase, overflow ) {
+  // -------------------------------------------------------------------------------------
+  const int32_t ni = 8;
+  const int32_t ns = 20;
+  real8_t ctr[ ni*ns ];
+  int32_t nc[ ni ];
+  for ( int32_t i=0; i<ni; i++ ) {
+    nc[i] = ns;
+    for ( int32_t k=0; k<ns; k++ ) {
+      ctr[ i*ns + k ] = static_cast<real8_t>( k );
+    }
+  }
+  VarReal VI( ni, nc, ctr );
+  VarReal VO( 2, out_nc, out_ctr );
+  fuzzy::Group GI( VI );
+  fuzzy::Group GO( VO );
+
+  fuzzy::RuleBase T( GI, 1 );
+  EXPECT_TRUE( T.bad() );
+  EXPECT_EQ( 0, T.nRule() );
+  EXPECT_EQ( 0, T.size() );
+
+  real8_t x[ ni ];
+  for ( int32_t i=0; i<ni; i++ ) { x[i] = 3.5; }
+  real8_t c[ ni+1 ];
+  for ( int32_t k=0; k<=ni; k++ ) { c[k] = 1.0; }
+  int32_t sets[ ni ] = { 1, 1, 1, 1, 1, 1, 1, 1 };
+
+  T.set( 5, 0, c );
+  EXPECT_EQ( 0, T.index( sets ) );
+  EXPECT_TRUE( static_cast<const real8_t*>(0) == T.coefficients( 5, 0 ) );
+
+  real8_t y = 7.0;
+  T.evaluate( &y, x );
+  EXPECT_DOUBLE_EQ( 0.0, y );
+
+  fuzzy::RuleBase M( GI, GO );
+  EXPECT_TRUE( M.bad() );
+  EXPECT_EQ( 0, M.nRule() );
+
+  M.set( 5, 0, 3 );
+  EXPECT_EQ( 0, M.get( 5, 0 ) );
+
+  real8_t mu[7];
+  M.fire( mu, x );
+  for ( int32_t j=0; j<7; j++ ) {
+    EXPECT_DOUBLE_EQ( 0.0, mu[j] );
+  }
+
+  real8_t ym[2] = { 7.0, 7.0 };
+  M.evaluate( ym, x );
+  EXPECT_DOUBLE_EQ( 0.0, ym[0] );
+  EXPECT_DOUBLE_EQ( 0.0, ym[1] );
+
+  VarReal VS( 3, in_nc, in_ctr );
+  fuzzy::Group GS( VS );
+  fuzzy::RuleBase S( GS, GO );
+  EXPECT_FALSE( S.bad() );
+}
+
+
+} // end namespace
+
+
+// =======================================================================================
+// **                            U T E S T _ R U L E B A S E                            **
+// ======================================================================== END FILE =====
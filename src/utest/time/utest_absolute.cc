@@ -36,6 +36,10 @@
 #include <limits.h>
 #include <gtest/gtest.h>
 #include <AbsoluteDate.hh>
+#include <Dice.hh>
+#include <cmath>
+#include <cstring>
+#include <vector>
 
 namespace {
 
@@ -46,6 +50,148 @@ TEST( test_absdate, one ) {
 
 }
 
+// =======================================================================================
+TEST( test_absdate, civil ) {
+  // -------------------------------------------------------------------------------------
+  AbsoluteDate dt( 2000, 1, 1, 12 );
+
+  EXPECT_DOUBLE_EQ( 946728000.0, dt.epoch.span );
+  EXPECT_DOUBLE_EQ( 2451545.0,   dt.getJD() );
+  EXPECT_DOUBLE_EQ( dt.epoch.span, AbsoluteDate( dt.getJD() ).epoch.span );
+
+  dt.set( 2020, 2, 29, 23, 59, 58.25 );
+  EXPECT_EQ( 2020, dt.getYear() );
+  EXPECT_EQ( 2,    dt.getMonth() );
+  EXPECT_EQ( 29,   dt.getDay() );
+  EXPECT_EQ( 60,   dt.getDayOfYear() );
+  EXPECT_EQ( 23,   dt.getHour() );
+  EXPECT_EQ( 59,   dt.getMinute() );
+  EXPECT_NEAR( 58.25, dt.getSecond(), 1.0e-6 );
+
+  dt.set( 1969, 12, 31, 18, 0, 0.0, -360 );
+  EXPECT_DOUBLE_EQ( D_ZERO, dt.epoch.span );
+}
+
+
+// =======================================================================================
+TEST( test_absdate, string ) {
+  // -------------------------------------------------------------------------------------
+  AbsoluteDate dt;
+  EXPECT_EQ( std::string( "1970-01-01T00:00:00.000Z" ), dt.toString() );
+
+  dt.fromString( "2019-08-21T17:04:05.123Z" );
+  EXPECT_EQ( std::string( "2019-08-21T17:04:05.123Z" ), dt.toString() );
+
+  dt.fromString( "1999-12-31T23:59:59.9996Z" );
+  EXPECT_EQ( std::string( "2000-01-01T00:00:00.000Z" ), dt.toString() );
+
+  dt.fromString( "1960-03-01T00:00:00.000Z" );
+  EXPECT_EQ( std::string( "1960-03-01T00:00:00.000Z" ), dt.toString() );
+
+  dt.fromString( "2019-02-29T00:00:00.000Z" );
+  EXPECT_TRUE( std::isnan( dt.epoch.span ) );
+}
+
+
+// =======================================================================================
+TEST( test_absdate, layouts ) {
+  // -------------------------------------------------------------------------------------
+  const real8_t t0 = 1585312496.0;   // 2020-03-27T12:34:56Z
+  real8_t sec = D_ZERO;
+
+  const char* good[] = { "2020-03-27T12:34:56.000Z",
+                         "2020-03-27T12:34:56Z",
+                         "2020-03-27 12:34:56",
+                         "2020-03-27T12:34:56,000000",
+                         "2020-03-27T14:34:56+02:00",
+                         "2020-03-27T14:34:56+0200",
+                         "2020-03-27T07:04:56-05:30",
+                         "2020-03-27T10:34:56-02",
+                         "2020-03-27T12:34:56.000Z trailing text" };
+
+  for ( size_t i=0; i<sizeof(good)/sizeof(good[0]); i++ ) {
+    EXPECT_FALSE( AbsoluteDate::parse( sec, good[i], strlen( good[i] ) ) ) << good[i];
+    EXPECT_DOUBLE_EQ( t0, sec ) << good[i];
+  }
+
+  EXPECT_FALSE( AbsoluteDate::parse( sec, "2020-03-27", 10 ) );
+  EXPECT_DOUBLE_EQ( t0 - 45296.0, sec );
+
+  EXPECT_FALSE( AbsoluteDate::parse( sec, "2020-03-27T12:34", 16 ) );
+  EXPECT_DOUBLE_EQ( t0 - 56.0, sec );
+
+  EXPECT_FALSE( AbsoluteDate::parse( sec, "2020-03-27T12:34:56.25", 22 ) );
+  EXPECT_DOUBLE_EQ( t0 + 0.25, sec );
+
+  const char* bad[] = { "2020-13-27T12:34:56.000Z",
+                        "2020-03-32T12:34:56.000Z",
+                        "2020-03-27T24:34:56.000Z",
+                        "2020-03-27T12:60:56.000Z",
+                        "2020/03/27T12:34:56.000Z",
+                        "2020-03-27T12:34:56.",
+                        "2020-03-27T12",
+                        "20-03-27",
+                        "" };
+
+  for ( size_t i=0; i<sizeof(bad)/sizeof(bad[0]); i++ ) {
+    EXPECT_TRUE( AbsoluteDate::parse( sec, bad[i], strlen( bad[i] ) ) ) << bad[i];
+  }
+
+  // ----- a fixed layout cut short takes the general path -
+  EXPECT_FALSE( AbsoluteDate::parse( sec, "2020-03-27T12:34:56.000Z", 19 ) );
+  EXPECT_DOUBLE_EQ( t0, sec );
+}
+
+
+// =======================================================================================
+TEST( test_absdate, bulk ) {
+  // -------------------------------------------------------------------------------------
+  Dice* dd = Dice::TestDice();
+
+  const int32_t n      = 10000;
+  const size_t  stride = 25;
+  std::vector<real8_t> sec( n ), back( n );
+  std::vector<char>    buf( n*stride, '\n' );
+
+  for ( int32_t i=0; i<n; i++ ) {
+    // ----- millisecond epochs between 1900 and 2100 ------
+    const real8_t s = -2.2e9 + dd->uniform()*6.3e9;
+    sec[i] = std::round( s*1.0e3 ) * 1.0e-3;
+  }
+  sec[0] = D_ZERO;
+  sec[1] = -0.001;
+
+  AbsoluteDate::format( buf.data(), stride, sec.data(), n );
+  EXPECT_EQ( '\n', buf[24] );
+  EXPECT_EQ( 0, strncmp( "1970-01-01T00:00:00.000Z", buf.data(),      24 ) );
+  EXPECT_EQ( 0, strncmp( "1969-12-31T23:59:59.999Z", buf.data() + 25, 24 ) );
+
+  EXPECT_EQ( 0, AbsoluteDate::parse( back.data(), buf.data(), stride, n ) );
+  for ( int32_t i=0; i<n; i++ ) {
+    EXPECT_NEAR( sec[i], back[i], 1.0e-6 );
+  }
+
+  // ----- corrupt two records -----------------------------
+  buf[ 7*stride + 5 ]  = 'x';
+  buf[ 9*stride + 13 ] = ' ';
+  for ( int32_t i=0; i<n; i++ ) { back[i] = D_ZERO; }
+  EXPECT_EQ( 2, AbsoluteDate::parse( back.data(), buf.data(), stride, n ) );
+  EXPECT_TRUE( std::isnan( back[7] ) );
+  EXPECT_TRUE( std::isnan( back[9] ) );
+  EXPECT_NEAR( sec[8], back[8], 1.0e-6 );
+
+  // ----- pointer and length form ------------------------
+  std::vector<const char*> str( n );
+  std::vector<size_t>      len( n, 24 );
+  for ( int32_t i=0; i<n; i++ ) {
+    str[i] = buf.data() + static_cast<size_t>(i)*stride;
+  }
+  len[8] = 19;
+  EXPECT_EQ( 2, AbsoluteDate::parse( back.data(), str.data(), len.data(), n ) );
+  EXPECT_NEAR( std::floor( sec[8] ), back[8], 1.0e-6 );
+  EXPECT_NEAR( sec[10], back[10], 1.0e-6 );
+}
+
   
 } // end namespace
 